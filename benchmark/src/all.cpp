@@ -1,5 +1,8 @@
 #include "benchmark_config.h"
 
+#include <algorithm>
+#include <thread>
+
 void vector_push_back_std(benchmark::State&);
 void vector_push_back_eastl(benchmark::State&);
 void vector_push_back_ciel(benchmark::State&);
@@ -72,6 +75,38 @@ void sorted_arr_sort_std(benchmark::State&);
 void sorted_arr_sort_eastl(benchmark::State&);
 void sorted_arr_sort_ciel(benchmark::State&);
 
+void reversed_arr_sort_std(benchmark::State&);
+void reversed_arr_sort_eastl(benchmark::State&);
+void reversed_arr_sort_ciel(benchmark::State&);
+
+void organ_pipe_arr_sort_std(benchmark::State&);
+void organ_pipe_arr_sort_eastl(benchmark::State&);
+void organ_pipe_arr_sort_ciel(benchmark::State&);
+
+void few_unique_arr_sort_std(benchmark::State&);
+void few_unique_arr_sort_eastl(benchmark::State&);
+void few_unique_arr_sort_ciel(benchmark::State&);
+
+void small_arr_sort_std(benchmark::State&);
+void small_arr_sort_eastl(benchmark::State&);
+void small_arr_sort_ciel(benchmark::State&);
+void small_arr_sort_small_ciel(benchmark::State&);
+
+void nth_element_std(benchmark::State&);
+void nth_element_eastl(benchmark::State&);
+void nth_element_ciel(benchmark::State&);
+
+void partial_sort_std(benchmark::State&);
+void partial_sort_eastl(benchmark::State&);
+void partial_sort_ciel(benchmark::State&);
+
+void partial_sort_copy_std(benchmark::State&);
+void partial_sort_copy_ciel(benchmark::State&);
+
+void radix_sort_ciel(benchmark::State&);
+void in_place_radix_sort_ciel(benchmark::State&);
+void sorted_arr_radix_sort_ciel(benchmark::State&);
+
 void stable_sort_std(benchmark::State&);
 void stable_sort_eastl(benchmark::State&);
 void stable_sort_ciel(benchmark::State&);
@@ -80,6 +115,136 @@ void sorted_arr_stable_sort_std(benchmark::State&);
 void sorted_arr_stable_sort_eastl(benchmark::State&);
 void sorted_arr_stable_sort_ciel(benchmark::State&);
 
+void runs_arr_stable_sort_std(benchmark::State&);
+void runs_arr_stable_sort_eastl(benchmark::State&);
+void runs_arr_stable_sort_ciel(benchmark::State&);
+
+void nearly_sorted_arr_stable_sort_std(benchmark::State&);
+void nearly_sorted_arr_stable_sort_eastl(benchmark::State&);
+void nearly_sorted_arr_stable_sort_ciel(benchmark::State&);
+
+void medium_arr_stable_sort_std(benchmark::State&);
+void medium_arr_stable_sort_ciel(benchmark::State&);
+void medium_arr_stable_sort_buffer_ciel(benchmark::State&);
+
+void parallel_sort_ciel(benchmark::State&);
+void parallel_stable_sort_ciel(benchmark::State&);
+void parallel_reduce_ciel(benchmark::State&);
+void parallel_transform_ciel(benchmark::State&);
+void parallel_for_each_ciel(benchmark::State&);
+void parallel_count_if_ciel(benchmark::State&);
+void parallel_find_if_ciel(benchmark::State&);
+void parallel_copy_if_ciel(benchmark::State&);
+void parallel_fill_ciel(benchmark::State&);
+void parallel_inclusive_scan_ciel(benchmark::State&);
+void parallel_transform_reduce_ciel(benchmark::State&);
+
+void concurrent_map_read_mostly_locked_ciel_map(benchmark::State&);
+void concurrent_map_read_mostly_ciel_skiplist(benchmark::State&);
+void concurrent_map_write_heavy_locked_ciel_map(benchmark::State&);
+void concurrent_map_write_heavy_ciel_skiplist(benchmark::State&);
+
+void priority_queue_push_pop_std(benchmark::State&);
+void priority_queue_push_pop_ciel(benchmark::State&);
+void priority_queue_push_pop_4_ary_ciel(benchmark::State&);
+void priority_queue_push_pop_8_ary_ciel(benchmark::State&);
+void priority_queue_push_loop_ciel(benchmark::State&);
+void priority_queue_push_range_ciel(benchmark::State&);
+
+void dijkstra_priority_queue_ciel(benchmark::State&);
+void dijkstra_indexed_priority_queue_ciel(benchmark::State&);
+void dijkstra_radix_heap_ciel(benchmark::State&);
+
+void copy_std(benchmark::State&);
+void copy_ciel(benchmark::State&);
+void fill_std(benchmark::State&);
+void fill_ciel(benchmark::State&);
+void equal_std(benchmark::State&);
+void equal_ciel(benchmark::State&);
+void lexicographical_compare_std(benchmark::State&);
+void lexicographical_compare_ciel(benchmark::State&);
+
+void find_std(benchmark::State&);
+void find_ciel(benchmark::State&);
+void find_byte_std(benchmark::State&);
+void find_byte_ciel(benchmark::State&);
+void count_std(benchmark::State&);
+void count_ciel(benchmark::State&);
+void mismatch_std(benchmark::State&);
+void mismatch_ciel(benchmark::State&);
+void min_element_std(benchmark::State&);
+void min_element_ciel(benchmark::State&);
+void minmax_element_std(benchmark::State&);
+void minmax_element_ciel(benchmark::State&);
+
+void inclusive_scan_std(benchmark::State&);
+void inclusive_scan_ciel(benchmark::State&);
+void inclusive_scan_u64_std(benchmark::State&);
+void inclusive_scan_u64_ciel(benchmark::State&);
+void exclusive_scan_std(benchmark::State&);
+void exclusive_scan_ciel(benchmark::State&);
+void transform_reduce_std(benchmark::State&);
+void transform_reduce_ciel(benchmark::State&);
+
+void lower_bound_std(benchmark::State&);
+void lower_bound_eastl(benchmark::State&);
+void lower_bound_ciel(benchmark::State&);
+void eytzinger_index_lower_bound_ciel(benchmark::State&);
+void lower_bound_batch_ciel(benchmark::State&);
+void unordered_set_find_loop_ciel(benchmark::State&);
+void unordered_set_find_batch_ciel(benchmark::State&);
+
+void list_sort_8_bytes_ciel(benchmark::State&);
+void list_sort_8_bytes_vector_stable_sort(benchmark::State&);
+void list_sort_64_bytes_ciel(benchmark::State&);
+void list_sort_64_bytes_vector_stable_sort(benchmark::State&);
+void list_sort_256_bytes_ciel(benchmark::State&);
+void list_sort_256_bytes_vector_stable_sort(benchmark::State&);
+void forward_list_sort_8_bytes_ciel(benchmark::State&);
+void forward_list_sort_8_bytes_vector_stable_sort(benchmark::State&);
+
+void unrolled_list_iterate_list(benchmark::State&);
+void unrolled_list_iterate_vector(benchmark::State&);
+void unrolled_list_iterate_deque(benchmark::State&);
+void unrolled_list_iterate_ciel(benchmark::State&);
+void unrolled_list_random_insert_list(benchmark::State&);
+void unrolled_list_random_insert_vector(benchmark::State&);
+void unrolled_list_random_insert_deque(benchmark::State&);
+void unrolled_list_random_insert_ciel(benchmark::State&);
+
+void ordered_memory_std_set(benchmark::State&);
+void ordered_memory_ciel_set(benchmark::State&);
+void ordered_memory_ciel_compact_set(benchmark::State&);
+void ordered_memory_ciel_btree_set(benchmark::State&);
+void ordered_insert_std_set(benchmark::State&);
+void ordered_insert_ciel_set(benchmark::State&);
+void ordered_insert_ciel_compact_set(benchmark::State&);
+void ordered_insert_ciel_btree_set(benchmark::State&);
+void ordered_sorted_insert_std_set(benchmark::State&);
+void ordered_sorted_insert_ciel_set(benchmark::State&);
+void ordered_sorted_insert_ciel_btree_set(benchmark::State&);
+void ordered_sorted_insert_ciel_flat_set(benchmark::State&);
+void ordered_find_std_set(benchmark::State&);
+void ordered_find_ciel_set(benchmark::State&);
+void ordered_find_ciel_compact_set(benchmark::State&);
+void ordered_find_ciel_btree_set(benchmark::State&);
+void ordered_find_ciel_flat_set(benchmark::State&);
+void ordered_iterate_std_set(benchmark::State&);
+void ordered_iterate_ciel_set(benchmark::State&);
+void ordered_iterate_ciel_compact_set(benchmark::State&);
+void ordered_iterate_ciel_btree_set(benchmark::State&);
+void ordered_iterate_ciel_flat_set(benchmark::State&);
+void ordered_build_std_set(benchmark::State&);
+void ordered_build_ciel_set(benchmark::State&);
+void ordered_build_ciel_btree_set(benchmark::State&);
+void ordered_build_ciel_flat_set(benchmark::State&);
+void ordered_sorted_build_std_set(benchmark::State&);
+void ordered_sorted_build_ciel_set(benchmark::State&);
+void ordered_union_difference_std_set(benchmark::State&);
+void ordered_union_difference_ciel_set(benchmark::State&);
+void ordered_nth_ciel_set(benchmark::State&);
+void ordered_nth_ciel_order_statistic_set(benchmark::State&);
+
 BENCHMARK(vector_push_back_std);
 BENCHMARK(vector_push_back_eastl);
 BENCHMARK(vector_push_back_ciel);
@@ -152,6 +317,38 @@ BENCHMARK(sorted_arr_sort_std);
 BENCHMARK(sorted_arr_sort_eastl);
 BENCHMARK(sorted_arr_sort_ciel);
 
+BENCHMARK(reversed_arr_sort_std);
+BENCHMARK(reversed_arr_sort_eastl);
+BENCHMARK(reversed_arr_sort_ciel);
+
+BENCHMARK(organ_pipe_arr_sort_std);
+BENCHMARK(organ_pipe_arr_sort_eastl);
+BENCHMARK(organ_pipe_arr_sort_ciel);
+
+BENCHMARK(few_unique_arr_sort_std);
+BENCHMARK(few_unique_arr_sort_eastl);
+BENCHMARK(few_unique_arr_sort_ciel);
+
+BENCHMARK(small_arr_sort_std);
+BENCHMARK(small_arr_sort_eastl);
+BENCHMARK(small_arr_sort_ciel);
+BENCHMARK(small_arr_sort_small_ciel);
+
+BENCHMARK(nth_element_std);
+BENCHMARK(nth_element_eastl);
+BENCHMARK(nth_element_ciel);
+
+BENCHMARK(partial_sort_std);
+BENCHMARK(partial_sort_eastl);
+BENCHMARK(partial_sort_ciel);
+
+BENCHMARK(partial_sort_copy_std);
+BENCHMARK(partial_sort_copy_ciel);
+
+BENCHMARK(radix_sort_ciel);
+BENCHMARK(in_place_radix_sort_ciel);
+BENCHMARK(sorted_arr_radix_sort_ciel);
+
 BENCHMARK(stable_sort_std);
 BENCHMARK(stable_sort_eastl);
 BENCHMARK(stable_sort_ciel);
@@ -160,4 +357,134 @@ BENCHMARK(sorted_arr_stable_sort_std);
 BENCHMARK(sorted_arr_stable_sort_eastl);
 BENCHMARK(sorted_arr_stable_sort_ciel);
 
+BENCHMARK(runs_arr_stable_sort_std);
+BENCHMARK(runs_arr_stable_sort_eastl);
+BENCHMARK(runs_arr_stable_sort_ciel);
+
+BENCHMARK(nearly_sorted_arr_stable_sort_std);
+BENCHMARK(nearly_sorted_arr_stable_sort_eastl);
+BENCHMARK(nearly_sorted_arr_stable_sort_ciel);
+
+BENCHMARK(medium_arr_stable_sort_std);
+BENCHMARK(medium_arr_stable_sort_ciel);
+BENCHMARK(medium_arr_stable_sort_buffer_ciel);
+
+BENCHMARK(parallel_sort_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_stable_sort_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_reduce_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_transform_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_for_each_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_count_if_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_find_if_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_copy_if_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_fill_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_inclusive_scan_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(parallel_transform_reduce_ciel)->RangeMultiplier(2)->Range(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+
+BENCHMARK(concurrent_map_read_mostly_locked_ciel_map)->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(concurrent_map_read_mostly_ciel_skiplist)->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(concurrent_map_write_heavy_locked_ciel_map)->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+BENCHMARK(concurrent_map_write_heavy_ciel_skiplist)->ThreadRange(1, std::max(1u, std::thread::hardware_concurrency()))->UseRealTime();
+
+BENCHMARK(priority_queue_push_pop_std)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(priority_queue_push_pop_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(priority_queue_push_pop_4_ary_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(priority_queue_push_pop_8_ary_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(priority_queue_push_loop_ciel)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+BENCHMARK(priority_queue_push_range_ciel)->RangeMultiplier(16)->Range(1 << 4, 1 << 20);
+
+BENCHMARK(dijkstra_priority_queue_ciel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(dijkstra_indexed_priority_queue_ciel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+BENCHMARK(dijkstra_radix_heap_ciel)->RangeMultiplier(16)->Range(1 << 12, 1 << 20);
+
+BENCHMARK(copy_std)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(copy_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(fill_std)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(fill_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(equal_std)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(equal_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(lexicographical_compare_std)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(lexicographical_compare_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+
+BENCHMARK(find_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(find_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(find_byte_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(find_byte_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(count_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(count_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(mismatch_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(mismatch_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(min_element_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(min_element_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(minmax_element_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(minmax_element_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+
+BENCHMARK(inclusive_scan_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(inclusive_scan_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(inclusive_scan_u64_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(inclusive_scan_u64_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(exclusive_scan_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(exclusive_scan_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(transform_reduce_std)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+BENCHMARK(transform_reduce_ciel)->RangeMultiplier(8)->Range(1 << 6, 1 << 24);
+
+BENCHMARK(lower_bound_std)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+BENCHMARK(lower_bound_eastl)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+BENCHMARK(lower_bound_ciel)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+BENCHMARK(eytzinger_index_lower_bound_ciel)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+BENCHMARK(lower_bound_batch_ciel)->RangeMultiplier(8)->Range(1 << 10, 1 << 25);
+BENCHMARK(unordered_set_find_loop_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+BENCHMARK(unordered_set_find_batch_ciel)->RangeMultiplier(8)->Range(1 << 12, 1 << 24);
+
+BENCHMARK(ordered_memory_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_memory_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_memory_ciel_compact_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_memory_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_insert_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_insert_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_insert_ciel_compact_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_insert_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_insert_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_insert_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_insert_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_insert_ciel_flat_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_find_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_find_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_find_ciel_compact_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_find_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_find_ciel_flat_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_iterate_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_iterate_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_iterate_ciel_compact_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_iterate_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_iterate_ciel_flat_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_build_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_build_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_build_ciel_btree_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_build_ciel_flat_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_build_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_sorted_build_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_union_difference_std_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_union_difference_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_nth_ciel_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(ordered_nth_ciel_order_statistic_set)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+BENCHMARK(list_sort_8_bytes_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(list_sort_8_bytes_vector_stable_sort)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(list_sort_64_bytes_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(list_sort_64_bytes_vector_stable_sort)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(list_sort_256_bytes_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(list_sort_256_bytes_vector_stable_sort)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(forward_list_sort_8_bytes_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(forward_list_sort_8_bytes_vector_stable_sort)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
+BENCHMARK(unrolled_list_iterate_list)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_iterate_vector)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_iterate_deque)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_iterate_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_random_insert_list)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_random_insert_vector)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_random_insert_deque)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+BENCHMARK(unrolled_list_random_insert_ciel)->RangeMultiplier(32)->Range(1 << 10, 1 << 20);
+
 BENCHMARK_MAIN();
\ No newline at end of file
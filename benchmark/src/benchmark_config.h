@@ -4,7 +4,9 @@
 #include <benchmark/benchmark.h>
 
 #include <algorithm>
+#include <numeric>
 #include <random>
+#include <vector>
 
 // needed by EASTL
 inline void* operator new[](const size_t size,
@@ -108,6 +110,40 @@ struct sort_benchmark {
     }
 };
 
+// Sorts every 16 elements, which is the base case of sort
+struct small_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    small_arr_sort_benchmark() noexcept {
+        std::random_device rd;
+        const std::mt19937_64 g(rd());
+        std::ranges::generate(arr, g);
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        for (uint64_t* first = std::begin(arr); first + 16 <= std::end(arr); first += 16) {
+            sort(first, first + 16);
+        }
+    }
+};
+
+// Large enough for every thread to get plenty of work
+struct parallel_sort_benchmark {
+    std::vector<uint64_t> arr;
+
+    parallel_sort_benchmark()
+        : arr(1 << 22) {
+        std::random_device rd;
+        const std::mt19937_64 g(rd());
+        std::ranges::generate(arr, g);
+    }
+
+    template<class Sort>
+    auto operator()(Sort sort) noexcept -> void {
+        sort(arr.begin(), arr.end());
+    }
+};
+
 struct sorted_arr_sort_benchmark {
     uint64_t arr[100000];
 
@@ -120,6 +156,110 @@ struct sorted_arr_sort_benchmark {
     }
 };
 
+struct reversed_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    reversed_arr_sort_benchmark() noexcept {
+        std::iota(std::rbegin(arr), std::rend(arr), 0);
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        sort(std::begin(arr), std::end(arr));
+    }
+};
+
+// ascending then descending
+struct organ_pipe_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    organ_pipe_arr_sort_benchmark() noexcept {
+        std::iota(std::begin(arr), std::begin(arr) + 50000, 0);
+        std::iota(std::rbegin(arr), std::rbegin(arr) + 50000, 0);
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        sort(std::begin(arr), std::end(arr));
+    }
+};
+
+// concatenation of 64 sorted runs of random lengths, each one covers a random range of values
+struct runs_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    runs_arr_sort_benchmark() noexcept {
+        std::random_device rd;
+        std::mt19937_64 g(rd());
+        std::ranges::generate(arr, g);
+
+        uint64_t* cuts[65];
+        cuts[0] = std::begin(arr);
+        cuts[64] = std::end(arr);
+        for (size_t i = 1; i < 64; ++i) {
+            cuts[i] = std::begin(arr) + g() % 100000;
+        }
+        std::sort(cuts + 1, cuts + 64);
+        for (size_t i = 0; i < 64; ++i) {
+            std::sort(cuts[i], cuts[i + 1]);
+        }
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        sort(std::begin(arr), std::end(arr));
+    }
+};
+
+// sorted then 1% of elements are swapped with random others
+struct nearly_sorted_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    nearly_sorted_arr_sort_benchmark() noexcept {
+        std::iota(std::begin(arr), std::end(arr), 0);
+
+        std::random_device rd;
+        std::mt19937_64 g(rd());
+        for (size_t i = 0; i < 1000; ++i) {
+            std::swap(arr[g() % 100000], arr[g() % 100000]);
+        }
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        sort(std::begin(arr), std::end(arr));
+    }
+};
+
+// Sorts every 1000 elements, to see the cost of buffer allocation
+struct medium_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    medium_arr_sort_benchmark() noexcept {
+        std::random_device rd;
+        const std::mt19937_64 g(rd());
+        std::ranges::generate(arr, g);
+    }
+
+    template<class Sort>
+    auto operator()(Sort sort) noexcept -> void {
+        for (uint64_t* first = std::begin(arr); first + 1000 <= std::end(arr); first += 1000) {
+            sort(first, first + 1000);
+        }
+    }
+};
+
+// many duplicates, only 16 distinct values
+struct few_unique_arr_sort_benchmark {
+    uint64_t arr[100000];
+
+    few_unique_arr_sort_benchmark() noexcept {
+        std::random_device rd;
+        std::mt19937_64 g(rd());
+        std::ranges::generate(arr, [&g] { return g() % 16; });
+    }
+
+    auto operator()(void(*sort)(uint64_t*, uint64_t*)) noexcept -> void {
+        sort(std::begin(arr), std::end(arr));
+    }
+};
+
 template<class Container, class value_type = typename Container::value_type>
     requires requires (Container c, value_type value) { c.insert(value); } && std::is_same_v<value_type, uint64_t>
 void set_insert_benchmark() noexcept {
@@ -0,0 +1,89 @@
+#include "benchmark_config.h"
+
+#include <algorithm>
+#include <ciel/algorithm.hpp>
+#include <ciel/vector.hpp>
+
+// state.range(0) is the number of elements, from L1 size to beyond LLC
+
+void copy_std(benchmark::State& state) {
+    const std::vector<uint32_t> src(state.range(0), 1);
+    std::vector<uint32_t> dst(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::copy(src.begin(), src.end(), dst.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * src.size() * sizeof(uint32_t));
+}
+
+void copy_ciel(benchmark::State& state) {
+    const ciel::vector<uint32_t> src(state.range(0), 1);
+    ciel::vector<uint32_t> dst(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::copy(src.begin(), src.end(), dst.begin()));
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * src.size() * sizeof(uint32_t));
+}
+
+void fill_std(benchmark::State& state) {
+    std::vector<unsigned char> dst(state.range(0));
+
+    for (auto _ : state) {
+        std::fill(dst.begin(), dst.end(), 42);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * dst.size());
+}
+
+void fill_ciel(benchmark::State& state) {
+    ciel::vector<unsigned char> dst(state.range(0));
+
+    for (auto _ : state) {
+        ciel::fill(dst.begin(), dst.end(), 42);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * dst.size());
+}
+
+void equal_std(benchmark::State& state) {
+    const std::vector<uint32_t> lhs(state.range(0), 1);
+    const std::vector<uint32_t> rhs(state.range(0), 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size() * sizeof(uint32_t));
+}
+
+void equal_ciel(benchmark::State& state) {
+    const ciel::vector<uint32_t> lhs(state.range(0), 1);
+    const ciel::vector<uint32_t> rhs(state.range(0), 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::equal(lhs.begin(), lhs.end(), rhs.begin()));
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size() * sizeof(uint32_t));
+}
+
+void lexicographical_compare_std(benchmark::State& state) {
+    const std::vector<unsigned char> lhs(state.range(0), 1);
+    const std::vector<unsigned char> rhs(state.range(0), 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size());
+}
+
+void lexicographical_compare_ciel(benchmark::State& state) {
+    const ciel::vector<unsigned char> lhs(state.range(0), 1);
+    const ciel::vector<unsigned char> rhs(state.range(0), 1);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
+    }
+    state.SetBytesProcessed(state.iterations() * lhs.size());
+}
\ No newline at end of file
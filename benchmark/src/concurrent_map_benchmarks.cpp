@@ -0,0 +1,103 @@
+#include "benchmark_config.h"
+
+#include <ciel/concurrent_skiplist_map.hpp>
+#include <ciel/map.hpp>
+#include <memory>
+#include <mutex>
+
+// Multithreaded mixed workloads, state.threads() threads share one map with keys in [0, 1 << 16),
+// half of them present at the start. Every operation is a find, an insert or an erase of a random key,
+// read_percent decides how many of them are finds, the rest are split between inserts and erases.
+
+namespace {
+
+constexpr uint64_t concurrent_map_key_range = 1 << 16;
+
+// ciel::map with every operation under one std::mutex
+struct locked_map {
+    ciel::map<uint64_t, uint64_t> map;
+    std::mutex mutex;
+
+    [[nodiscard]] auto find(const uint64_t key) -> bool {
+        std::lock_guard<std::mutex> lock(mutex);
+        return map.find(key) != map.end();
+    }
+
+    auto insert(const uint64_t key) -> void {
+        std::lock_guard<std::mutex> lock(mutex);
+        map.emplace(key, key);
+    }
+
+    auto erase(const uint64_t key) -> void {
+        std::lock_guard<std::mutex> lock(mutex);
+        map.erase(key);
+    }
+};
+
+struct skiplist_map {
+    ciel::concurrent_skiplist_map<uint64_t, uint64_t> map;
+
+    [[nodiscard]] auto find(const uint64_t key) -> bool {
+        return map.find(key) != map.end();
+    }
+
+    auto insert(const uint64_t key) -> void {
+        map.emplace(key, key);
+    }
+
+    auto erase(const uint64_t key) -> void {
+        map.erase(key);
+    }
+};
+
+// Thread 0 builds the shared map before the others start, and destroys it after they all stop.
+template<class Map, uint64_t read_percent>
+void concurrent_map_benchmark(benchmark::State& state) {
+    static std::unique_ptr<Map> shared;
+
+    if (state.thread_index() == 0) {
+        shared = std::make_unique<Map>();
+        for (uint64_t key = 0; key < concurrent_map_key_range; key += 2) {
+            shared->insert(key);
+        }
+    }
+
+    std::mt19937_64 g(state.thread_index() + 1);
+    for (auto _ : state) {
+        const uint64_t r = g();
+        const uint64_t key = r % concurrent_map_key_range;
+        const uint64_t op = (r >> 32) % 100;
+        if (op < read_percent) {
+            benchmark::DoNotOptimize(shared->find(key));
+
+        } else if (op % 2 == 0) {
+            shared->insert(key);
+
+        } else {
+            shared->erase(key);
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index() == 0) {
+        shared.reset();
+    }
+}
+
+}   // namespace
+
+void concurrent_map_read_mostly_locked_ciel_map(benchmark::State& state) {
+    concurrent_map_benchmark<locked_map, 90>(state);
+}
+
+void concurrent_map_read_mostly_ciel_skiplist(benchmark::State& state) {
+    concurrent_map_benchmark<skiplist_map, 90>(state);
+}
+
+void concurrent_map_write_heavy_locked_ciel_map(benchmark::State& state) {
+    concurrent_map_benchmark<locked_map, 50>(state);
+}
+
+void concurrent_map_write_heavy_ciel_skiplist(benchmark::State& state) {
+    concurrent_map_benchmark<skiplist_map, 50>(state);
+}
\ No newline at end of file
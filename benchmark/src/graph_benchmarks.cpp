@@ -0,0 +1,145 @@
+#include "benchmark_config.h"
+
+#include <ciel/functional.hpp>
+#include <ciel/indexed_priority_queue.hpp>
+#include <ciel/limits.hpp>
+#include <ciel/queue.hpp>
+#include <ciel/radix_heap.hpp>
+#include <ciel/utility.hpp>
+#include <ciel/vector.hpp>
+
+// A random directed graph of state.range(0) vertices with 8 out edges each, in compressed sparse rows.
+// Every iteration runs Dijkstra from vertex 0.
+struct dijkstra_benchmark {
+    ciel::vector<uint32_t> offsets;
+    ciel::vector<uint32_t> targets;
+    ciel::vector<uint32_t> weights;
+    ciel::vector<uint32_t> dist;
+
+    static constexpr uint32_t degree = 8;
+    static constexpr uint32_t infinity = ciel::numeric_limits<uint32_t>::max();
+
+    explicit dijkstra_benchmark(const size_t n)
+        : offsets(n + 1), targets(n * degree), weights(n * degree), dist(n) {
+        std::random_device rd;
+        std::mt19937 g(rd());
+
+        for (size_t i = 0; i <= n; ++i) {
+            offsets[i] = i * degree;
+        }
+        for (size_t i = 0; i < n * degree; ++i) {
+            targets[i] = g() % n;
+            weights[i] = g() % 1000 + 1;
+        }
+    }
+
+    auto reset() -> void {
+        std::ranges::fill(dist, infinity);
+        dist[0] = 0;
+    }
+
+};  // struct dijkstra_benchmark
+
+// Lazy deletion: push duplicates and skip the stale ones when popped
+void dijkstra_priority_queue_ciel(benchmark::State& state) {
+    dijkstra_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.reset();
+        ciel::priority_queue<ciel::pair<uint32_t, uint32_t>, ciel::vector<ciel::pair<uint32_t, uint32_t>>,
+                             ciel::greater<ciel::pair<uint32_t, uint32_t>>> pq;
+        pq.push({0, 0});
+
+        while (!pq.empty()) {
+            const auto [d, u] = pq.top();
+            pq.pop();
+            if (d != b.dist[u]) {
+                continue;
+            }
+
+            for (uint32_t e = b.offsets[u]; e < b.offsets[u + 1]; ++e) {
+                const uint32_t v = b.targets[e];
+                const uint32_t nd = d + b.weights[e];
+                if (nd < b.dist[v]) {
+                    b.dist[v] = nd;
+                    pq.push({nd, v});
+                }
+            }
+        }
+        benchmark::DoNotOptimize(b.dist.data());
+    }
+    state.SetItemsProcessed(state.iterations() * b.targets.size());
+}
+
+// Every vertex is in the queue at most once, its key is updated in place
+void dijkstra_indexed_priority_queue_ciel(benchmark::State& state) {
+    dijkstra_benchmark b(state.range(0));
+    ciel::vector<size_t> handles(b.dist.size());
+    ciel::vector<uint32_t> vertices(b.dist.size());   // vertex of every handle
+
+    using queue_type = ciel::indexed_priority_queue<uint32_t, ciel::greater<uint32_t>>;
+    constexpr size_t none = ciel::numeric_limits<size_t>::max();
+
+    for (auto _ : state) {
+        b.reset();
+        std::ranges::fill(handles, none);
+        queue_type pq;
+
+        handles[0] = pq.push(0);
+        vertices[handles[0]] = 0;
+
+        while (!pq.empty()) {
+            const uint32_t d = pq.top();
+            const uint32_t u = vertices[pq.top_handle()];
+            pq.pop();
+
+            for (uint32_t e = b.offsets[u]; e < b.offsets[u + 1]; ++e) {
+                const uint32_t v = b.targets[e];
+                const uint32_t nd = d + b.weights[e];
+                if (nd < b.dist[v]) {
+                    if (b.dist[v] == b.infinity) {
+                        handles[v] = pq.push(nd);
+                        vertices[handles[v]] = v;
+
+                    } else {
+                        // With greater, a shorter distance is closer to the top
+                        pq.increase_key(handles[v], nd);
+                    }
+                    b.dist[v] = nd;
+                }
+            }
+        }
+        benchmark::DoNotOptimize(b.dist.data());
+    }
+    state.SetItemsProcessed(state.iterations() * b.targets.size());
+}
+
+// Lazy deletion like priority_queue, popped distances never decrease so the radix heap applies
+void dijkstra_radix_heap_ciel(benchmark::State& state) {
+    dijkstra_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.reset();
+        ciel::radix_heap<uint32_t, uint32_t> pq;
+        pq.push(0, 0);
+
+        while (!pq.empty()) {
+            const auto [d, u] = pq.top();
+            pq.pop();
+            if (d != b.dist[u]) {
+                continue;
+            }
+
+            for (uint32_t e = b.offsets[u]; e < b.offsets[u + 1]; ++e) {
+                const uint32_t v = b.targets[e];
+                const uint32_t nd = d + b.weights[e];
+                if (nd < b.dist[v]) {
+                    b.dist[v] = nd;
+                    pq.push(nd, v);
+                }
+            }
+        }
+        benchmark::DoNotOptimize(b.dist.data());
+    }
+    state.SetItemsProcessed(state.iterations() * b.targets.size());
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "benchmark_config.h"
+
+#include <algorithm>
+#include <ciel/algorithm.hpp>
+#include <ciel/forward_list.hpp>
+#include <ciel/list.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <iterator>
+
+// Sorting a list in place against copying it into a vector, stable_sort there and copying it back,
+// state.range(0) is the number of elements. Elements are compared by a uint64_t key and padded to Bytes,
+// so that the cost of copying grows with Bytes while the cost of relinking stays the same.
+//
+// Every iteration refills the keys with random values in list order, which is scattered in memory
+// after the first sort, as in a long-lived list.
+
+namespace {
+
+template<size_t Bytes>
+struct list_element {
+    uint64_t key;
+    unsigned char padding[Bytes - sizeof(uint64_t)];
+};
+
+template<>
+struct list_element<sizeof(uint64_t)> {
+    uint64_t key;
+};
+
+struct by_key {
+    template<class T>
+    [[nodiscard]] auto operator()(const T& lhs, const T& rhs) const noexcept -> bool {
+        return lhs.key < rhs.key;
+    }
+};
+
+template<class List>
+auto fill_keys(List& l, std::mt19937_64& g) -> void {
+    for (auto& e : l) {
+        e.key = g();
+    }
+}
+
+template<class List>
+void list_sort_benchmark(benchmark::State& state) {
+    std::mt19937_64 g(state.range(0));
+    List l(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill_keys(l, g);
+        state.ResumeTiming();
+
+        l.sort(by_key());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class List>
+void list_vector_stable_sort_benchmark(benchmark::State& state) {
+    using value_type = typename List::value_type;
+
+    std::mt19937_64 g(state.range(0));
+    List l(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        fill_keys(l, g);
+        state.ResumeTiming();
+
+        ciel::vector<value_type> v(l.begin(), l.end());
+        ciel::stable_sort(v.begin(), v.end(), by_key());
+        std::copy(v.begin(), v.end(), l.begin());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}   // namespace
+
+void list_sort_8_bytes_ciel(benchmark::State& state) {
+    list_sort_benchmark<ciel::list<list_element<8>>>(state);
+}
+
+void list_sort_8_bytes_vector_stable_sort(benchmark::State& state) {
+    list_vector_stable_sort_benchmark<ciel::list<list_element<8>>>(state);
+}
+
+void list_sort_64_bytes_ciel(benchmark::State& state) {
+    list_sort_benchmark<ciel::list<list_element<64>>>(state);
+}
+
+void list_sort_64_bytes_vector_stable_sort(benchmark::State& state) {
+    list_vector_stable_sort_benchmark<ciel::list<list_element<64>>>(state);
+}
+
+void list_sort_256_bytes_ciel(benchmark::State& state) {
+    list_sort_benchmark<ciel::list<list_element<256>>>(state);
+}
+
+void list_sort_256_bytes_vector_stable_sort(benchmark::State& state) {
+    list_vector_stable_sort_benchmark<ciel::list<list_element<256>>>(state);
+}
+
+void forward_list_sort_8_bytes_ciel(benchmark::State& state) {
+    list_sort_benchmark<ciel::forward_list<list_element<8>>>(state);
+}
+
+void forward_list_sort_8_bytes_vector_stable_sort(benchmark::State& state) {
+    list_vector_stable_sort_benchmark<ciel::forward_list<list_element<8>>>(state);
+}
\ No newline at end of file
@@ -0,0 +1,463 @@
+#include "benchmark_config.h"
+
+#include <algorithm>
+#include <ciel/btree_set.hpp>
+#include <ciel/compact_set.hpp>
+#include <ciel/flat_set.hpp>
+#include <ciel/set.hpp>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <set>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// state.range(0) is the number of uint64_t elements, up to well beyond LLC size,
+// keys are shuffled for random insert and find, and ascending for sorted insert
+struct ordered_set_benchmark {
+    std::vector<uint64_t> keys;
+    std::vector<uint64_t> sorted_keys;
+    std::vector<uint64_t> lookups;
+
+    explicit ordered_set_benchmark(const size_t n)
+        : keys(n), lookups(4096) {
+        std::random_device rd;
+        std::mt19937_64 g(rd());
+        // generate copies the engine, so it's passed by reference to keep advancing it
+        std::ranges::generate(keys, std::ref(g));
+        sorted_keys = keys;
+        std::ranges::sort(sorted_keys);
+        // half of the lookups hit
+        for (uint64_t& key : lookups) {
+            key = g() % 2 == 0 ? keys[g() % n] : g();
+        }
+    }
+
+    template<class Set>
+    [[nodiscard]] auto build() const -> Set {
+        return Set(keys.begin(), keys.end());
+    }
+
+    template<class Set>
+    auto bulk_build() const -> void {
+        Set s(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(s.size());
+    }
+
+    template<class Set>
+    auto sorted_build() const -> void {
+        Set s(sorted_keys.begin(), sorted_keys.end());
+        benchmark::DoNotOptimize(s.size());
+    }
+
+    template<class Set>
+    auto insert() const -> void {
+        Set s;
+        for (const uint64_t key : keys) {
+            s.insert(key);
+        }
+        benchmark::DoNotOptimize(s.size());
+    }
+
+    template<class Set>
+    auto sorted_insert() const -> void {
+        Set s;
+        for (uint64_t i = 0; i < keys.size(); ++i) {
+            s.insert(i);
+        }
+        benchmark::DoNotOptimize(s.size());
+    }
+
+    template<class Set>
+    auto find(const Set& s) const noexcept -> void {
+        for (const uint64_t key : lookups) {
+            benchmark::DoNotOptimize(s.find(key));
+        }
+    }
+
+    template<class Set>
+    static auto iterate(const Set& s) noexcept -> void {
+        uint64_t sum = 0;
+        for (const uint64_t key : s) {
+            sum += key;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+};
+
+// Records what malloc really hands out, i.e. the usable size plus glibc's chunk header,
+// so that nodes rounded up to the same size class show the same footprint.
+// Elsewhere only the requested bytes are known.
+struct allocated_bytes {
+    inline static size_t count = 0;
+
+    [[nodiscard]] static auto footprint([[maybe_unused]] void* p, [[maybe_unused]] const size_t requested) noexcept -> size_t {
+#if defined(__GLIBC__)
+        return malloc_usable_size(p) + sizeof(size_t);
+#else
+        return requested;
+#endif
+    }
+};
+
+template<class T>
+struct counting_allocator {
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template<class U>
+    counting_allocator(const counting_allocator<U>&) noexcept {}
+
+    [[nodiscard]] static auto allocate(const size_t n) -> T* {
+        void* p = std::malloc(n * sizeof(T));
+        if (p == nullptr) {
+            throw std::bad_alloc();
+        }
+        allocated_bytes::count += allocated_bytes::footprint(p, n * sizeof(T));
+        return static_cast<T*>(p);
+    }
+
+    static auto deallocate(T* p, const size_t n) noexcept -> void {
+        allocated_bytes::count -= allocated_bytes::footprint(p, n * sizeof(T));
+        std::free(p);
+    }
+
+    template<class U>
+    friend auto operator==(const counting_allocator&, const counting_allocator<U>&) noexcept -> bool {
+        return true;
+    }
+};
+
+// memory per element of uint32_t keys
+template<class Set>
+auto ordered_memory(benchmark::State& state) -> void {
+    const ordered_set_benchmark b(state.range(0));
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        const size_t before = allocated_bytes::count;
+        Set s;
+        for (const uint64_t key : b.keys) {
+            s.insert(static_cast<uint32_t>(key));
+        }
+        bytes = allocated_bytes::count - before;
+        benchmark::DoNotOptimize(s.size());
+    }
+    state.counters["bytes_per_element"] = static_cast<double>(bytes) / static_cast<double>(b.keys.size());
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_memory_std_set(benchmark::State& state) {
+    ordered_memory<std::set<uint32_t, std::less<>, counting_allocator<uint32_t>>>(state);
+}
+
+void ordered_memory_ciel_set(benchmark::State& state) {
+    ordered_memory<ciel::set<uint32_t, std::less<>, counting_allocator<uint32_t>>>(state);
+}
+
+void ordered_memory_ciel_compact_set(benchmark::State& state) {
+    ordered_memory<ciel::compact_set<uint32_t, std::less<>, counting_allocator<uint32_t>>>(state);
+}
+
+void ordered_memory_ciel_btree_set(benchmark::State& state) {
+    ordered_memory<ciel::btree_set<uint32_t, std::less<>, counting_allocator<uint32_t>>>(state);
+}
+
+// insert
+void ordered_insert_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.insert<std::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_insert_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.insert<ciel::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_insert_ciel_btree_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.insert<ciel::btree_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_insert_ciel_compact_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.insert<ciel::compact_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// insert sorted data
+void ordered_sorted_insert_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_insert<std::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_sorted_insert_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_insert<ciel::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_sorted_insert_ciel_btree_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_insert<ciel::btree_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_sorted_insert_ciel_flat_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_insert<ciel::flat_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// find
+void ordered_find_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<std::set<uint64_t>>();
+
+    for (auto _ : state) {
+        b.find(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.lookups.size());
+}
+
+void ordered_find_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::set<uint64_t>>();
+
+    for (auto _ : state) {
+        b.find(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.lookups.size());
+}
+
+void ordered_find_ciel_compact_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::compact_set<uint64_t>>();
+
+    for (auto _ : state) {
+        b.find(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.lookups.size());
+}
+
+void ordered_find_ciel_btree_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::btree_set<uint64_t>>();
+
+    for (auto _ : state) {
+        b.find(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.lookups.size());
+}
+
+void ordered_find_ciel_flat_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::flat_set<uint64_t>>();
+
+    for (auto _ : state) {
+        b.find(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.lookups.size());
+}
+
+// in-order iteration
+void ordered_iterate_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<std::set<uint64_t>>();
+
+    for (auto _ : state) {
+        ordered_set_benchmark::iterate(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_iterate_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::set<uint64_t>>();
+
+    for (auto _ : state) {
+        ordered_set_benchmark::iterate(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_iterate_ciel_compact_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::compact_set<uint64_t>>();
+
+    for (auto _ : state) {
+        ordered_set_benchmark::iterate(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_iterate_ciel_btree_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::btree_set<uint64_t>>();
+
+    for (auto _ : state) {
+        ordered_set_benchmark::iterate(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_iterate_ciel_flat_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::flat_set<uint64_t>>();
+
+    for (auto _ : state) {
+        ordered_set_benchmark::iterate(s);
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// construction from an unsorted range
+
+void ordered_build_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.bulk_build<std::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_build_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.bulk_build<ciel::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_build_ciel_btree_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.bulk_build<ciel::btree_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_build_ciel_flat_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.bulk_build<ciel::flat_set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// build from sorted data
+void ordered_sorted_build_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_build<std::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void ordered_sorted_build_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b.sorted_build<ciel::set<uint64_t>>();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// add a disjoint set of 1/16 the size and remove it again, so that every iteration starts from the same set
+void ordered_union_difference_std_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    auto s = b.build<std::set<uint64_t>>();
+    std::set<uint64_t> other;
+    for (size_t i = 0; i < b.keys.size() / 16; ++i) {
+        other.insert(b.keys[i] ^ 1);
+    }
+
+    for (auto _ : state) {
+        s.insert(other.begin(), other.end());
+        for (const uint64_t key : other) {
+            s.erase(key);
+        }
+        benchmark::DoNotOptimize(s.size());
+    }
+    state.SetItemsProcessed(state.iterations() * other.size());
+}
+
+void ordered_union_difference_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    auto s = b.build<ciel::set<uint64_t>>();
+    ciel::set<uint64_t> other;
+    for (size_t i = 0; i < b.keys.size() / 16; ++i) {
+        other.insert(b.keys[i] ^ 1);
+    }
+
+    for (auto _ : state) {
+        s.unite(other);
+        s.subtract(other);
+        benchmark::DoNotOptimize(s.size());
+    }
+    state.SetItemsProcessed(state.iterations() * other.size());
+}
+
+// k-th smallest element, by walking from begin() and by subtree sizes
+void ordered_nth_ciel_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::set<uint64_t>>();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < 16; ++i) {
+            uint64_t value = *std::next(s.begin(), static_cast<ptrdiff_t>(b.lookups[i] % s.size()));
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
+
+void ordered_nth_ciel_order_statistic_set(benchmark::State& state) {
+    const ordered_set_benchmark b(state.range(0));
+    const auto s = b.build<ciel::set<uint64_t, ciel::less<uint64_t>, ciel::allocator<uint64_t>,
+                                     ciel::avl_subtree_size>>();
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < 16; ++i) {
+            uint64_t value = *s.nth(b.lookups[i] % s.size());
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * 16);
+}
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "benchmark_config.h"
+
+#include <ciel/algorithm.hpp>
+#include <ciel/execution.hpp>
+#include <ciel/numeric.hpp>
+#include <ciel/vector.hpp>
+#include <cmath>
+
+// Scaling of parallel algorithms, state.range(0) is the number of threads.
+// Every element costs a sqrt, so that the work is not bound by memory bandwidth alone.
+
+namespace {
+
+constexpr size_t parallel_benchmark_size = 1 << 22;
+
+struct parallel_benchmark {
+    ciel::thread_pool pool;
+    ciel::vector<double> arr;
+    ciel::vector<double> out;
+
+    explicit parallel_benchmark(const size_t threads)
+        : pool(threads - 1), arr(parallel_benchmark_size), out(parallel_benchmark_size) {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (double& d : arr) {
+            d = dist(g);
+        }
+    }
+
+    [[nodiscard]] auto policy() noexcept -> ciel::execution::parallel_policy {
+        return ciel::execution::par.on(pool);
+    }
+};
+
+}   // namespace
+
+void parallel_reduce_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::reduce(b.policy(), b.arr.begin(), b.arr.end(), 0.0,
+                                              [](double sum, double x) { return sum + std::sqrt(x); }));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_transform_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::transform(b.policy(), b.arr.begin(), b.arr.end(), b.out.begin(), [](double x) { return std::sqrt(x); });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_for_each_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::for_each(b.policy(), b.out.begin(), b.out.end(), [](double& x) { x = std::sqrt(x + 1.0); });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_count_if_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::count_if(b.policy(), b.arr.begin(), b.arr.end(),
+                                                [](double x) { return std::sqrt(x) < 0.5; }));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_find_if_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+    b.arr.back() = 2.0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::find_if(b.policy(), b.arr.begin(), b.arr.end(),
+                                               [](double x) { return std::sqrt(x) > 1.0; }));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_copy_if_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::copy_if(b.policy(), b.arr.begin(), b.arr.end(), b.out.begin(),
+                                               [](double x) { return std::sqrt(x) < 0.5; }));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_fill_ciel(benchmark::State& state) {
+    parallel_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::fill(b.policy(), b.out.begin(), b.out.end(), 1.0);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "benchmark_config.h"
+
+#include <ciel/execution.hpp>
+#include <ciel/numeric.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <numeric>
+
+// state.range(0) is the number of elements, from L1 size to beyond LLC, except for the parallel ones,
+// where it's the number of threads.
+
+namespace {
+
+template<class T>
+struct prefix_sum_benchmark {
+    std::vector<T> arr;
+    std::vector<T> out;
+
+    explicit prefix_sum_benchmark(const size_t n)
+        : arr(n), out(n) {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        std::ranges::generate(arr, [&g] { return static_cast<T>(g() % 1024); });
+    }
+};
+
+constexpr size_t parallel_prefix_sum_size = 1 << 24;
+
+}   // namespace
+
+void inclusive_scan_std(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        std::inclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void inclusive_scan_ciel(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::inclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void inclusive_scan_u64_std(benchmark::State& state) {
+    prefix_sum_benchmark<uint64_t> b(state.range(0));
+
+    for (auto _ : state) {
+        std::inclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void inclusive_scan_u64_ciel(benchmark::State& state) {
+    prefix_sum_benchmark<uint64_t> b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::inclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void exclusive_scan_std(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        std::exclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin(), 0u);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void exclusive_scan_ciel(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        ciel::exclusive_scan(b.arr.begin(), b.arr.end(), b.out.begin(), 0u);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void transform_reduce_std(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::transform_reduce(b.arr.begin(), b.arr.end(), b.arr.begin(), uint32_t(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void transform_reduce_ciel(benchmark::State& state) {
+    prefix_sum_benchmark<uint32_t> b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::transform_reduce(b.arr.begin(), b.arr.end(), b.arr.begin(), uint32_t(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_inclusive_scan_ciel(benchmark::State& state) {
+    ciel::thread_pool pool(state.range(0) - 1);
+    prefix_sum_benchmark<uint32_t> b(parallel_prefix_sum_size);
+
+    for (auto _ : state) {
+        ciel::inclusive_scan(ciel::execution::par.on(pool), b.arr.begin(), b.arr.end(), b.out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void parallel_transform_reduce_ciel(benchmark::State& state) {
+    ciel::thread_pool pool(state.range(0) - 1);
+    prefix_sum_benchmark<uint32_t> b(parallel_prefix_sum_size);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::transform_reduce(ciel::execution::par.on(pool), b.arr.begin(), b.arr.end(),
+                                                        b.arr.begin(), uint32_t(0)));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "benchmark_config.h"
+
+#include <ciel/queue.hpp>
+#include <queue>
+
+// state.range(0) elements are pushed and then popped
+template<class PriorityQueue>
+void priority_queue_push_pop_benchmark(benchmark::State& state) {
+    std::vector<uint64_t> v(state.range(0));
+    std::random_device rd;
+    const std::mt19937_64 g(rd());
+    std::ranges::generate(v, g);
+
+    for (auto _ : state) {
+        PriorityQueue pq;
+        for (const uint64_t i : v) {
+            pq.push(i);
+        }
+        while (!pq.empty()) {
+            auto top = pq.top();
+            benchmark::DoNotOptimize(top);
+            pq.pop();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * v.size());
+}
+
+void priority_queue_push_pop_std(benchmark::State& state) {
+    priority_queue_push_pop_benchmark<std::priority_queue<uint64_t>>(state);
+}
+
+void priority_queue_push_pop_ciel(benchmark::State& state) {
+    priority_queue_push_pop_benchmark<ciel::priority_queue<uint64_t>>(state);
+}
+
+void priority_queue_push_pop_4_ary_ciel(benchmark::State& state) {
+    priority_queue_push_pop_benchmark<ciel::priority_queue<uint64_t, ciel::vector<uint64_t>, ciel::less<uint64_t>,
+                                                           4>>(state);
+}
+
+void priority_queue_push_pop_8_ary_ciel(benchmark::State& state) {
+    priority_queue_push_pop_benchmark<ciel::priority_queue<uint64_t, ciel::vector<uint64_t>, ciel::less<uint64_t>,
+                                                           8>>(state);
+}
+
+// Increasing batches of state.range(0) elements are pushed into a queue of 1 << 20 elements,
+// which is the worst case of pushing them one by one
+template<bool PushRange>
+void priority_queue_push_batch_benchmark(benchmark::State& state) {
+    std::vector<uint64_t> v(1 << 20);
+    std::random_device rd;
+    const std::mt19937_64 g(rd());
+    std::ranges::generate(v, g);
+    const ciel::priority_queue<uint64_t> origin(v.begin(), v.end());
+
+    std::vector<uint64_t> batch(state.range(0));
+    std::iota(batch.begin(), batch.end(), *std::ranges::max_element(v));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        ciel::priority_queue<uint64_t> pq(origin);
+        state.ResumeTiming();
+
+        if constexpr (PushRange) {
+            pq.push_range(batch);
+
+        } else {
+            for (const uint64_t i : batch) {
+                pq.push(i);
+            }
+        }
+        uint64_t top = pq.top();
+        benchmark::DoNotOptimize(top);
+    }
+    state.SetItemsProcessed(state.iterations() * batch.size());
+}
+
+void priority_queue_push_loop_ciel(benchmark::State& state) {
+    priority_queue_push_batch_benchmark<false>(state);
+}
+
+void priority_queue_push_range_ciel(benchmark::State& state) {
+    priority_queue_push_batch_benchmark<true>(state);
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "benchmark_config.h"
+
+#include <algorithm>
+#include <ciel/algorithm.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+
+// state.range(0) is the number of uint32_t elements, from L1 size to beyond LLC.
+// find and mismatch scan the whole range, the only match (or difference) is the last element.
+
+namespace {
+
+struct scan_benchmark {
+    std::vector<uint32_t> arr;
+    std::vector<uint32_t> other;
+
+    explicit scan_benchmark(const size_t n)
+        : arr(n), other(n) {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        std::ranges::generate(arr, [&g] { return g() % 1024; });
+        std::ranges::replace(arr, 1024 - 1, 0);
+        arr.back() = 1024 - 1;
+        other = arr;
+        other.back() = 0;
+    }
+};
+
+}   // namespace
+
+void find_std(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(b.arr.begin(), b.arr.end(), 1024 - 1));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void find_ciel(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::find(b.arr.begin(), b.arr.end(), 1024 - 1));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void find_byte_std(benchmark::State& state) {
+    std::vector<std::byte> arr(state.range(0));
+    arr.back() = std::byte{1};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(arr.begin(), arr.end(), std::byte{1}));
+    }
+    state.SetItemsProcessed(state.iterations() * arr.size());
+}
+
+void find_byte_ciel(benchmark::State& state) {
+    std::vector<std::byte> arr(state.range(0));
+    arr.back() = std::byte{1};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::find(arr.begin(), arr.end(), std::byte{1}));
+    }
+    state.SetItemsProcessed(state.iterations() * arr.size());
+}
+
+void count_std(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count(b.arr.begin(), b.arr.end(), 42));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void count_ciel(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::count(b.arr.begin(), b.arr.end(), 42));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void mismatch_std(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::mismatch(b.arr.begin(), b.arr.end(), b.other.begin()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void mismatch_ciel(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::mismatch(b.arr.begin(), b.arr.end(), b.other.begin()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void min_element_std(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::min_element(b.arr.begin(), b.arr.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void min_element_ciel(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::min_element(b.arr.begin(), b.arr.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void minmax_element_std(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::minmax_element(b.arr.begin(), b.arr.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
+
+void minmax_element_ciel(benchmark::State& state) {
+    scan_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ciel::minmax_element(b.arr.begin(), b.arr.end()));
+    }
+    state.SetItemsProcessed(state.iterations() * b.arr.size());
+}
\ No newline at end of file
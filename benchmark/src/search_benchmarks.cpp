@@ -0,0 +1,122 @@
+#include "benchmark_config.h"
+
+#include <EASTL/algorithm.h>
+#include <algorithm>
+#include <ciel/algorithm.hpp>
+#include <ciel/eytzinger_index.hpp>
+#include <ciel/unordered_set.hpp>
+#include <functional>
+
+// state.range(0) is the number of sorted uint32_t elements, from L1 size to beyond LLC,
+// every iteration searches for the same 4096 random keys, half of them are in arr
+struct search_benchmark {
+    std::vector<uint32_t> arr;
+    std::vector<uint32_t> keys;
+
+    explicit search_benchmark(const size_t n)
+        : arr(n), keys(4096) {
+        std::random_device rd;
+        std::mt19937 g(rd());
+        // generate copies the engine, so it's passed by reference to keep advancing it
+        std::ranges::generate(arr, std::ref(g));
+        for (uint32_t& key : keys) {
+            key = g() % 2 == 0 ? arr[g() % n] : static_cast<uint32_t>(g());
+        }
+        std::ranges::sort(arr);
+    }
+
+    template<class LowerBound>
+    auto operator()(LowerBound lower_bound) noexcept -> void {
+        for (const uint32_t key : keys) {
+            benchmark::DoNotOptimize(lower_bound(key));
+        }
+    }
+};
+
+void lower_bound_std(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b([&b](uint32_t key) {
+            return std::lower_bound(b.arr.data(), b.arr.data() + b.arr.size(), key);
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void lower_bound_eastl(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b([&b](uint32_t key) {
+            return eastl::lower_bound(b.arr.data(), b.arr.data() + b.arr.size(), key);
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void lower_bound_ciel(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+
+    for (auto _ : state) {
+        b([&b](uint32_t key) {
+            return ciel::lower_bound(b.arr.data(), b.arr.data() + b.arr.size(), key);
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void eytzinger_index_lower_bound_ciel(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+    const ciel::eytzinger_index<uint32_t> index(b.arr.begin(), b.arr.end());
+
+    for (auto _ : state) {
+        b([&index](uint32_t key) {
+            return index.lower_bound(key);
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void lower_bound_batch_ciel(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+    std::vector<uint32_t*> res(b.keys.size());
+
+    for (auto _ : state) {
+        ciel::lower_bound_batch(b.arr.data(), b.arr.data() + b.arr.size(), b.keys, res.data());
+        benchmark::DoNotOptimize(res.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+// The scalar loop of unordered_set_find_batch_ciel
+void unordered_set_find_loop_ciel(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+    const ciel::unordered_set<uint32_t> s(b.arr.begin(), b.arr.end());
+    std::ranges::copy(b.arr.begin(), b.arr.begin() + b.keys.size() / 2, b.keys.begin());
+    std::vector<ciel::unordered_set<uint32_t>::const_iterator> res(b.keys.size());
+
+    for (auto _ : state) {
+        for (size_t i = 0; i < b.keys.size(); ++i) {
+            res[i] = s.find(b.keys[i]);
+        }
+        benchmark::DoNotOptimize(res.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
+
+void unordered_set_find_batch_ciel(benchmark::State& state) {
+    search_benchmark b(state.range(0));
+    const ciel::unordered_set<uint32_t> s(b.arr.begin(), b.arr.end());
+    std::ranges::copy(b.arr.begin(), b.arr.begin() + b.keys.size() / 2, b.keys.begin());
+    std::vector<ciel::unordered_set<uint32_t>::const_iterator> res(b.keys.size());
+
+    for (auto _ : state) {
+        s.find_batch(b.keys, res.begin());
+        benchmark::DoNotOptimize(res.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * b.keys.size());
+}
\ No newline at end of file
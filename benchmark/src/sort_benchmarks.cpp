@@ -3,6 +3,8 @@
 #include <EASTL/sort.h>
 #include <algorithm>
 #include <ciel/algorithm.hpp>
+#include <ciel/execution.hpp>
+#include <ciel/vector.hpp>
 
 // sort
 void sort_std(benchmark::State& state) {
@@ -42,6 +44,182 @@ void sorted_arr_sort_ciel(benchmark::State& state) {
     }
 }
 
+// reversed_arr_sort
+void reversed_arr_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        reversed_arr_sort_benchmark()(std::sort);
+    }
+}
+
+void reversed_arr_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        reversed_arr_sort_benchmark()(eastl::sort);
+    }
+}
+
+void reversed_arr_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        reversed_arr_sort_benchmark()(ciel::sort);
+    }
+}
+
+// organ_pipe_arr_sort
+void organ_pipe_arr_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        organ_pipe_arr_sort_benchmark()(std::sort);
+    }
+}
+
+void organ_pipe_arr_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        organ_pipe_arr_sort_benchmark()(eastl::sort);
+    }
+}
+
+void organ_pipe_arr_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        organ_pipe_arr_sort_benchmark()(ciel::sort);
+    }
+}
+
+// few_unique_arr_sort
+void few_unique_arr_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        few_unique_arr_sort_benchmark()(std::sort);
+    }
+}
+
+void few_unique_arr_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        few_unique_arr_sort_benchmark()(eastl::sort);
+    }
+}
+
+void few_unique_arr_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        few_unique_arr_sort_benchmark()(ciel::sort);
+    }
+}
+
+// small_arr_sort
+void small_arr_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        small_arr_sort_benchmark()(std::sort);
+    }
+}
+
+void small_arr_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        small_arr_sort_benchmark()(eastl::sort);
+    }
+}
+
+void small_arr_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        small_arr_sort_benchmark()(ciel::sort);
+    }
+}
+
+void small_arr_sort_small_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        small_arr_sort_benchmark()([](uint64_t* first, uint64_t*) {
+            ciel::sort_small<16>(first);
+        });
+    }
+}
+
+// nth_element, select the median
+void nth_element_std(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            std::nth_element(first, first + (last - first) / 2, last);
+        });
+    }
+}
+
+void nth_element_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            eastl::nth_element(first, first + (last - first) / 2, last);
+        });
+    }
+}
+
+void nth_element_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            ciel::nth_element(first, first + (last - first) / 2, last);
+        });
+    }
+}
+
+// partial_sort, top 1%
+void partial_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            std::partial_sort(first, first + (last - first) / 100, last);
+        });
+    }
+}
+
+void partial_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            eastl::partial_sort(first, first + (last - first) / 100, last);
+        });
+    }
+}
+
+void partial_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            ciel::partial_sort(first, first + (last - first) / 100, last);
+        });
+    }
+}
+
+// partial_sort_copy, top 100
+void partial_sort_copy_std(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            uint64_t out[100];
+            std::partial_sort_copy(first, last, std::begin(out), std::end(out));
+            benchmark::DoNotOptimize(out);
+        });
+    }
+}
+
+void partial_sort_copy_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            uint64_t out[100];
+            ciel::partial_sort_copy(first, last, std::begin(out), std::end(out));
+            benchmark::DoNotOptimize(out);
+        });
+    }
+}
+
+// radix_sort
+void radix_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()(ciel::radix_sort);
+    }
+}
+
+// in_place_radix_sort
+void in_place_radix_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sort_benchmark()(ciel::in_place_radix_sort);
+    }
+}
+
+// sorted_arr_radix_sort
+void sorted_arr_radix_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        sorted_arr_sort_benchmark()(ciel::radix_sort);
+    }
+}
+
 // stable_sort
 void stable_sort_std(benchmark::State& state) {
     for (auto _ : state) {
@@ -78,4 +256,99 @@ void sorted_arr_stable_sort_ciel(benchmark::State& state) {
     for (auto _ : state) {
         sorted_arr_sort_benchmark()(ciel::stable_sort);
     }
+}
+
+// runs_arr_stable_sort
+void runs_arr_stable_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        runs_arr_sort_benchmark()(std::stable_sort);
+    }
+}
+
+void runs_arr_stable_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        runs_arr_sort_benchmark()(eastl::stable_sort);
+    }
+}
+
+void runs_arr_stable_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        runs_arr_sort_benchmark()(ciel::stable_sort);
+    }
+}
+
+// nearly_sorted_arr_stable_sort
+void nearly_sorted_arr_stable_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        nearly_sorted_arr_sort_benchmark()(std::stable_sort);
+    }
+}
+
+void nearly_sorted_arr_stable_sort_eastl(benchmark::State& state) {
+    for (auto _ : state) {
+        nearly_sorted_arr_sort_benchmark()(eastl::stable_sort);
+    }
+}
+
+void nearly_sorted_arr_stable_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        nearly_sorted_arr_sort_benchmark()(ciel::stable_sort);
+    }
+}
+
+// medium_arr_stable_sort
+void medium_arr_stable_sort_std(benchmark::State& state) {
+    for (auto _ : state) {
+        medium_arr_sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            std::stable_sort(first, last);
+        });
+    }
+}
+
+void medium_arr_stable_sort_ciel(benchmark::State& state) {
+    for (auto _ : state) {
+        medium_arr_sort_benchmark()([](uint64_t* first, uint64_t* last) {
+            ciel::stable_sort(first, last);
+        });
+    }
+}
+
+void medium_arr_stable_sort_buffer_ciel(benchmark::State& state) {
+    ciel::vector<uint64_t> buffer;
+
+    for (auto _ : state) {
+        medium_arr_sort_benchmark()([&buffer](uint64_t* first, uint64_t* last) {
+            ciel::stable_sort(first, last, ciel::less<>(), buffer);
+        });
+    }
+}
+
+// parallel_sort, state.range(0) is the number of threads
+void parallel_sort_ciel(benchmark::State& state) {
+    ciel::thread_pool pool(state.range(0) - 1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        parallel_sort_benchmark b;
+        state.ResumeTiming();
+
+        b([&pool](auto first, auto last) {
+            ciel::sort(ciel::execution::par.on(pool), first, last);
+        });
+    }
+}
+
+// parallel_stable_sort, state.range(0) is the number of threads
+void parallel_stable_sort_ciel(benchmark::State& state) {
+    ciel::thread_pool pool(state.range(0) - 1);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        parallel_sort_benchmark b;
+        state.ResumeTiming();
+
+        b([&pool](auto first, auto last) {
+            ciel::stable_sort(ciel::execution::par.on(pool), first, last);
+        });
+    }
 }
\ No newline at end of file
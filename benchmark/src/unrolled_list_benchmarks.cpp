@@ -0,0 +1,103 @@
+#include "benchmark_config.h"
+
+#include <ciel/deque.hpp>
+#include <ciel/iterator.hpp>
+#include <ciel/list.hpp>
+#include <ciel/unrolled_list.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// unrolled_list against list, vector and deque, state.range(0) is the number of uint64_t elements.
+//
+// unrolled_list_iterate_* sums all elements. The list is sorted by random keys before, so that its nodes are
+// visited in scattered memory order as in a long-lived list, instead of the order they were allocated in.
+//
+// unrolled_list_random_insert_* inserts and erases one element at random positions per iteration,
+// so that the size stays the same. Finding the position is part of the cost: vector and deque jump to it,
+// unrolled_list skips whole blocks with nth(), list walks node by node.
+
+namespace {
+
+template<class Container>
+auto make_container(const size_t count) -> Container {
+    Container c;
+    for (size_t i = 0; i < count; ++i) {
+        c.push_back(i);
+    }
+    return c;
+}
+
+template<class Container>
+void iterate_benchmark(benchmark::State& state, const Container& c) {
+    for (auto _ : state) {
+        uint64_t sum = 0;
+        for (const uint64_t i : c) {
+            sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Container, class Position>
+void random_insert_benchmark(benchmark::State& state, Position position) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    std::mt19937_64 g(count);
+    Container c = make_container<Container>(count);
+
+    for (auto _ : state) {
+        c.insert(position(c, g() % (count + 1)), g());
+        c.erase(position(c, g() % (count + 1)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}   // namespace
+
+void unrolled_list_iterate_list(benchmark::State& state) {
+    std::mt19937_64 g(state.range(0));
+    ciel::list<uint64_t> l = make_container<ciel::list<uint64_t>>(static_cast<size_t>(state.range(0)));
+    for (uint64_t& i : l) {
+        i = g();
+    }
+    l.sort();
+    iterate_benchmark(state, l);
+}
+
+void unrolled_list_iterate_vector(benchmark::State& state) {
+    iterate_benchmark(state, make_container<ciel::vector<uint64_t>>(static_cast<size_t>(state.range(0))));
+}
+
+void unrolled_list_iterate_deque(benchmark::State& state) {
+    iterate_benchmark(state, make_container<ciel::deque<uint64_t>>(static_cast<size_t>(state.range(0))));
+}
+
+void unrolled_list_iterate_ciel(benchmark::State& state) {
+    iterate_benchmark(state, make_container<ciel::unrolled_list<uint64_t>>(static_cast<size_t>(state.range(0))));
+}
+
+void unrolled_list_random_insert_list(benchmark::State& state) {
+    random_insert_benchmark<ciel::list<uint64_t>>(state, [](auto& c, const size_t p) {
+        return p <= c.size() / 2 ? ciel::next(c.begin(), static_cast<ptrdiff_t>(p))
+                                 : ciel::prev(c.end(), static_cast<ptrdiff_t>(c.size() - p));
+    });
+}
+
+void unrolled_list_random_insert_vector(benchmark::State& state) {
+    random_insert_benchmark<ciel::vector<uint64_t>>(state, [](auto& c, const size_t p) {
+        return c.begin() + static_cast<ptrdiff_t>(p);
+    });
+}
+
+void unrolled_list_random_insert_deque(benchmark::State& state) {
+    random_insert_benchmark<ciel::deque<uint64_t>>(state, [](auto& c, const size_t p) {
+        return c.begin() + static_cast<ptrdiff_t>(p);
+    });
+}
+
+void unrolled_list_random_insert_ciel(benchmark::State& state) {
+    random_insert_benchmark<ciel::unrolled_list<uint64_t>>(state, [](auto& c, const size_t p) {
+        return c.nth(p);
+    });
+}
\ No newline at end of file
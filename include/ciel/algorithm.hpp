@@ -16,6 +16,7 @@
 #include <ciel/algorithm_impl/find.hpp>
 #include <ciel/algorithm_impl/find_if.hpp>
 #include <ciel/algorithm_impl/find_if_not.hpp>
+#include <ciel/algorithm_impl/for_each.hpp>
 #include <ciel/algorithm_impl/generate.hpp>
 #include <ciel/algorithm_impl/generate_n.hpp>
 #include <ciel/algorithm_impl/is_heap.hpp>
@@ -25,6 +26,7 @@
 #include <ciel/algorithm_impl/iter_swap.hpp>
 #include <ciel/algorithm_impl/lexicographical_compare.hpp>
 #include <ciel/algorithm_impl/lower_bound.hpp>
+#include <ciel/algorithm_impl/lower_bound_batch.hpp>
 #include <ciel/algorithm_impl/make_heap.hpp>
 #include <ciel/algorithm_impl/max.hpp>
 #include <ciel/algorithm_impl/max_element.hpp>
@@ -37,19 +39,24 @@
 #include <ciel/algorithm_impl/move.hpp>
 #include <ciel/algorithm_impl/move_backward.hpp>
 #include <ciel/algorithm_impl/next_permutation.hpp>
+#include <ciel/algorithm_impl/nth_element.hpp>
 #include <ciel/algorithm_impl/partial_sort.hpp>
+#include <ciel/algorithm_impl/partial_sort_copy.hpp>
 #include <ciel/algorithm_impl/pop_heap.hpp>
 #include <ciel/algorithm_impl/prev_permutation.hpp>
 #include <ciel/algorithm_impl/push_heap.hpp>
+#include <ciel/algorithm_impl/radix_sort.hpp>
 #include <ciel/algorithm_impl/remove.hpp>
 #include <ciel/algorithm_impl/remove_if.hpp>
 #include <ciel/algorithm_impl/reverse.hpp>
 #include <ciel/algorithm_impl/rotate.hpp>
 #include <ciel/algorithm_impl/sort.hpp>
 #include <ciel/algorithm_impl/sort_heap.hpp>
+#include <ciel/algorithm_impl/sort_small.hpp>
 #include <ciel/algorithm_impl/stable_sort.hpp>
 #include <ciel/algorithm_impl/swap_ranges.hpp>
 #include <ciel/algorithm_impl/transform.hpp>
+#include <ciel/algorithm_impl/unique.hpp>
 #include <ciel/algorithm_impl/upper_bound.hpp>
 #include <ciel/numeric.hpp>
 
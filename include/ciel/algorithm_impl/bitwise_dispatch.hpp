@@ -0,0 +1,92 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_BITWISE_DISPATCH_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_BITWISE_DISPATCH_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/equal_to.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/contiguous_iterator.hpp>
+#include <ciel/iterator_impl/iter_alias.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/conditional.hpp>
+#include <ciel/type_traits_impl/is_assignable.hpp>
+#include <ciel/type_traits_impl/is_enum.hpp>
+#include <ciel/type_traits_impl/is_integral.hpp>
+#include <ciel/type_traits_impl/is_pointer.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <ciel/type_traits_impl/is_signed.hpp>
+#include <ciel/type_traits_impl/is_trivially_copyable.hpp>
+#include <ciel/type_traits_impl/is_volatile.hpp>
+#include <ciel/type_traits_impl/remove_cv.hpp>
+#include <ciel/type_traits_impl/remove_reference.hpp>
+#include <cstddef>
+#include <cstring>
+
+NAMESPACE_CIEL_BEGIN
+
+// copy, move, move_backward, fill, equal and lexicographical_compare go to memmove, memset and memcmp
+// when the iterators are contiguous and the element-wise operation is exactly the operation on bytes.
+// They are not constexpr, so the element loops are kept for constant evaluation.
+
+namespace details {
+
+// Contiguous, and the elements are not volatile
+template<class It>
+concept plain_contiguous_iterator = contiguous_iterator<It>
+    && is_same_v<remove_cv_t<remove_reference_t<iter_reference_t<It>>>, iter_value_t<It>>
+    && !is_volatile_v<remove_reference_t<iter_reference_t<It>>>;
+
+// *out = *in (or std::move(*in) when Move) is copying sizeof(value_type) bytes
+template<class In, class Out, bool Move>
+concept memmove_assignable = plain_contiguous_iterator<In> && plain_contiguous_iterator<Out>
+    && is_same_v<iter_value_t<In>, iter_value_t<Out>>
+    && is_trivially_copyable_v<iter_value_t<Out>>
+    && is_trivially_assignable_v<iter_reference_t<Out>,
+                                 conditional_t<Move, iter_rvalue_reference_t<In>, iter_reference_t<In>>>;
+
+// pred(*in1, *in2) is comparing the bytes for equality
+template<class In1, class In2, class Pred>
+concept memcmp_equality_comparable = plain_contiguous_iterator<In1> && plain_contiguous_iterator<In2>
+    && is_same_v<iter_value_t<In1>, iter_value_t<In2>>
+    && (is_integral_v<iter_value_t<In1>> || is_enum_v<iter_value_t<In1>> || is_pointer_v<iter_value_t<In1>>)
+    && (is_same_v<Pred, equal_to<>> || is_same_v<Pred, equal_to<iter_value_t<In1>>>);
+
+// comp(*in1, *in2) is comparing one unsigned byte
+template<class In1, class In2, class Compare>
+concept memcmp_lexicographical_comparable = plain_contiguous_iterator<In1> && plain_contiguous_iterator<In2>
+    && is_same_v<iter_value_t<In1>, iter_value_t<In2>>
+    && (is_same_v<iter_value_t<In1>, unsigned char> || is_same_v<iter_value_t<In1>, char8_t>
+        || (is_same_v<iter_value_t<In1>, char> && !is_signed_v<char>))
+    && (is_same_v<Compare, less<>> || is_same_v<Compare, less<iter_value_t<In1>>>);
+
+// *out = value is writing one byte
+template<class Out, class T>
+concept memset_fillable = plain_contiguous_iterator<Out>
+    && sizeof(iter_value_t<Out>) == 1 && is_integral_v<iter_value_t<Out>>
+    && is_trivially_assignable_v<iter_reference_t<Out>, const T&>;
+
+template<class In, class Out>
+auto memmove_forward(In first, In last, Out d_first) noexcept -> Out {
+    const auto n = last - first;
+    if (n > 0) {
+        std::memmove(ciel::to_address(d_first), ciel::to_address(first),
+                     static_cast<size_t>(n) * sizeof(iter_value_t<In>));
+    }
+    return d_first + static_cast<iter_difference_t<Out>>(n);
+}
+
+template<class In, class Out>
+auto memmove_backward(In first, In last, Out d_last) noexcept -> Out {
+    const auto n = last - first;
+    d_last -= static_cast<iter_difference_t<Out>>(n);
+    if (n > 0) {
+        std::memmove(ciel::to_address(d_last), ciel::to_address(first),
+                     static_cast<size_t>(n) * sizeof(iter_value_t<In>));
+    }
+    return d_last;
+}
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_BITWISE_DISPATCH_HPP_
\ No newline at end of file
@@ -1,13 +1,21 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 // It's undefined behavior when d_first in range [first, last), use copy_backward instead
 template<class InputIt, class OutputIt>
 constexpr auto copy(InputIt first, InputIt last, OutputIt d_first) -> OutputIt {
+    if constexpr (details::memmove_assignable<InputIt, OutputIt, false>) {
+        if (!ciel::is_constant_evaluated()) {
+            return details::memmove_forward(first, last, d_first);
+        }
+    }
+
     while (first != last) {
         *d_first++ = *first++;
     }
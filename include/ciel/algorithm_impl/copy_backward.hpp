@@ -1,13 +1,21 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_BACKWARD_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_BACKWARD_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 // It's undefined behavior when d_last in range (first, last], use copy instead
 template<class BidirIt1, class BidirIt2>
 constexpr auto copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last) -> BidirIt2 {
+    if constexpr (details::memmove_assignable<BidirIt1, BidirIt2, false>) {
+        if (!ciel::is_constant_evaluated()) {
+            return details::memmove_backward(first, last, d_last);
+        }
+    }
+
     while (first != last) {
         *(--d_last) = *(--last);
     }
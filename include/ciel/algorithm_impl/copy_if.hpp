@@ -1,7 +1,13 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_IF_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_IF_HPP_
 
+#include <ciel/algorithm_impl/min.hpp>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -17,6 +23,61 @@ constexpr auto copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredi
     return d_first;
 }
 
+// The parallel version takes two passes over pieces: the first one evaluates pred into a mask
+// and counts the selected elements of every piece, then the prefix sums of counts are where the pieces
+// are copied to by the second pass.
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryPredicate>
+    requires details::execution_policy<ExecutionPolicy>
+auto copy_if(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, UnaryPredicate pred)
+    -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        thread_pool& pool = details::policy_pool(policy);
+        const size_t n = static_cast<size_t>(last - first);
+        const size_t grain = details::policy_grain(policy, pool, n);
+        const size_t piece_count = (n + grain - 1) / grain;
+
+        vector<unsigned char> mask(n);
+        vector<size_t> offsets(piece_count + 1, 0);
+
+        auto count = [&](const size_t b, const size_t e) {
+            for (size_t piece = b; piece != e; ++piece) {
+                const size_t piece_last = ciel::min(n, (piece + 1) * grain);
+                size_t res = 0;
+                for (size_t i = piece * grain; i != piece_last; ++i) {
+                    mask[i] = static_cast<bool>(pred(first[i]));
+                    res += mask[i];
+                }
+                offsets[piece + 1] = res;
+            }
+        };
+        details::parallel_for(pool, size_t(0), piece_count, size_t(1), count);
+
+        for (size_t piece = 0; piece < piece_count; ++piece) {
+            offsets[piece + 1] += offsets[piece];
+        }
+
+        auto copy = [&](const size_t b, const size_t e) {
+            for (size_t piece = b; piece != e; ++piece) {
+                const size_t piece_last = ciel::min(n, (piece + 1) * grain);
+                ForwardIt2 out = d_first + offsets[piece];
+                for (size_t i = piece * grain; i != piece_last; ++i) {
+                    if (mask[i]) {
+                        *out = first[i];
+                        ++out;
+                    }
+                }
+            }
+        };
+        details::parallel_for(pool, size_t(0), piece_count, size_t(1), copy);
+
+        return d_first + offsets[piece_count];
+
+    } else {
+        return ciel::copy_if(first, last, d_first, pred);
+    }
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COPY_IF_HPP_
\ No newline at end of file
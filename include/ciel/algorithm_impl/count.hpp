@@ -1,14 +1,28 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COUNT_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COUNT_HPP_
 
+#include <ciel/algorithm_impl/simd_scan.hpp>
 #include <ciel/config.hpp>
 #include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class InputIt, class T>
 [[nodiscard]] constexpr auto count(InputIt first, InputIt last, const T &value)
     -> typename iterator_traits<InputIt>::difference_type {
+#ifdef CIEL_HAS_SIMD_SCAN
+    if constexpr (details::simd_findable<InputIt, T>) {
+        using V = iter_value_t<InputIt>;
+        if (!ciel::is_constant_evaluated() && details::simd_find_value_in_range<V>(value)) {
+            const V* p = ciel::to_address(first);
+            return static_cast<typename iterator_traits<InputIt>::difference_type>(
+                details::simd_count(p, p + (last - first), static_cast<V>(value)));
+        }
+    }
+#endif
+
     typename iterator_traits<InputIt>::difference_type res = 0;
     for (; first != last; ++first) {
         if (*first == value) {
@@ -1,8 +1,12 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COUNT_IF_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COUNT_IF_HPP_
 
+#include <atomic>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
 #include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -18,6 +22,24 @@ template<class InputIt, class UnaryPredicate>
     return res;
 }
 
+template<class ExecutionPolicy, class ForwardIt, class UnaryPredicate>
+    requires details::execution_policy<ExecutionPolicy>
+[[nodiscard]] auto count_if(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryPredicate p)
+    -> typename iterator_traits<ForwardIt>::difference_type {
+    using difference_type = typename iterator_traits<ForwardIt>::difference_type;
+
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        std::atomic<difference_type> res{0};
+        details::parallel_for_pieces(policy, first, last, [&](ForwardIt b, ForwardIt e) {
+            res.fetch_add(ciel::count_if(b, e, p), std::memory_order_relaxed);
+        });
+        return res.load();
+
+    } else {
+        return ciel::count_if(first, last, p);
+    }
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_COUNT_IF_HPP_
\ No newline at end of file
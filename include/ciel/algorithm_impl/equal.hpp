@@ -1,13 +1,24 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_EQUAL_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_EQUAL_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/equal_to.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <cstring>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class InputIt1, class InputIt2, class BinaryPredicate>
 [[nodiscard]] constexpr auto equal(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPredicate p) -> bool {
+    if constexpr (details::memcmp_equality_comparable<InputIt1, InputIt2, BinaryPredicate>) {
+        if (!ciel::is_constant_evaluated()) {
+            const auto n = last1 - first1;
+            return n <= 0 || std::memcmp(ciel::to_address(first1), ciel::to_address(first2),
+                                         static_cast<size_t>(n) * sizeof(iter_value_t<InputIt1>)) == 0;
+        }
+    }
+
     for (; first1 != last1; ++first1, ++first2) {
         if (!p(*first1, *first2)) {
             return false;
@@ -1,17 +1,47 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FILL_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FILL_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <cstring>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class ForwardIt, class T>
 constexpr auto fill(ForwardIt first, ForwardIt last, const T& value) -> void {
+    if constexpr (details::memset_fillable<ForwardIt, T>) {
+        if (!ciel::is_constant_evaluated()) {
+            const iter_value_t<ForwardIt> byte = value;
+            if (last - first > 0) {
+                std::memset(ciel::to_address(first), static_cast<unsigned char>(byte),
+                            static_cast<size_t>(last - first));
+            }
+            return;
+        }
+    }
+
     for (; first != last; ++first) {
         *first = value;
     }
 }
 
+template<class ExecutionPolicy, class ForwardIt, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto fill(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, const T& value) -> void {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        details::parallel_for_pieces(policy, first, last, [&value](ForwardIt b, ForwardIt e) {
+            ciel::fill(b, e, value);
+        });
+
+    } else {
+        ciel::fill(first, last, value);
+    }
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FILL_HPP_
\ No newline at end of file
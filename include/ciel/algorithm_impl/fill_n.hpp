@@ -1,12 +1,26 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FILL_N_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FILL_N_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <cstring>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class OutputIt, class Size, class T>
 constexpr auto fill_n(OutputIt first, Size count, const T& value) -> OutputIt {
+    if constexpr (details::memset_fillable<OutputIt, T>) {
+        if (!ciel::is_constant_evaluated()) {
+            if (count <= 0) {
+                return first;
+            }
+            const iter_value_t<OutputIt> byte = value;
+            std::memset(ciel::to_address(first), static_cast<unsigned char>(byte), static_cast<size_t>(count));
+            return first + static_cast<iter_difference_t<OutputIt>>(count);
+        }
+    }
+
     for (Size i = 0; i < count; ++i) {
         *first++ = value;
     }
@@ -1,12 +1,25 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FIND_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FIND_HPP_
 
+#include <ciel/algorithm_impl/simd_scan.hpp>
 #include <ciel/config.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class InputIt, class T>
 [[nodiscard]] constexpr auto find(InputIt first, InputIt last, const T& value) -> InputIt {
+#ifdef CIEL_HAS_SIMD_SCAN
+    if constexpr (details::simd_findable<InputIt, T>) {
+        using V = iter_value_t<InputIt>;
+        if (!ciel::is_constant_evaluated() && details::simd_find_value_in_range<V>(value)) {
+            const V* p = ciel::to_address(first);
+            return first + (details::simd_find(p, p + (last - first), static_cast<V>(value)) - p);
+        }
+    }
+#endif
+
     for (; first != last; ++first) {
         if (*first == value) {
             return first;
@@ -1,7 +1,12 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FIND_IF_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FIND_IF_HPP_
 
+#include <atomic>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -15,6 +20,47 @@ template<class InputIt, class UnaryPredicate>
     return last;
 }
 
+namespace details {
+
+// Pieces check whether an earlier match is found every this many elements, so they can stop early
+constexpr size_t ParallelFindBlock = 1 << 10;
+
+}   // namespace details
+
+template<class ExecutionPolicy, class ForwardIt, class UnaryPredicate>
+    requires details::execution_policy<ExecutionPolicy>
+[[nodiscard]] auto find_if(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryPredicate p)
+    -> ForwardIt {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        // The index of the first match found so far
+        std::atomic<size_t> found{static_cast<size_t>(last - first)};
+
+        details::parallel_for_pieces(policy, first, last, [&](ForwardIt b, const ForwardIt e) {
+            while (b != e) {
+                const size_t index = static_cast<size_t>(b - first);
+                if (found.load(std::memory_order_relaxed) <= index) {
+                    return;
+                }
+
+                const ForwardIt block_last = e - b > static_cast<ptrdiff_t>(details::ParallelFindBlock)
+                                           ? b + details::ParallelFindBlock : e;
+                b = ciel::find_if(b, block_last, p);
+                if (b != block_last) {
+                    size_t expected = found.load(std::memory_order_relaxed);
+                    const size_t desired = static_cast<size_t>(b - first);
+                    while (desired < expected
+                           && !found.compare_exchange_weak(expected, desired, std::memory_order_relaxed)) {}
+                    return;
+                }
+            }
+        });
+        return first + found.load();
+
+    } else {
+        return ciel::find_if(first, last, p);
+    }
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FIND_IF_HPP_
\ No newline at end of file
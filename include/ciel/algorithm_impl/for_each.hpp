@@ -0,0 +1,37 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FOR_EACH_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FOR_EACH_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class InputIt, class UnaryFunction>
+constexpr auto for_each(InputIt first, InputIt last, UnaryFunction f) -> UnaryFunction {
+    for (; first != last; ++first) {
+        f(*first);
+    }
+    return f;
+}
+
+// Every piece calls the same f, so it must be safe to call concurrently
+template<class ExecutionPolicy, class ForwardIt, class UnaryFunction>
+    requires details::execution_policy<ExecutionPolicy>
+auto for_each(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, UnaryFunction f) -> void {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        details::parallel_for_pieces(policy, first, last, [&f](ForwardIt b, const ForwardIt e) {
+            for (; b != e; ++b) {
+                f(*b);
+            }
+        });
+
+    } else {
+        ciel::for_each(first, last, f);
+    }
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_FOR_EACH_HPP_
\ No newline at end of file
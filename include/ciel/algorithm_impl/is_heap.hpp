@@ -4,17 +4,18 @@
 #include <ciel/algorithm_impl/is_heap_until.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 [[nodiscard]] constexpr auto is_heap(RandomIt first, RandomIt last, Compare comp) -> bool {
-    return details::is_heap_until_helper(first, last, comp) == last;
+    return details::is_heap_until_helper<D>(first, last, comp) == last;
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 [[nodiscard]] constexpr auto is_heap(RandomIt first, RandomIt last) -> bool {
-    return details::is_heap_until_helper(first, last, less<>()) == last;
+    return details::is_heap_until_helper<D>(first, last, less<>()) == last;
 }
 
 NAMESPACE_CIEL_END
@@ -3,16 +3,21 @@
 
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
 namespace details {
 
-template<class RandomIt, class Compare>
+template<size_t D, class RandomIt, class Compare>
 [[nodiscard]] constexpr auto is_heap_until_helper(RandomIt first, RandomIt last, Compare&& comp) -> RandomIt {
+    if (first == last) {
+        return last;
+    }
+
     RandomIt res = first;
     while (++res < last) {
-        if (comp(*(first + (res - first - 1) / 2), *res)) {
+        if (comp(*(first + (res - first - 1) / static_cast<decltype(res - first)>(D)), *res)) {
             return res;
         }
     }
@@ -21,14 +26,14 @@ template<class RandomIt, class Compare>
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 [[nodiscard]] constexpr auto is_heap_until(RandomIt first, RandomIt last, Compare comp) -> RandomIt {
-    return details::is_heap_until_helper(first, last, comp);
+    return details::is_heap_until_helper<D>(first, last, comp);
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 [[nodiscard]] constexpr auto is_heap_until(RandomIt first, RandomIt last) -> RandomIt {
-    return details::is_heap_until_helper(first, last, less<>());
+    return details::is_heap_until_helper<D>(first, last, less<>());
 }
 
 NAMESPACE_CIEL_END
@@ -1,14 +1,27 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LEXICOGRAPHICAL_COMPARE_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LEXICOGRAPHICAL_COMPARE_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <cstring>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class InputIt1, class InputIt2, class Compare>
 [[nodiscard]] constexpr auto lexicographical_compare(InputIt1 first1, InputIt1 last1,
                                                      InputIt2 first2, InputIt2 last2, Compare comp) -> bool {
+    if constexpr (details::memcmp_lexicographical_comparable<InputIt1, InputIt2, Compare>) {
+        if (!ciel::is_constant_evaluated()) {
+            const auto len1 = static_cast<size_t>(last1 - first1);
+            const auto len2 = static_cast<size_t>(last2 - first2);
+            const size_t len = len1 < len2 ? len1 : len2;
+            const int res = len == 0 ? 0 : std::memcmp(ciel::to_address(first1), ciel::to_address(first2), len);
+            return res != 0 ? res < 0 : len1 < len2;
+        }
+    }
+
     for (; (first1 != last1) && (first2 != last2); ++first1, ++first2) {
         if (comp(*first1, *first2)) {
             return true;
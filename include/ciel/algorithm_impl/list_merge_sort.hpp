@@ -0,0 +1,125 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LIST_MERGE_SORT_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LIST_MERGE_SORT_HPP_
+
+#include <ciel/config.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// Sorting of linked nodes for list and forward_list, nodes are only relinked, never copied or allocated.
+//
+// Both work on null-terminated chains linked through next_, list restores prev_ afterwards.
+// less takes two nodes. When less throws, the chain still holds every node, in unspecified order.
+
+namespace details {
+
+template<class Node>
+[[nodiscard]] auto chain_back(Node* node) noexcept -> Node* {
+    CIEL_PRECONDITION(node != nullptr);
+
+    while (node->next_ != nullptr) {
+        node = node->next_;
+    }
+    return node;
+}
+
+// Merges rhs into lhs, ties keep nodes of lhs first, so it's stable when lhs comes first in the original order.
+// rhs is always left empty.
+template<class Node, class Less>
+auto merge_chains(Node*& lhs, Node*& rhs, Less& less) -> void {
+    Node* r = rhs;
+    rhs = nullptr;
+    if (r == nullptr) {
+        return;
+    }
+    if (lhs == nullptr) {
+        lhs = r;
+        return;
+    }
+
+    Node* l = lhs;
+    Node* res = nullptr;
+    Node** tail = &res;
+
+    CIEL_TRY {
+        while (l != nullptr && r != nullptr) {
+            if (less(r, l)) {
+                *tail = r;
+                r = r->next_;
+            } else {
+                *tail = l;
+                l = l->next_;
+            }
+            tail = &(*tail)->next_;
+        }
+        *tail = l != nullptr ? l : r;
+        lhs = res;
+
+    } CIEL_CATCH (...) {
+        // less threw with both l and r non-empty
+        *tail = l;
+        chain_back(l)->next_ = r;
+        lhs = res;
+        CIEL_THROW;
+    }
+}
+
+// Bottom-up merge sort, stable.
+// bins[i] is empty or holds a sorted run of 2^i nodes, every node goes into bins[0] and carries upward,
+// like incrementing a binary counter, so that only runs of equal length get merged.
+template<class Node, class Less>
+auto merge_sort_chain(Node*& head, Less less) -> void {
+    constexpr size_t bin_count = 64;
+
+    Node* bins[bin_count]{};
+    size_t fill = 0;
+    Node* run = nullptr;
+
+    CIEL_TRY {
+        while (head != nullptr) {
+            run = head;
+            head = head->next_;
+            run->next_ = nullptr;
+
+            size_t i = 0;
+            for (; i < fill && bins[i] != nullptr; ++i) {
+                merge_chains(bins[i], run, less);
+                run = bins[i];
+                bins[i] = nullptr;
+            }
+            if (i == fill) {
+                ++fill;
+            }
+            bins[i] = run;
+            run = nullptr;
+        }
+
+        // Higher bins hold earlier nodes
+        for (size_t i = 0; i < fill; ++i) {
+            merge_chains(bins[i], run, less);
+            run = bins[i];
+            bins[i] = nullptr;
+        }
+        head = run;
+
+    } CIEL_CATCH (...) {
+        // Put every node back in one chain
+        for (size_t i = 0; i < fill; ++i) {
+            if (bins[i] != nullptr) {
+                chain_back(bins[i])->next_ = run;
+                run = bins[i];
+            }
+        }
+        if (run != nullptr) {
+            chain_back(run)->next_ = head;
+            head = run;
+        }
+        CIEL_THROW;
+    }
+}
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LIST_MERGE_SORT_HPP_
\ No newline at end of file
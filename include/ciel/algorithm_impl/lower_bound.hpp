@@ -4,25 +4,69 @@
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/advance.hpp>
+#include <ciel/iterator_impl/contiguous_iterator.hpp>
 #include <ciel/iterator_impl/distance.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/memory_impl/prefetch.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_base_of.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
+namespace details {
+
+// For random access iterators, every loop keeps the right half (including the probed element) or the left half
+// without branches, so the loop runs exactly log(N) times and the choice becomes a conditional move,
+// which never mispredicts. For contiguous ranges, both possible probes of the next loop are prefetched,
+// so the memory latency of the next loop overlaps with the current comparison.
+// Pred(element) is true for elements before the result.
+template<class RandomIt, class Pred>
+[[nodiscard]] constexpr auto branchless_partition_point(RandomIt first, RandomIt last, Pred& pred) -> RandomIt {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    difference_type len = last - first;
+    if (len == 0) {
+        return first;
+    }
+
+    while (len > 1) {
+        const difference_type half = len / 2;
+        if constexpr (contiguous_iterator<RandomIt>) {
+            const difference_type next_half = (len - half) / 2;
+            details::prefetch(ciel::to_address(first) + next_half);
+            details::prefetch(ciel::to_address(first) + (half + next_half));
+        }
+        first += pred(first[half]) ? half : 0;
+        len -= half;
+    }
+    return first + static_cast<difference_type>(pred(*first));
+}
+
+}   // namespace details
+
 template<class ForwardIt, class T, class Compare>
 [[nodiscard]] constexpr auto lower_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp) -> ForwardIt {
-    auto count = ciel::distance(first, last);
-    while (count > 0) {
-        ForwardIt it = first;
-        auto step = count / 2;
-        ciel::advance(it, step);
-        if (comp(*it, value)) {
-            first = ++it;
-            count -= step + 1;
-        } else {
-            count = step;
+    if constexpr (is_base_of_v<random_access_iterator_tag, typename iterator_traits<ForwardIt>::iterator_category>) {
+        auto pred = [&](const auto& element) -> bool {
+            return comp(element, value);
+        };
+        return details::branchless_partition_point(first, last, pred);
+
+    } else {
+        auto count = ciel::distance(first, last);
+        while (count > 0) {
+            ForwardIt it = first;
+            auto step = count / 2;
+            ciel::advance(it, step);
+            if (comp(*it, value)) {
+                first = ++it;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
         }
+        return first;
     }
-    return first;
 }
 
 template<class ForwardIt, class T>
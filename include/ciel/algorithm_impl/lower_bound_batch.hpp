@@ -0,0 +1,78 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LOWER_BOUND_BATCH_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LOWER_BOUND_BATCH_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/contiguous_iterator.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/memory_impl/prefetch.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// Writes lower_bound(first, last, key) of every key in keys to out, in the order of keys.
+//
+// Searches of a group of keys are interleaved level by level. Since every branchless search on the same range
+// halves the same length, all the searches in a group are at the same level, and the next probe of each one
+// is known right after its comparison. We prefetch it and move on to the other searches of the group,
+// so the cache misses of the whole group are in flight at the same time instead of one after another.
+
+template<class RandomIt, class Keys, class OutputIt, class Compare>
+constexpr auto lower_bound_batch(RandomIt first, RandomIt last, const Keys& keys, OutputIt out,
+                                 Compare comp) -> OutputIt {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+    using key_iterator = decltype(keys.begin());
+
+    constexpr size_t group_size = details::PrefetchGroupSize;
+
+    const difference_type len = last - first;
+    key_iterator key_it = keys.begin();
+    const key_iterator key_last = keys.end();
+
+    if (len == 0) {
+        for (; key_it != key_last; ++key_it, ++out) {
+            *out = first;
+        }
+        return out;
+    }
+
+    RandomIt bases[group_size];
+    key_iterator group_keys[group_size];
+
+    while (key_it != key_last) {
+        size_t n = 0;
+        for (; n < group_size && key_it != key_last; ++n, ++key_it) {
+            bases[n] = first;
+            group_keys[n] = key_it;
+        }
+
+        for (difference_type remaining = len; remaining > 1;) {
+            const difference_type half = remaining / 2;
+            const difference_type next_half = (remaining - half) / 2;
+
+            for (size_t i = 0; i < n; ++i) {
+                bases[i] += comp(bases[i][half], *group_keys[i]) ? half : 0;
+                if constexpr (contiguous_iterator<RandomIt>) {
+                    details::prefetch(ciel::to_address(bases[i]) + next_half);
+                }
+            }
+            remaining -= half;
+        }
+
+        for (size_t i = 0; i < n; ++i, ++out) {
+            *out = bases[i] + static_cast<difference_type>(comp(*bases[i], *group_keys[i]));
+        }
+    }
+
+    return out;
+}
+
+template<class RandomIt, class Keys, class OutputIt>
+constexpr auto lower_bound_batch(RandomIt first, RandomIt last, const Keys& keys, OutputIt out) -> OutputIt {
+    return ciel::lower_bound_batch(first, last, keys, out, less<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_LOWER_BOUND_BATCH_HPP_
\ No newline at end of file
@@ -5,31 +5,61 @@
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/distance.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
 namespace details {
 
-template<class RandomIt, class Compare>
+template<size_t D, class RandomIt, class Compare>
 constexpr auto make_heap_helper(RandomIt first, RandomIt last, Compare comp) -> void {
     auto len = ciel::distance(first, last);
     if (len > 1) {
-        for (auto offset = (len - 2) / 2; offset >= 0; --offset) {
-            ciel::sift_down(first, comp, len, first + offset);
+        for (auto offset = (len - 2) / static_cast<decltype(len)>(D); offset >= 0; --offset) {
+            ciel::sift_down<D>(first, comp, len, first + offset);
+        }
+    }
+}
+
+// [first, first + old_len) is already a heap, make [first, last) a heap.
+//
+// Floyd's construction restricted to the ancestors of the appended elements: from bottom to top,
+// parents of the nodes changed on the previous level are sifted down. The ranges shrink by D on every level,
+// so it's O(k + log(N)^2) for k appended elements, instead of O(N) for rebuilding.
+template<size_t D, class RandomIt, class Compare>
+constexpr auto make_heap_appended(RandomIt first, typename iterator_traits<RandomIt>::difference_type old_len,
+                                  RandomIt last, Compare comp) -> void {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    constexpr auto d = static_cast<difference_type>(D);
+
+    const difference_type len = last - first;
+    if (old_len >= len) {
+        return;
+    }
+
+    difference_type lo = old_len;
+    difference_type hi = len - 1;
+
+    while (hi > 0) {
+        lo = lo > 0 ? (lo - 1) / d : 0;
+        hi = (hi - 1) / d;
+        for (difference_type i = hi; i >= lo; --i) {
+            ciel::sift_down<D>(first, comp, len, first + i);
         }
     }
 }
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 constexpr auto make_heap(RandomIt first, RandomIt last, Compare comp) -> void {
-    details::make_heap_helper(first, last, comp);
+    details::make_heap_helper<D>(first, last, comp);
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 constexpr auto make_heap(RandomIt first, RandomIt last) -> void {
-    details::make_heap_helper(first, last, less<>());
+    details::make_heap_helper<D>(first, last, less<>());
 }
 
 NAMESPACE_CIEL_END
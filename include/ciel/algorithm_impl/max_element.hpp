@@ -1,13 +1,30 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MAX_ELEMENT_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MAX_ELEMENT_HPP_
 
+#include <ciel/algorithm_impl/simd_scan.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class ForwardIt, class Compare>
 [[nodiscard]] constexpr auto max_element(ForwardIt first, ForwardIt last, Compare comp) -> ForwardIt {
+#ifdef CIEL_HAS_SIMD_SCAN
+    if constexpr (details::simd_min_max_comparable<ForwardIt, Compare>) {
+        using V = iter_value_t<ForwardIt>;
+        const auto n = last - first;
+        if (!ciel::is_constant_evaluated() && static_cast<size_t>(n) >= details::simd_scan_lanes<V>) {
+            const V* p = ciel::to_address(first);
+            const V* e = p + n;
+            // Find the maximum value, then its first position
+            const V value = details::simd_min_max_value<V, false, true>(p, e).second;
+            return first + (details::simd_find(p, e, value) - p);
+        }
+    }
+#endif
+
     if (first == last) {
         return last;
     }
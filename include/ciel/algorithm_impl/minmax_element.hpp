@@ -1,8 +1,11 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MINMAX_ELEMENT_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MINMAX_ELEMENT_HPP_
 
+#include <ciel/algorithm_impl/simd_scan.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 #include <ciel/utility_impl/pair.hpp>
 
 NAMESPACE_CIEL_BEGIN
@@ -11,6 +14,21 @@ NAMESPACE_CIEL_BEGIN
 template<class ForwardIt, class Compare>
 [[nodiscard]] constexpr auto minmax_element(ForwardIt first, ForwardIt last, Compare comp)
     -> pair<ForwardIt,ForwardIt> {
+#ifdef CIEL_HAS_SIMD_SCAN
+    if constexpr (details::simd_min_max_comparable<ForwardIt, Compare>) {
+        using V = iter_value_t<ForwardIt>;
+        const auto n = last - first;
+        if (!ciel::is_constant_evaluated() && static_cast<size_t>(n) >= details::simd_scan_lanes<V>) {
+            const V* p = ciel::to_address(first);
+            const V* e = p + n;
+            // The first minimum and the last maximum
+            const pair<V, V> values = details::simd_min_max_value<V, true, true>(p, e);
+            return {first + (details::simd_find(p, e, values.first) - p),
+                    first + (details::simd_find_last(p, e, values.second) - p)};
+        }
+    }
+#endif
+
     ForwardIt min = first;
     ForwardIt max = first;
     if (first == last || ++first == last) {
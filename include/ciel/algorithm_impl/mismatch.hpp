@@ -1,8 +1,12 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MISMATCH_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MISMATCH_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
+#include <ciel/algorithm_impl/simd_scan.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/equal_to.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 #include <ciel/utility_impl/pair.hpp>
 
 NAMESPACE_CIEL_BEGIN
@@ -10,6 +14,17 @@ NAMESPACE_CIEL_BEGIN
 template<class InputIt1, class InputIt2, class BinaryPredicate>
 [[nodiscard]] constexpr auto mismatch(InputIt1 first1, InputIt1 last1, InputIt2 first2, BinaryPredicate p)
     -> pair<InputIt1,InputIt2> {
+#ifdef CIEL_HAS_SIMD_SCAN
+    if constexpr (details::memcmp_equality_comparable<InputIt1, InputIt2, BinaryPredicate>) {
+        if (!ciel::is_constant_evaluated()) {
+            const auto* p1 = ciel::to_address(first1);
+            const size_t i = details::simd_mismatch(p1, p1 + (last1 - first1), ciel::to_address(first2));
+            return {first1 + static_cast<iter_difference_t<InputIt1>>(i),
+                    first2 + static_cast<iter_difference_t<InputIt2>>(i)};
+        }
+    }
+#endif
+
     while (first1 != last1 && p(*first1, *first2)) {
         ++first1;
         ++first2;
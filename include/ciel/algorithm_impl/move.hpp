@@ -1,7 +1,9 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MOVE_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_MOVE_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
 #include <ciel/config.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
 #include <utility>
 
 NAMESPACE_CIEL_BEGIN
@@ -9,6 +11,12 @@ NAMESPACE_CIEL_BEGIN
 // It's undefined behavior when d_first in range [first, last), use move_backward instead
 template<class InputIt, class OutputIt>
 constexpr auto move(InputIt first, InputIt last, OutputIt d_first) -> OutputIt {
+    if constexpr (details::memmove_assignable<InputIt, OutputIt, true>) {
+        if (!ciel::is_constant_evaluated()) {
+            return details::memmove_forward(first, last, d_first);
+        }
+    }
+
     while (first != last) {
         *d_first++ = std::move(*first++);
     }
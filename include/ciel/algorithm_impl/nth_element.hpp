@@ -0,0 +1,129 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_NTH_ELEMENT_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_NTH_ELEMENT_HPP_
+
+#include <ciel/algorithm_impl/iter_swap.hpp>
+#include <ciel/algorithm_impl/sort.hpp>
+#include <ciel/algorithm_impl/sort_small.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// Introselect: quickselect with sort's pivot selection and partitions, but only the side containing nth is kept.
+//
+// Quickselect is O(N) on average but O(N^2) in the worst case, so we count the elements partitioned so far,
+// and when it exceeds IntroselectWorkFactor * N, the pivots are chosen by median of medians from then on:
+// medians of every 5 elements are gathered to the front, and their median is selected recursively.
+// It's greater than and less than at least 3/10 of the elements, which keeps the worst case O(N).
+//
+// Like pdqsort, when the pivot equals to the element before the range, the equal elements go to the left side
+// and we are done if nth is among them, so ranges with many duplicates don't make partitions unbalanced.
+
+namespace details {
+
+constexpr ptrdiff_t IntroselectWorkFactor = 4;
+
+template<bool Branchless, class RandomIt, class Compare>
+constexpr auto introselect_loop(RandomIt first, RandomIt nth, RandomIt last, Compare comp,
+                                typename iterator_traits<RandomIt>::difference_type work_allowed,
+                                bool leftmost) -> void;
+
+// Move the median of medians of every 5 elements to first
+// precondition: last - first >= Threshold
+template<bool Branchless, class RandomIt, class Compare>
+constexpr auto median_of_medians_pivot(RandomIt first, RandomIt last, Compare comp) -> void {
+    RandomIt medians_last = first;
+    for (RandomIt group = first; last - group >= 5; group += 5) {
+        details::insertion_sort(group, group + 5, comp);
+        ciel::iter_swap(medians_last, group + 2);
+        ++medians_last;
+    }
+
+    const RandomIt mid = first + (medians_last - first) / 2;
+    details::introselect_loop<Branchless>(first, mid, medians_last, comp, 0, true);
+    ciel::iter_swap(first, mid);
+}
+
+template<bool Branchless, class RandomIt, class Compare>
+constexpr auto introselect_loop(RandomIt first, RandomIt nth, RandomIt last, Compare comp,
+                                typename iterator_traits<RandomIt>::difference_type work_allowed,
+                                bool leftmost) -> void {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    while (true) {
+        const difference_type size = last - first;
+
+        if (size < Threshold) {
+            if constexpr (Branchless) {
+                details::sort_small_n(first, static_cast<size_t>(size), comp);
+            } else if (leftmost) {
+                details::insertion_sort(first, last, comp);
+            } else {
+                details::unguarded_insertion_sort(first, last, comp);
+            }
+            return;
+        }
+
+        if (work_allowed > 0) {
+            details::choose_pivot(first, last, comp);
+            work_allowed -= size;
+
+        } else {
+            details::median_of_medians_pivot<Branchless>(first, last, comp);
+        }
+
+        // Elements equal to *(first - 1) go to the left side, they are all in their final positions
+        if (!leftmost && !comp(*(first - 1), *first)) {
+            const RandomIt pivot_pos = details::partition_left(first, last, comp);
+            if (nth <= pivot_pos) {
+                return;
+            }
+            first = pivot_pos + 1;
+            continue;
+        }
+
+        const RandomIt pivot_pos = details::partition_right_dispatch<Branchless>(first, last, comp).first;
+        if (pivot_pos == nth) {
+            return;
+        }
+
+        const difference_type l_size = pivot_pos - first;
+        const difference_type r_size = last - (pivot_pos + 1);
+        if (work_allowed > 0 && (l_size < size / 8 || r_size < size / 8)) {
+            details::break_patterns(first, pivot_pos, last);
+        }
+
+        if (nth < pivot_pos) {
+            last = pivot_pos;
+
+        } else {
+            first = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+}
+
+}   // namespace details
+
+template<class RandomIt, class Compare>
+constexpr auto nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp) -> void {
+    if (nth == last || last - first < 2) {
+        return;
+    }
+    constexpr bool branchless = details::is_branchless_comparable<typename iterator_traits<RandomIt>::value_type,
+                                                                  Compare>::value;
+    details::introselect_loop<branchless>(first, nth, last, comp, details::IntroselectWorkFactor * (last - first),
+                                          true);
+}
+
+template<class RandomIt>
+constexpr auto nth_element(RandomIt first, RandomIt nth, RandomIt last) -> void {
+    ciel::nth_element(first, nth, last, less<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_NTH_ELEMENT_HPP_
\ No newline at end of file
@@ -3,20 +3,43 @@
 
 #include <ciel/algorithm_impl/iter_swap.hpp>
 #include <ciel/algorithm_impl/make_heap.hpp>
-#include <ciel/algorithm_impl/push_heap.hpp>
+#include <ciel/algorithm_impl/nth_element.hpp>
+#include <ciel/algorithm_impl/sift_down.hpp>
+#include <ciel/algorithm_impl/sort.hpp>
 #include <ciel/algorithm_impl/sort_heap.hpp>
 #include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
+// When middle - first is small, we keep the smallest elements in a max heap and replace its top with
+// every smaller element, only a few elements go into the heap, so it's about N comparisons.
+// Otherwise the heap is large, every replacement costs O(log K) cache misses,
+// so we nth_element first which is O(N), then sort the prefix only.
+
+namespace details {
+
+constexpr ptrdiff_t PartialSortSelectRatio = 512;
+
+}   // namespace details
+
 template<class RandomIt, class Compare>
 constexpr auto partial_sort(RandomIt first, RandomIt middle, RandomIt last, Compare comp) -> void {
+    if (first == middle) {
+        return;
+    }
+    if ((middle - first) * details::PartialSortSelectRatio > last - first) {
+        ciel::nth_element(first, middle, last, comp);
+        ciel::sort(first, middle, comp);
+        return;
+    }
+
+    const auto len = middle - first;
     ciel::make_heap(first, middle, comp);
     for (RandomIt it = middle; it != last; ++it) {
-        if (!comp(*first, *it)) {
-            ciel::pop_heap(first, middle, comp);
-            ciel::iter_swap(middle, it);
-            ciel::push_heap(first, middle, comp);
+        if (comp(*it, *first)) {
+            ciel::iter_swap(first, it);
+            ciel::sift_down(first, comp, len, first);
         }
     }
     ciel::sort_heap(first, middle, comp);
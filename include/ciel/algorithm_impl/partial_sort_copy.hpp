@@ -0,0 +1,47 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_PARTIAL_SORT_COPY_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_PARTIAL_SORT_COPY_HPP_
+
+#include <ciel/algorithm_impl/make_heap.hpp>
+#include <ciel/algorithm_impl/sift_down.hpp>
+#include <ciel/algorithm_impl/sort_heap.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+
+NAMESPACE_CIEL_BEGIN
+
+// The input is read once, so it works on input iterators.
+// [d_first, d_last) is a bounded max heap of the smallest elements so far, a smaller element replaces its top.
+// return d_first + min(N, d_last - d_first)
+template<class InputIt, class RandomIt, class Compare>
+constexpr auto partial_sort_copy(InputIt first, InputIt last, RandomIt d_first, RandomIt d_last,
+                                 Compare comp) -> RandomIt {
+    RandomIt d_it = d_first;
+    for (; first != last && d_it != d_last; ++first, ++d_it) {
+        *d_it = *first;
+    }
+
+    const auto len = d_it - d_first;
+    if (len == 0) {
+        return d_it;
+    }
+
+    ciel::make_heap(d_first, d_it, comp);
+    for (; first != last; ++first) {
+        if (comp(*first, *d_first)) {
+            *d_first = *first;
+            ciel::sift_down(d_first, comp, len, d_first);
+        }
+    }
+    ciel::sort_heap(d_first, d_it, comp);
+
+    return d_it;
+}
+
+template<class InputIt, class RandomIt>
+constexpr auto partial_sort_copy(InputIt first, InputIt last, RandomIt d_first, RandomIt d_last) -> RandomIt {
+    return ciel::partial_sort_copy(first, last, d_first, d_last, less<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_PARTIAL_SORT_COPY_HPP_
\ No newline at end of file
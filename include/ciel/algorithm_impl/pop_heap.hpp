@@ -4,27 +4,28 @@
 #include <ciel/algorithm_impl/sift_down.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
 namespace details {
 
-template<class RandomIt, class Compare>
+template<size_t D, class RandomIt, class Compare>
 constexpr auto pop_heap_helper(RandomIt first, RandomIt last, Compare comp) -> void {
     std::swap(*first, *(last - 1));
-    ciel::sift_down(first, comp, last - first - 1, first);
+    ciel::sift_down<D>(first, comp, last - first - 1, first);
 }
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 constexpr auto pop_heap(RandomIt first, RandomIt last, Compare comp) -> void {
-    details::pop_heap_helper(first, last, comp);
+    details::pop_heap_helper<D>(first, last, comp);
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 constexpr auto pop_heap(RandomIt first, RandomIt last) -> void {
-    details::pop_heap_helper(first, last, less<>());
+    details::pop_heap_helper<D>(first, last, less<>());
 }
 
 NAMESPACE_CIEL_END
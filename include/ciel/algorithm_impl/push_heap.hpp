@@ -4,17 +4,24 @@
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/distance.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
 // Note that the element to be pushed is already at index [last - 1]
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 constexpr auto sift_up(RandomIt first, RandomIt last, Compare comp,
                        typename iterator_traits<RandomIt>::difference_type len) -> void {
+    static_assert(D >= 2);
+
     using value_type = typename iterator_traits<RandomIt>::value_type;
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    constexpr auto d = static_cast<difference_type>(D);
+
     if (len > 1) {
-        len = (len - 2) / 2;
+        len = (len - 2) / d;
         RandomIt head = first + len;
         if (comp(*head, *--last)) {    // If head is less than itself, sift up
             value_type tmp_larger = std::move(*last);    // largest element so far, keep sifting up
@@ -24,7 +31,7 @@ constexpr auto sift_up(RandomIt first, RandomIt last, Compare comp,
                 if (len == 0) {
                     break;
                 }
-                len = (len - 1) / 2;
+                len = (len - 1) / d;
                 head = first + len;
             } while (comp(*head, tmp_larger));
             *last = std::move(tmp_larger);
@@ -34,22 +41,22 @@ constexpr auto sift_up(RandomIt first, RandomIt last, Compare comp,
 
 namespace details {
 
-template<class RandomIt, class Compare>
+template<size_t D, class RandomIt, class Compare>
 constexpr auto push_heap_helper(RandomIt first, RandomIt last, Compare comp) -> void {
     auto len = ciel::distance(first, last);
-    ciel::sift_up(first, last, comp, len);
+    ciel::sift_up<D>(first, last, comp, len);
 }
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 constexpr auto push_heap(RandomIt first, RandomIt last, Compare comp) -> void {
-    details::push_heap_helper(first, last, comp);
+    details::push_heap_helper<D>(first, last, comp);
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 constexpr auto push_heap(RandomIt first, RandomIt last) -> void {
-    details::push_heap_helper(first, last, less<>());
+    details::push_heap_helper<D>(first, last, less<>());
 }
 
 NAMESPACE_CIEL_END
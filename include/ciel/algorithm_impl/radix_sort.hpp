@@ -0,0 +1,256 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_RADIX_SORT_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_RADIX_SORT_HPP_
+
+#include <bit>  // for std::bit_cast
+#include <ciel/algorithm_impl/iter_swap.hpp>
+#include <ciel/algorithm_impl/move.hpp>
+#include <ciel/algorithm_impl/sort.hpp>
+#include <ciel/concepts_impl/floating_point.hpp>
+#include <ciel/concepts_impl/integral.hpp>
+#include <ciel/concepts_impl/same_as.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/identity.hpp>
+#include <ciel/functional_impl/invoke.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/conditional.hpp>
+#include <ciel/type_traits_impl/is_signed.hpp>
+#include <ciel/type_traits_impl/make_unsigned.hpp>
+#include <ciel/type_traits_impl/remove_cvref.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <cstdint>
+
+NAMESPACE_CIEL_BEGIN
+
+// Radix sort works on the bit representation of keys, one byte (digit) at a time.
+// Keys are transformed into unsigned integers whose unsigned order is the same as the original order:
+// signed integers get their sign bit flipped, non-negative floats get their sign bit flipped,
+// and negative floats get all bits flipped.
+//
+// radix_sort is LSD (least significant digit first) and stable, it needs a scratch buffer of N elements
+// allocated by the given allocator. All digit histograms are counted in one pass,
+// and passes whose digits are all identical are skipped, e.g. sorting small numbers in uint64_t.
+//
+// in_place_radix_sort is MSD American flag sort. It permutes each bucket in place and recurses on the next digit,
+// so it needs no buffer, but it's not stable.
+
+namespace details {
+
+constexpr size_t RadixBits = 8;
+constexpr size_t RadixSize = 1 << RadixBits;
+constexpr ptrdiff_t RadixSortThreshold = 64;
+
+template<class T>
+concept radix_sortable_key = (integral<T> && !same_as<T, bool>)
+    || (floating_point<T> && (sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(uint64_t)));
+
+template<radix_sortable_key Key>
+[[nodiscard]] constexpr auto radix_key(Key key) noexcept {
+    if constexpr (floating_point<Key>) {
+        using U = conditional_t<sizeof(Key) == sizeof(uint32_t), uint32_t, uint64_t>;
+        constexpr U sign_bit = U(1) << (sizeof(U) * 8 - 1);
+        const U u = std::bit_cast<U>(key);
+        return (u & sign_bit) ? static_cast<U>(~u) : static_cast<U>(u | sign_bit);
+
+    } else if constexpr (is_signed_v<Key>) {
+        using U = make_unsigned_t<Key>;
+        constexpr U sign_bit = U(1) << (sizeof(U) * 8 - 1);
+        return static_cast<U>(static_cast<U>(key) ^ sign_bit);
+
+    } else {
+        return key;
+    }
+}
+
+template<class KeyFn, class T>
+[[nodiscard]] constexpr auto radix_key_of(KeyFn& key_fn, T&& t) {
+    return details::radix_key(ciel::invoke(key_fn, std::forward<T>(t)));
+}
+
+template<class Key>
+[[nodiscard]] constexpr auto radix_digit(Key key, size_t shift) noexcept -> size_t {
+    return static_cast<size_t>(key >> shift) & (RadixSize - 1);
+}
+
+// Insertionsort by keys for small ranges, it's stable
+template<class RandomIt, class KeyFn>
+constexpr auto radix_insertion_sort(RandomIt first, RandomIt last, KeyFn& key_fn) -> void {
+    details::insertion_sort(first, last, [&key_fn](const auto& lhs, const auto& rhs) {
+        return details::radix_key_of(key_fn, lhs) < details::radix_key_of(key_fn, rhs);
+    });
+}
+
+template<class InputIt, class OutputIt, class KeyFn>
+constexpr auto radix_scatter(InputIt first, InputIt last, OutputIt d_first, size_t* offsets,
+                             size_t shift, KeyFn& key_fn) -> void {
+    for (; first != last; ++first) {
+        const size_t digit = details::radix_digit(details::radix_key_of(key_fn, *first), shift);
+        *(d_first + offsets[digit]++) = std::move(*first);
+    }
+}
+
+template<class RandomIt, class KeyFn, class Alloc>
+constexpr auto lsd_radix_sort(RandomIt first, RandomIt last, KeyFn& key_fn, const Alloc& alloc) -> void {
+    using value_type = typename iterator_traits<RandomIt>::value_type;
+    using key_type = decltype(details::radix_key_of(key_fn, *first));
+    using buffer_type = vector<value_type, typename allocator_traits<Alloc>::template rebind_alloc<value_type>>;
+
+    constexpr size_t passes = sizeof(key_type);
+    const size_t n = last - first;
+
+    // Count histograms of all digits in one pass
+    size_t counts[passes][RadixSize]{};
+    for (RandomIt it = first; it != last; ++it) {
+        const key_type key = details::radix_key_of(key_fn, *it);
+        for (size_t pass = 0; pass < passes; ++pass) {
+            ++counts[pass][details::radix_digit(key, pass * RadixBits)];
+        }
+    }
+
+    // A pass is meaningless when all the elements have the same digit
+    bool skip[passes];
+    bool all_skipped = true;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        skip[pass] = counts[pass][details::radix_digit(details::radix_key_of(key_fn, *first), pass * RadixBits)] == n;
+        all_skipped &= skip[pass];
+    }
+    if (all_skipped) {
+        return;
+    }
+
+    const typename buffer_type::allocator_type buffer_alloc(alloc);
+    buffer_type buffer(buffer_alloc);
+    buffer.reserve(n);
+    for (RandomIt it = first; it != last; ++it) {
+        buffer.emplace_back(std::move(*it));
+    }
+
+    // Elements ping-pong between buffer and [first, last)
+    bool in_buffer = true;
+    for (size_t pass = 0; pass < passes; ++pass) {
+        if (skip[pass]) {
+            continue;
+        }
+
+        size_t offsets[RadixSize];
+        size_t sum = 0;
+        for (size_t digit = 0; digit < RadixSize; ++digit) {
+            offsets[digit] = sum;
+            sum += counts[pass][digit];
+        }
+
+        if (in_buffer) {
+            details::radix_scatter(buffer.begin(), buffer.end(), first, offsets, pass * RadixBits, key_fn);
+        } else {
+            details::radix_scatter(first, last, buffer.begin(), offsets, pass * RadixBits, key_fn);
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        ciel::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+template<class RandomIt, class KeyFn>
+constexpr auto american_flag_sort(RandomIt first, RandomIt last, KeyFn& key_fn, size_t shift) -> void {
+    const size_t n = last - first;
+    if (n < static_cast<size_t>(RadixSortThreshold)) {
+        // All the higher digits are the same, so comparing the whole keys is fine
+        details::radix_insertion_sort(first, last, key_fn);
+        return;
+    }
+
+    size_t counts[RadixSize]{};
+    for (RandomIt it = first; it != last; ++it) {
+        ++counts[details::radix_digit(details::radix_key_of(key_fn, *it), shift)];
+    }
+
+    const size_t first_digit = details::radix_digit(details::radix_key_of(key_fn, *first), shift);
+    if (counts[first_digit] != n) {
+        size_t heads[RadixSize];
+        size_t tails[RadixSize];
+        size_t sum = 0;
+        for (size_t digit = 0; digit < RadixSize; ++digit) {
+            heads[digit] = sum;
+            sum += counts[digit];
+            tails[digit] = sum;
+        }
+
+        // Swap every element into its bucket, each swap puts at least one element into its final bucket
+        for (size_t digit = 0; digit < RadixSize; ++digit) {
+            while (heads[digit] < tails[digit]) {
+                const size_t d = details::radix_digit(details::radix_key_of(key_fn, *(first + heads[digit])), shift);
+                if (d == digit) {
+                    ++heads[digit];
+                } else {
+                    ciel::iter_swap(first + heads[digit], first + heads[d]);
+                    ++heads[d];
+                }
+            }
+        }
+    }
+
+    if (shift == 0) {
+        return;
+    }
+
+    if (counts[first_digit] == n) {
+        details::american_flag_sort(first, last, key_fn, shift - RadixBits);
+        return;
+    }
+
+    RandomIt bucket_first = first;
+    for (size_t digit = 0; digit < RadixSize; ++digit) {
+        if (counts[digit] > 1) {
+            details::american_flag_sort(bucket_first, bucket_first + counts[digit], key_fn, shift - RadixBits);
+        }
+        bucket_first += counts[digit];
+    }
+}
+
+}   // namespace details
+
+template<class RandomIt, class KeyFn, class Alloc>
+    requires details::radix_sortable_key<remove_cvref_t<invoke_result_t<KeyFn&, typename iterator_traits<RandomIt>::reference>>>
+constexpr auto radix_sort(RandomIt first, RandomIt last, KeyFn key_fn, const Alloc& alloc) -> void {
+    if (last - first < details::RadixSortThreshold) {
+        details::radix_insertion_sort(first, last, key_fn);
+        return;
+    }
+    details::lsd_radix_sort(first, last, key_fn, alloc);
+}
+
+template<class RandomIt, class KeyFn>
+    requires details::radix_sortable_key<remove_cvref_t<invoke_result_t<KeyFn&, typename iterator_traits<RandomIt>::reference>>>
+constexpr auto radix_sort(RandomIt first, RandomIt last, KeyFn key_fn) -> void {
+    ciel::radix_sort(first, last, key_fn, allocator<typename iterator_traits<RandomIt>::value_type>());
+}
+
+template<class RandomIt>
+    requires details::radix_sortable_key<typename iterator_traits<RandomIt>::value_type>
+constexpr auto radix_sort(RandomIt first, RandomIt last) -> void {
+    ciel::radix_sort(first, last, identity());
+}
+
+template<class RandomIt, class KeyFn>
+    requires details::radix_sortable_key<remove_cvref_t<invoke_result_t<KeyFn&, typename iterator_traits<RandomIt>::reference>>>
+constexpr auto in_place_radix_sort(RandomIt first, RandomIt last, KeyFn key_fn) -> void {
+    using key_type = decltype(details::radix_key_of(key_fn, *first));
+    if (last - first < 2) {
+        return;
+    }
+    details::american_flag_sort(first, last, key_fn, (sizeof(key_type) - 1) * details::RadixBits);
+}
+
+template<class RandomIt>
+    requires details::radix_sortable_key<typename iterator_traits<RandomIt>::value_type>
+constexpr auto in_place_radix_sort(RandomIt first, RandomIt last) -> void {
+    ciel::in_place_radix_sort(first, last, identity());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_RADIX_SORT_HPP_
\ No newline at end of file
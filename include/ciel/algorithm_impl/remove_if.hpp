@@ -1,14 +1,17 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_REMOVE_IF_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_REMOVE_IF_HPP_
 
-#include <ciel/algorithm_impl/find_if.hpp>
 #include <ciel/config.hpp>
+#include <utility>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class ForwardIt, class UnaryPredicate>
 auto remove_if(ForwardIt first, ForwardIt last, UnaryPredicate p) -> ForwardIt {
-    first = ciel::find_if(first, last, p);
+    // Not ciel::find_if, containers include this header, and find_if includes the parallel backend
+    while (first != last && !p(*first)) {
+        ++first;
+    }
     if (first != last) {
         for (ForwardIt i = first; ++i != last;) {
             if (!p(*i)) {
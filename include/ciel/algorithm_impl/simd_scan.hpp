@@ -0,0 +1,501 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SIMD_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SIMD_SCAN_HPP_
+
+#include <bit>  // for std::bit_cast, std::bit_width, std::countr_zero
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iter_alias.hpp>
+#include <ciel/limits.hpp>
+#include <ciel/type_traits_impl/conditional.hpp>
+#include <ciel/type_traits_impl/is_enum.hpp>
+#include <ciel/type_traits_impl/is_floating_point.hpp>
+#include <ciel/type_traits_impl/is_integral.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <ciel/type_traits_impl/is_signed.hpp>
+#include <ciel/type_traits_impl/make_signed.hpp>
+#include <ciel/type_traits_impl/make_unsigned.hpp>
+#include <ciel/type_traits_impl/remove_cv.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#ifdef __SSE2__
+#define CIEL_HAS_SIMD_SCAN
+#endif
+
+NAMESPACE_CIEL_BEGIN
+
+// Vector kernels of find, count, mismatch and min/max_element over contiguous ranges of arithmetic types.
+//
+// The instruction set is chosen at compile time like sort_small: AVX2 when it's enabled (e.g. -mavx2 or
+// -march=native), otherwise SSE2, which every x86-64 has. Without either, the algorithms keep their loops.
+//
+// Every kernel compares one register of elements at a time and turns the result into a bit mask of bytes,
+// so an element of size S sets S bits, and the first (last) match is countr_zero (bit_width - 1) over S.
+// The last partial register is handled by loading the last full register of the range again, which is fine
+// when rechecking the overlapped elements can't change the result.
+
+namespace details {
+
+// Types whose equality is either the equality of their bits, or IEEE equality of float and double
+template<class T>
+concept simd_scan_element = (is_integral_v<T> && !is_same_v<T, bool>) || is_enum_v<T>
+    || is_same_v<T, float> || is_same_v<T, double>;
+
+// find(first, last, value) and count(first, last, value) compare elements with value converted to value_type,
+// integral values which are out of its range are left to the loops, since the usual arithmetic conversions
+// may still make them equal to some elements.
+template<class It, class T>
+concept simd_findable = plain_contiguous_iterator<It> && simd_scan_element<iter_value_t<It>>
+    && (is_same_v<remove_cv_t<T>, iter_value_t<It>>
+        || (is_integral_v<iter_value_t<It>> && is_integral_v<T> && !is_same_v<remove_cv_t<T>, bool>));
+
+// Integers of up to 32 bits compared by less
+template<class It, class Compare>
+concept simd_min_max_comparable = plain_contiguous_iterator<It>
+    && is_integral_v<iter_value_t<It>> && !is_same_v<iter_value_t<It>, bool> && sizeof(iter_value_t<It>) <= 4
+    && (is_same_v<Compare, less<>> || is_same_v<Compare, less<iter_value_t<It>>>);
+
+template<class V, class T>
+[[nodiscard]] constexpr auto simd_find_value_in_range(const T& value) noexcept -> bool {
+    if constexpr (is_same_v<remove_cv_t<T>, V>) {
+        return true;
+
+    } else if constexpr (is_signed_v<T> == is_signed_v<V>) {
+        return numeric_limits<V>::min() <= value && value <= numeric_limits<V>::max();
+
+    } else if constexpr (is_signed_v<T>) {
+        return value >= 0 && static_cast<make_unsigned_t<T>>(value) <= numeric_limits<V>::max();
+
+    } else {
+        return value <= static_cast<make_unsigned_t<V>>(numeric_limits<V>::max());
+    }
+}
+
+#ifdef CIEL_HAS_SIMD_SCAN
+
+template<size_t Size>
+using simd_scan_uint = conditional_t<Size == 1, uint8_t,
+                       conditional_t<Size == 2, uint16_t,
+                       conditional_t<Size == 4, uint32_t, uint64_t>>>;
+
+#if defined(__AVX2__)
+
+struct simd_scan_register {
+    using type = __m256i;
+
+    static constexpr size_t bytes = 32;
+    static constexpr uint32_t full_mask = 0xFFFFFFFFu;
+
+    [[nodiscard]] static auto load(const void* p) noexcept -> type {
+        return _mm256_loadu_si256(static_cast<const __m256i*>(p));
+    }
+
+    static auto store(void* p, type v) noexcept -> void {
+        _mm256_storeu_si256(static_cast<__m256i*>(p), v);
+    }
+
+    // One bit per byte
+    [[nodiscard]] static auto mask(type v) noexcept -> uint32_t {
+        return static_cast<uint32_t>(_mm256_movemask_epi8(v));
+    }
+
+    [[nodiscard]] static auto bitwise_or(type a, type b) noexcept -> type {
+        return _mm256_or_si256(a, b);
+    }
+
+    template<class T>
+    [[nodiscard]] static auto set1(const T value) noexcept -> type {
+        const auto u = std::bit_cast<simd_scan_uint<sizeof(T)>>(value);
+
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_set1_epi8(static_cast<char>(u));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_set1_epi16(static_cast<short>(u));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_set1_epi32(static_cast<int>(u));
+        } else {
+            return _mm256_set1_epi64x(static_cast<long long>(u));
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto eq(type a, type b) noexcept -> type {
+        if constexpr (is_same_v<T, float>) {
+            return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+        } else if constexpr (is_same_v<T, double>) {
+            return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm256_cmpeq_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_cmpeq_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_cmpeq_epi32(a, b);
+        } else {
+            return _mm256_cmpeq_epi64(a, b);
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto sub(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1) {
+            return _mm256_sub_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm256_sub_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm256_sub_epi32(a, b);
+        } else {
+            return _mm256_sub_epi64(a, b);
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto min(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1) {
+            return is_signed_v<T> ? _mm256_min_epi8(a, b) : _mm256_min_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return is_signed_v<T> ? _mm256_min_epi16(a, b) : _mm256_min_epu16(a, b);
+        } else {
+            return is_signed_v<T> ? _mm256_min_epi32(a, b) : _mm256_min_epu32(a, b);
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto max(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1) {
+            return is_signed_v<T> ? _mm256_max_epi8(a, b) : _mm256_max_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return is_signed_v<T> ? _mm256_max_epi16(a, b) : _mm256_max_epu16(a, b);
+        } else {
+            return is_signed_v<T> ? _mm256_max_epi32(a, b) : _mm256_max_epu32(a, b);
+        }
+    }
+
+};  // struct simd_scan_register
+
+#else
+
+struct simd_scan_register {
+    using type = __m128i;
+
+    static constexpr size_t bytes = 16;
+    static constexpr uint32_t full_mask = 0xFFFFu;
+
+    [[nodiscard]] static auto load(const void* p) noexcept -> type {
+        return _mm_loadu_si128(static_cast<const __m128i*>(p));
+    }
+
+    static auto store(void* p, type v) noexcept -> void {
+        _mm_storeu_si128(static_cast<__m128i*>(p), v);
+    }
+
+    // One bit per byte
+    [[nodiscard]] static auto mask(type v) noexcept -> uint32_t {
+        return static_cast<uint32_t>(_mm_movemask_epi8(v));
+    }
+
+    [[nodiscard]] static auto bitwise_or(type a, type b) noexcept -> type {
+        return _mm_or_si128(a, b);
+    }
+
+    template<class T>
+    [[nodiscard]] static auto set1(const T value) noexcept -> type {
+        const auto u = std::bit_cast<simd_scan_uint<sizeof(T)>>(value);
+
+        if constexpr (sizeof(T) == 1) {
+            return _mm_set1_epi8(static_cast<char>(u));
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_set1_epi16(static_cast<short>(u));
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_set1_epi32(static_cast<int>(u));
+        } else {
+            return _mm_set1_epi64x(static_cast<long long>(u));
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto eq(type a, type b) noexcept -> type {
+        if constexpr (is_same_v<T, float>) {
+            return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+        } else if constexpr (is_same_v<T, double>) {
+            return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+        } else if constexpr (sizeof(T) == 1) {
+            return _mm_cmpeq_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpeq_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_cmpeq_epi32(a, b);
+        } else {
+            // SSE2 has no 64-bit equality, both 32-bit halves have to be equal
+            const __m128i e = _mm_cmpeq_epi32(a, b);
+            return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto sub(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1) {
+            return _mm_sub_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_sub_epi16(a, b);
+        } else if constexpr (sizeof(T) == 4) {
+            return _mm_sub_epi32(a, b);
+        } else {
+            return _mm_sub_epi64(a, b);
+        }
+    }
+
+    // a > b, SSE2 only has signed comparisons, so unsigned ones flip the sign bits first
+    template<class T>
+    [[nodiscard]] static auto gt(type a, type b) noexcept -> type {
+        if constexpr (!is_signed_v<T>) {
+            const type sign = set1(static_cast<T>(numeric_limits<make_signed_t<T>>::min()));
+            a = _mm_xor_si128(a, sign);
+            b = _mm_xor_si128(b, sign);
+        }
+
+        if constexpr (sizeof(T) == 1) {
+            return _mm_cmpgt_epi8(a, b);
+        } else if constexpr (sizeof(T) == 2) {
+            return _mm_cmpgt_epi16(a, b);
+        } else {
+            return _mm_cmpgt_epi32(a, b);
+        }
+    }
+
+    [[nodiscard]] static auto select(type m, type a, type b) noexcept -> type {
+        return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+    }
+
+    template<class T>
+    [[nodiscard]] static auto min(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1 && !is_signed_v<T>) {
+            return _mm_min_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2 && is_signed_v<T>) {
+            return _mm_min_epi16(a, b);
+        } else {
+            return select(gt<T>(a, b), b, a);
+        }
+    }
+
+    template<class T>
+    [[nodiscard]] static auto max(type a, type b) noexcept -> type {
+        if constexpr (sizeof(T) == 1 && !is_signed_v<T>) {
+            return _mm_max_epu8(a, b);
+        } else if constexpr (sizeof(T) == 2 && is_signed_v<T>) {
+            return _mm_max_epi16(a, b);
+        } else {
+            return select(gt<T>(a, b), a, b);
+        }
+    }
+
+};  // struct simd_scan_register
+
+#endif
+
+// The first element equal to value in [first, last), or last
+template<class T>
+[[nodiscard]] auto simd_find(const T* first, const T* last, const T value) noexcept -> const T* {
+    using reg = simd_scan_register;
+    constexpr size_t lanes = reg::bytes / sizeof(T);
+
+    if (static_cast<size_t>(last - first) < lanes) {
+        for (; first != last; ++first) {
+            if (*first == value) {
+                return first;
+            }
+        }
+        return last;
+    }
+
+    const reg::type v = reg::set1(value);
+    const auto match = [v](const T* p) noexcept {
+        return reg::mask(reg::template eq<T>(reg::load(p), v));
+    };
+
+    // Two registers per iteration, only their union is checked until there is a match
+    for (; static_cast<size_t>(last - first) >= lanes * 2; first += lanes * 2) {
+        const reg::type e0 = reg::template eq<T>(reg::load(first), v);
+        const reg::type e1 = reg::template eq<T>(reg::load(first + lanes), v);
+        if (reg::mask(reg::bitwise_or(e0, e1)) != 0) {
+            if (const uint32_t m = reg::mask(e0); m != 0) {
+                return first + std::countr_zero(m) / sizeof(T);
+            }
+            return first + lanes + std::countr_zero(reg::mask(e1)) / sizeof(T);
+        }
+    }
+
+    for (; static_cast<size_t>(last - first) >= lanes; first += lanes) {
+        if (const uint32_t m = match(first); m != 0) {
+            return first + std::countr_zero(m) / sizeof(T);
+        }
+    }
+
+    // The overlapped elements are known to be not equal
+    if (first != last) {
+        first = last - lanes;
+        if (const uint32_t m = match(first); m != 0) {
+            return first + std::countr_zero(m) / sizeof(T);
+        }
+    }
+    return last;
+}
+
+// The last element equal to value in [first, last), or last
+template<class T>
+[[nodiscard]] auto simd_find_last(const T* first, const T* last, const T value) noexcept -> const T* {
+    using reg = simd_scan_register;
+    constexpr size_t lanes = reg::bytes / sizeof(T);
+
+    if (static_cast<size_t>(last - first) < lanes) {
+        for (const T* it = last; it != first;) {
+            if (*--it == value) {
+                return it;
+            }
+        }
+        return last;
+    }
+
+    const reg::type v = reg::set1(value);
+    const auto match = [v](const T* p) noexcept {
+        return reg::mask(reg::template eq<T>(reg::load(p), v));
+    };
+
+    const T* it = last;
+    for (; static_cast<size_t>(it - first) >= lanes; it -= lanes) {
+        if (const uint32_t m = match(it - lanes); m != 0) {
+            return it - lanes + (std::bit_width(m) - 1) / sizeof(T);
+        }
+    }
+
+    if (it != first) {
+        if (const uint32_t m = match(first); m != 0) {
+            return first + (std::bit_width(m) - 1) / sizeof(T);
+        }
+    }
+    return last;
+}
+
+// Every lane counts its matches by subtracting the all-ones results of comparisons,
+// lanes narrower than 32 bits are added up before they can overflow.
+template<class T>
+[[nodiscard]] auto simd_count(const T* first, const T* last, const T value) noexcept -> size_t {
+    using reg = simd_scan_register;
+    using lane_type = simd_scan_uint<sizeof(T)>;
+    constexpr size_t lanes = reg::bytes / sizeof(T);
+    constexpr size_t max_batch = sizeof(T) >= 4 ? numeric_limits<size_t>::max()
+                                                : static_cast<size_t>(numeric_limits<lane_type>::max());
+
+    const reg::type v = reg::set1(value);
+    size_t res = 0;
+    while (static_cast<size_t>(last - first) >= lanes) {
+        const size_t blocks = static_cast<size_t>(last - first) / lanes;
+        const size_t batch = blocks < max_batch ? blocks : max_batch;
+
+        reg::type counts = reg::set1(lane_type{0});
+        for (size_t i = 0; i < batch; ++i, first += lanes) {
+            counts = reg::template sub<T>(counts, reg::template eq<T>(reg::load(first), v));
+        }
+
+        lane_type count_lanes[lanes];
+        reg::store(count_lanes, counts);
+        for (const lane_type c : count_lanes) {
+            res += static_cast<size_t>(c);
+        }
+    }
+
+    for (; first != last; ++first) {
+        res += (*first == value);
+    }
+    return res;
+}
+
+// The index of the first pair of elements whose bytes differ, or last1 - first1
+template<class T>
+[[nodiscard]] auto simd_mismatch(const T* first1, const T* last1, const T* first2) noexcept -> size_t {
+    using reg = simd_scan_register;
+
+    const auto* p1 = reinterpret_cast<const unsigned char*>(first1);
+    const auto* p2 = reinterpret_cast<const unsigned char*>(first2);
+    const size_t n = static_cast<size_t>(last1 - first1) * sizeof(T);
+
+    const auto differ = [p1, p2](const size_t i) noexcept {
+        return reg::mask(reg::template eq<unsigned char>(reg::load(p1 + i), reg::load(p2 + i))) ^ reg::full_mask;
+    };
+
+    if (n < reg::bytes) {
+        size_t i = 0;
+        while (i != n && p1[i] == p2[i]) {
+            ++i;
+        }
+        return i / sizeof(T);
+    }
+
+    size_t i = 0;
+    for (; n - i >= reg::bytes; i += reg::bytes) {
+        if (const uint32_t m = differ(i); m != 0) {
+            return (i + std::countr_zero(m)) / sizeof(T);
+        }
+    }
+
+    // The overlapped bytes are known to be equal
+    if (i != n) {
+        i = n - reg::bytes;
+        if (const uint32_t m = differ(i); m != 0) {
+            return (i + std::countr_zero(m)) / sizeof(T);
+        }
+    }
+    return n / sizeof(T);
+}
+
+// The minimum and the maximum values of [first, last), precondition: last - first >= lanes
+template<class T, bool Min, bool Max>
+[[nodiscard]] auto simd_min_max_value(const T* first, const T* last) noexcept -> pair<T, T> {
+    using reg = simd_scan_register;
+    constexpr size_t lanes = reg::bytes / sizeof(T);
+
+    CIEL_PRECONDITION(static_cast<size_t>(last - first) >= lanes);
+
+    // Min and max are idempotent, so the last partial register is loaded from last - lanes
+    reg::type lo = reg::load(last - lanes);
+    reg::type hi = lo;
+    for (; static_cast<size_t>(last - first) > lanes; first += lanes) {
+        const reg::type v = reg::load(first);
+        if constexpr (Min) {
+            lo = reg::template min<T>(lo, v);
+        }
+        if constexpr (Max) {
+            hi = reg::template max<T>(hi, v);
+        }
+    }
+
+    T lo_lanes[lanes];
+    T hi_lanes[lanes];
+    reg::store(lo_lanes, lo);
+    reg::store(hi_lanes, hi);
+
+    pair<T, T> res{lo_lanes[0], hi_lanes[0]};
+    for (size_t i = 1; i < lanes; ++i) {
+        res.first = lo_lanes[i] < res.first ? lo_lanes[i] : res.first;
+        res.second = res.second < hi_lanes[i] ? hi_lanes[i] : res.second;
+    }
+    return res;
+}
+
+template<class T>
+inline constexpr size_t simd_scan_lanes = simd_scan_register::bytes / sizeof(T);
+
+#endif // CIEL_HAS_SIMD_SCAN
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SIMD_SCAN_HPP_
\ No newline at end of file
@@ -2,24 +2,50 @@
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SORT_HPP_
 
 #include <bit>  // for std::bit_width
+#include <ciel/algorithm_impl/iter_swap.hpp>
+#include <ciel/algorithm_impl/make_heap.hpp>
 #include <ciel/algorithm_impl/move_backward.hpp>
-#include <ciel/algorithm_impl/partial_sort.hpp>
+#include <ciel/algorithm_impl/sort_heap.hpp>
+#include <ciel/algorithm_impl/sort_small.hpp>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
-// Introsort is consist of quicksort, heapsort and insertionsort.
-// We use bid_width to calculate log(N) (N is the range size), which is the ideal depth in quicksort,
-// if depth is beyond 2 * log(N), we switch to heapsort.
+// Pattern-defeating quicksort, see https://github.com/orlp/pdqsort
 //
-// When N <= Threshold, we switch to insertionsort, because insertionsort can get good performance
-// when dealing with nearly ordered range. We have already cut N-size range into many small ranges,
-// and these ranges are ordered to each other, we insertionsort first range,
-// and use unguarded_linear_insert on following ranges to get rid of bound checking.
+// It's an introsort which keeps quicksort's average case, but:
+// 1. When a partition didn't need any swap, the range is likely to be nearly sorted,
+//    we try partial_insertion_sort on both sides and give up as soon as it moves too many elements.
+//    So sorted and reversed-then-partitioned ranges cost O(N).
+// 2. When a partition is highly unbalanced, we swap some elements around to break the pattern,
+//    and fall back to heapsort after log(N) bad partitions, which keeps the worst case O(N log N).
+// 3. When the pivot equals to the element before the range (the pivot of the previous level),
+//    we put all the equal elements to the left and never touch them again,
+//    so ranges with many duplicates cost O(N * K), K is the number of distinct elements.
+// 4. When comparing arithmetic types with default comparators, we use BlockQuicksort's branchless partition.
+//
+// The parallel version forks both partitions to a thread_pool until they are no larger than ParallelSortGrain,
+// or the grain of the policy when it has one.
+//
+// When N < Threshold, we switch to sorting networks for arithmetic types with default comparators, see sort_small.
+// Otherwise we switch to insertionsort. Every range except the leftmost one has its pivot
+// right before it, which is not greater than any of its elements, so we use unguarded_linear_insert
+// on them to get rid of bound checking.
 
 namespace details {
 
-constexpr int Threshold = 16;
+constexpr int Threshold = 24;
+constexpr int NintherThreshold = 128;
+constexpr int PartialInsertionSortLimit = 8;
+constexpr int BlockSize = 64;
+constexpr int CachelineSize = 64;
+constexpr ptrdiff_t ParallelSortGrain = 1 << 14;
 
 template<class RandomIt, class Compare>
 constexpr auto unguarded_linear_insert(RandomIt last, Compare comp) -> void {
@@ -41,7 +67,7 @@ constexpr auto insertion_sort(RandomIt first, RandomIt last, Compare comp) -> vo
     for (RandomIt it = first + 1; it != last; ++it) {
         if (comp(*it, *first)) {
             typename iterator_traits<RandomIt>::value_type val = std::move(*it);
-            std::move_backward(first, it, it + 1);
+            ciel::move_backward(first, it, it + 1);
             *first = std::move(val);
         } else {
             unguarded_linear_insert(it, comp);
@@ -49,6 +75,7 @@ constexpr auto insertion_sort(RandomIt first, RandomIt last, Compare comp) -> vo
     }
 }
 
+// precondition: *(first - 1) is not greater than any element in [first, last)
 template<class RandomIt, class Compare>
 constexpr auto unguarded_insertion_sort(RandomIt first, RandomIt last, Compare comp) -> void {
     while (first != last) {
@@ -57,70 +84,438 @@ constexpr auto unguarded_insertion_sort(RandomIt first, RandomIt last, Compare c
     }
 }
 
+// Try to insertionsort [first, last), return false and give up when moving more than PartialInsertionSortLimit
+// elements, in that case the range is partly sorted.
 template<class RandomIt, class Compare>
-constexpr auto final_insertion_sort(RandomIt first, RandomIt last, Compare comp) -> void {
-    if (last - first > Threshold) {
-        insertion_sort(first, first + Threshold, comp);
-        unguarded_insertion_sort(first + Threshold, last, comp);
-    } else {
-        insertion_sort(first, last, comp);
+constexpr auto partial_insertion_sort(RandomIt first, RandomIt last, Compare comp) -> bool {
+    if (first == last) {
+        return true;
+    }
+    typename iterator_traits<RandomIt>::difference_type limit = 0;
+    for (RandomIt cur = first + 1; cur != last; ++cur) {
+        RandomIt sift = cur;
+        RandomIt sift_1 = cur - 1;
+
+        if (comp(*sift, *sift_1)) {
+            typename iterator_traits<RandomIt>::value_type val = std::move(*sift);
+            do {
+                *sift = std::move(*sift_1);
+                --sift;
+            } while (sift != first && comp(val, *--sift_1));
+            *sift = std::move(val);
+            limit += cur - sift;
+        }
+
+        if (limit > PartialInsertionSortLimit) {
+            return false;
+        }
     }
+    return true;
 }
 
 template<class RandomIt, class Compare>
-constexpr auto move_median_to_first(RandomIt first, RandomIt mid, RandomIt last, Compare comp) -> void {
-    if (comp(*first, *mid)) {
-        if (comp(*mid, *last)) {
-            ciel::iter_swap(first, mid);
-        } else if (comp(*first, *last)) {
-            ciel::iter_swap(first, last);
-        }
-    } else if (comp(*first, *last)) {
-        // return;
-    } else if (comp(*mid, *last)) {
-        ciel::iter_swap(first, last);
-    } else {
-        ciel::iter_swap(first, mid);
+constexpr auto sort2(RandomIt a, RandomIt b, Compare comp) -> void {
+    if (comp(*b, *a)) {
+        ciel::iter_swap(a, b);
     }
 }
 
 template<class RandomIt, class Compare>
-constexpr auto partition(RandomIt first, RandomIt last, RandomIt pivot, Compare comp) -> RandomIt {
-    while (true) {
-        while (comp(*first, *pivot)) {
-            ++first;
-        }
-        --last;
-        while (comp(*pivot, *last)) {
-            --last;
+constexpr auto sort3(RandomIt a, RandomIt b, RandomIt c, Compare comp) -> void {
+    sort2(a, b, comp);
+    sort2(b, c, comp);
+    sort2(a, b, comp);
+}
+
+// Swap the offsets found by block partition. When the numbers of both sides are different,
+// we use a cyclic permutation instead of swaps, which halves the moves.
+template<class RandomIt>
+constexpr auto swap_offsets(RandomIt first, RandomIt last, unsigned char* offsets_l, unsigned char* offsets_r,
+                            size_t num, bool use_swaps) -> void {
+    if (use_swaps) {
+        for (size_t i = 0; i < num; ++i) {
+            ciel::iter_swap(first + offsets_l[i], last - offsets_r[i]);
         }
-        if (first >= last) {
-            return first;
+    } else if (num > 0) {
+        RandomIt l = first + offsets_l[0];
+        RandomIt r = last - offsets_r[0];
+        typename iterator_traits<RandomIt>::value_type tmp(std::move(*l));
+        *l = std::move(*r);
+        for (size_t i = 1; i < num; ++i) {
+            l = first + offsets_l[i];
+            *r = std::move(*l);
+            r = last - offsets_r[i];
+            *l = std::move(*r);
         }
+        *r = std::move(tmp);
+    }
+}
+
+// Partition [first, last) around pivot *first, elements equal to the pivot go to the right.
+// return the position of pivot, and whether the range was already partitioned.
+// precondition: there is at least one element not less than pivot in (first, last),
+// and at least three elements in [first, last)
+template<class RandomIt, class Compare>
+constexpr auto partition_right(RandomIt first, RandomIt last, Compare comp) -> pair<RandomIt, bool> {
+    typename iterator_traits<RandomIt>::value_type pivot = std::move(*first);
+    RandomIt begin = first;
+
+    // Find the first element not less than pivot, which exists since median of 3 was used
+    while (comp(*++first, pivot));
+
+    // Find the last element less than pivot, guard it when there is no element less than pivot before first
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    // If no swap is needed, the range is already partitioned
+    const bool already_partitioned = first >= last;
+
+    // Both loops are unguarded now, since there are always elements to stop on both sides
+    while (first < last) {
+        ciel::iter_swap(first, last);
+        while (comp(*++first, pivot));
+        while (!comp(*--last, pivot));
+    }
+
+    RandomIt pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+
+    return {pivot_pos, already_partitioned};
+}
+
+// Same as partition_right, but instead of swapping each pair of elements, we scan a block on both sides,
+// record the offsets of elements to be swapped without branches, then swap them in batches.
+// See "BlockQuicksort: How Branch Mispredictions don't affect Quicksort" by Stefan Edelkamp and Armin Weiss.
+template<class RandomIt, class Compare>
+constexpr auto partition_right_branchless(RandomIt first, RandomIt last, Compare comp) -> pair<RandomIt, bool> {
+    typename iterator_traits<RandomIt>::value_type pivot = std::move(*first);
+    RandomIt begin = first;
+
+    while (comp(*++first, pivot));
+
+    if (first - 1 == begin) {
+        while (first < last && !comp(*--last, pivot));
+    } else {
+        while (!comp(*--last, pivot));
+    }
+
+    const bool already_partitioned = first >= last;
+
+    if (!already_partitioned) {
         ciel::iter_swap(first, last);
         ++first;
+
+        alignas(CachelineSize) unsigned char offsets_l_storage[BlockSize];
+        alignas(CachelineSize) unsigned char offsets_r_storage[BlockSize];
+        unsigned char* offsets_l = offsets_l_storage;
+        unsigned char* offsets_r = offsets_r_storage;
+
+        RandomIt offsets_l_base = first;
+        RandomIt offsets_r_base = last;
+        size_t num_l = 0;
+        size_t num_r = 0;
+        size_t start_l = 0;
+        size_t start_r = 0;
+
+        while (first < last) {
+            // Fill up offset blocks with elements that are on the wrong side.
+            // First we determine how much elements are considered for each offset block.
+            const size_t num_unknown = last - first;
+            const size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+            const size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+            // Fill the offset blocks.
+            if (left_split >= BlockSize) {
+                for (size_t i = 0; i < BlockSize;) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i++);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                    offsets_l[num_l] = static_cast<unsigned char>(i++);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                }
+            } else {
+                for (size_t i = 0; i < left_split;) {
+                    offsets_l[num_l] = static_cast<unsigned char>(i++);
+                    num_l += !comp(*first, pivot);
+                    ++first;
+                }
+            }
+
+            if (right_split >= BlockSize) {
+                for (size_t i = 0; i < BlockSize;) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += comp(*--last, pivot);
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += comp(*--last, pivot);
+                }
+            } else {
+                for (size_t i = 0; i < right_split;) {
+                    offsets_r[num_r] = static_cast<unsigned char>(++i);
+                    num_r += comp(*--last, pivot);
+                }
+            }
+
+            // Swap elements and update block sizes and first/last boundaries.
+            const size_t num = num_l < num_r ? num_l : num_r;
+            details::swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r,
+                                  num, num_l == num_r);
+            num_l -= num;
+            num_r -= num;
+            start_l += num;
+            start_r += num;
+
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // We have now fully identified [first, last)'s proper position. Swap the last elements.
+        if (num_l) {
+            offsets_l += start_l;
+            while (num_l--) {
+                ciel::iter_swap(offsets_l_base + offsets_l[num_l], --last);
+            }
+            first = last;
+        }
+
+        if (num_r) {
+            offsets_r += start_r;
+            while (num_r--) {
+                ciel::iter_swap(offsets_r_base - offsets_r[num_r], first);
+                ++first;
+            }
+            last = first;
+        }
     }
+
+    RandomIt pivot_pos = first - 1;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+
+    return {pivot_pos, already_partitioned};
 }
 
-// This range should have at least one element
+// Partition [first, last) around pivot *first, elements equal to the pivot go to the left.
+// Only called when the element before the range equals to pivot, so the left part are all equal elements
+// and need no further sorting.
 template<class RandomIt, class Compare>
-constexpr auto partition_pivot(RandomIt first, RandomIt last, Compare comp) -> RandomIt {
-    RandomIt mid = first + (last - first) / 2;
-    move_median_to_first(first, mid, last - 1, comp);
-    return partition(first + 1, last, first, comp);
+constexpr auto partition_left(RandomIt first, RandomIt last, Compare comp) -> RandomIt {
+    typename iterator_traits<RandomIt>::value_type pivot = std::move(*first);
+    RandomIt begin = first;
+    RandomIt end = last;
+
+    while (comp(pivot, *--last));
+
+    if (last + 1 == end) {
+        while (first < last && !comp(pivot, *++first));
+    } else {
+        while (!comp(pivot, *++first));
+    }
+
+    while (first < last) {
+        ciel::iter_swap(first, last);
+        while (comp(pivot, *--last));
+        while (!comp(pivot, *++first));
+    }
+
+    RandomIt pivot_pos = last;
+    *begin = std::move(*pivot_pos);
+    *pivot_pos = std::move(pivot);
+
+    return pivot_pos;
 }
 
+// Choose pivot as median of 3 or pseudomedian of 9 (Tukey's ninther), and move it to first
+// precondition: last - first >= Threshold
 template<class RandomIt, class Compare>
-constexpr auto introsort_loop(RandomIt first, RandomIt last, size_t depth_limit, Compare comp) -> void {
-    while (last - first > Threshold) {
-        if (depth_limit == 0) {
-            ciel::partial_sort(first, last, last, comp);
+constexpr auto choose_pivot(RandomIt first, RandomIt last, Compare comp) -> void {
+    const auto size = last - first;
+    const auto s2 = size / 2;
+    if (size > NintherThreshold) {
+        details::sort3(first, first + s2, last - 1, comp);
+        details::sort3(first + 1, first + (s2 - 1), last - 2, comp);
+        details::sort3(first + 2, first + (s2 + 1), last - 3, comp);
+        details::sort3(first + (s2 - 1), first + s2, first + (s2 + 1), comp);
+        ciel::iter_swap(first, first + s2);
+    } else {
+        details::sort3(first + s2, first, last - 1, comp);
+    }
+}
+
+template<bool Branchless, class RandomIt, class Compare>
+constexpr auto partition_right_dispatch(RandomIt first, RandomIt last, Compare comp) -> pair<RandomIt, bool> {
+    if constexpr (Branchless) {
+        return details::partition_right_branchless(first, last, comp);
+    } else {
+        return details::partition_right(first, last, comp);
+    }
+}
+
+// Shuffle some elements on both sides of a highly unbalanced partition to break patterns
+template<class RandomIt>
+constexpr auto break_patterns(RandomIt first, RandomIt pivot_pos, RandomIt last) -> void {
+    const auto l_size = pivot_pos - first;
+    const auto r_size = last - (pivot_pos + 1);
+
+    if (l_size >= Threshold) {
+        ciel::iter_swap(first, first + l_size / 4);
+        ciel::iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+        if (l_size > NintherThreshold) {
+            ciel::iter_swap(first + 1, first + (l_size / 4 + 1));
+            ciel::iter_swap(first + 2, first + (l_size / 4 + 2));
+            ciel::iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+            ciel::iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+        }
+    }
+
+    if (r_size >= Threshold) {
+        ciel::iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+        ciel::iter_swap(last - 1, last - r_size / 4);
+
+        if (r_size > NintherThreshold) {
+            ciel::iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+            ciel::iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+            ciel::iter_swap(last - 2, last - (1 + r_size / 4));
+            ciel::iter_swap(last - 3, last - (2 + r_size / 4));
+        }
+    }
+}
+
+template<bool Branchless, class RandomIt, class Compare>
+constexpr auto pdqsort_loop(RandomIt first, RandomIt last, Compare comp, int bad_allowed, bool leftmost = true) -> void {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    // Use a while loop for tail recursion elimination
+    while (true) {
+        const difference_type size = last - first;
+
+        if (size < Threshold) {
+            if constexpr (Branchless) {
+                details::sort_small_n(first, static_cast<size_t>(size), comp);
+            } else if (leftmost) {
+                details::insertion_sort(first, last, comp);
+            } else {
+                details::unguarded_insertion_sort(first, last, comp);
+            }
             return;
         }
-        --depth_limit;
-        RandomIt cut = partition_pivot(first, last, comp);
-        introsort_loop(cut + 1, last, depth_limit, comp);
-        last = cut;
+
+        details::choose_pivot(first, last, comp);
+
+        // If *(first - 1) is the end of the right partition of a previous partition, no element in [first, last)
+        // is less than it. So if our pivot equals to *(first - 1), we put the equal elements to the left partition,
+        // and don't need to recurse on it.
+        if (!leftmost && !comp(*(first - 1), *first)) {
+            first = details::partition_left(first, last, comp) + 1;
+            continue;
+        }
+
+        const pair<RandomIt, bool> part_result = details::partition_right_dispatch<Branchless>(first, last, comp);
+        const RandomIt pivot_pos = part_result.first;
+        const bool already_partitioned = part_result.second;
+
+        const difference_type l_size = pivot_pos - first;
+        const difference_type r_size = last - (pivot_pos + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            // Too many bad partitions, switch to heapsort to guarantee O(N log N)
+            if (--bad_allowed == 0) {
+                ciel::make_heap(first, last, comp);
+                ciel::sort_heap(first, last, comp);
+                return;
+            }
+            details::break_patterns(first, pivot_pos, last);
+
+        } else {
+            // Decently balanced and no swap happened, try to finish it with insertionsort
+            if (already_partitioned && details::partial_insertion_sort(first, pivot_pos, comp)
+                && details::partial_insertion_sort(pivot_pos + 1, last, comp)) {
+                return;
+            }
+        }
+
+        // Sort the left partition first using recursion and do tail recursion elimination for the right partition
+        details::pdqsort_loop<Branchless>(first, pivot_pos, comp, bad_allowed, leftmost);
+        first = pivot_pos + 1;
+        leftmost = false;
+    }
+}
+
+// Same as pdqsort_loop, but both partitions are sorted in parallel,
+// until they are small enough to be sorted sequentially
+template<bool Branchless, class RandomIt, class Compare>
+auto parallel_pdqsort_loop(thread_pool& pool, RandomIt first, RandomIt last, Compare comp,
+                           int bad_allowed, bool leftmost, const ptrdiff_t grain) -> void {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    while (true) {
+        const difference_type size = last - first;
+
+        if (size <= grain) {
+            details::pdqsort_loop<Branchless>(first, last, comp, bad_allowed, leftmost);
+            return;
+        }
+
+        details::choose_pivot(first, last, comp);
+
+        if (!leftmost && !comp(*(first - 1), *first)) {
+            first = details::partition_left(first, last, comp) + 1;
+            continue;
+        }
+
+        const pair<RandomIt, bool> part_result = details::partition_right_dispatch<Branchless>(first, last, comp);
+        const RandomIt pivot_pos = part_result.first;
+        const bool already_partitioned = part_result.second;
+
+        const difference_type l_size = pivot_pos - first;
+        const difference_type r_size = last - (pivot_pos + 1);
+        const bool highly_unbalanced = l_size < size / 8 || r_size < size / 8;
+
+        if (highly_unbalanced) {
+            if (--bad_allowed == 0) {
+                ciel::make_heap(first, last, comp);
+                ciel::sort_heap(first, last, comp);
+                return;
+            }
+            details::break_patterns(first, pivot_pos, last);
+
+        } else {
+            if (already_partitioned && details::partial_insertion_sort(first, pivot_pos, comp)
+                && details::partial_insertion_sort(pivot_pos + 1, last, comp)) {
+                return;
+            }
+        }
+
+        // Both partitions' pivots (*(first - 1)) are final and never written again, so it's safe to read them
+        details::parallel_invoke(pool,
+            [&] { details::parallel_pdqsort_loop<Branchless>(pool, first, pivot_pos, comp, bad_allowed, leftmost,
+                                                             grain); },
+            [&] { details::parallel_pdqsort_loop<Branchless>(pool, pivot_pos + 1, last, comp, bad_allowed, false,
+                                                             grain); });
+        return;
     }
 }
 
@@ -128,11 +523,12 @@ constexpr auto introsort_loop(RandomIt first, RandomIt last, size_t depth_limit,
 
 template<class RandomIt, class Compare>
 constexpr auto sort(RandomIt first, RandomIt last, Compare comp) -> void {
-    if (first == last) {
+    if (last - first < 2) {
         return;
     }
-    details::introsort_loop(first, last, 2 * std::bit_width(static_cast<size_t>(last - first)), comp);
-    details::final_insertion_sort(first, last, comp);
+    constexpr bool branchless = details::is_branchless_comparable<typename iterator_traits<RandomIt>::value_type,
+                                                                  Compare>::value;
+    details::pdqsort_loop<branchless>(first, last, comp, std::bit_width(static_cast<size_t>(last - first)));
 }
 
 template<class RandomIt>
@@ -140,6 +536,30 @@ constexpr auto sort(RandomIt first, RandomIt last) -> void {
     ciel::sort(first, last, less<>());
 }
 
+template<class ExecutionPolicy, class RandomIt, class Compare>
+    requires details::execution_policy<ExecutionPolicy>
+auto sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp) -> void {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy>) {
+        if (last - first < 2) {
+            return;
+        }
+        constexpr bool branchless = details::is_branchless_comparable<typename iterator_traits<RandomIt>::value_type,
+                                                                      Compare>::value;
+        const ptrdiff_t grain = policy.grain() != 0 ? static_cast<ptrdiff_t>(policy.grain())
+                                                       : details::ParallelSortGrain;
+        details::parallel_pdqsort_loop<branchless>(details::policy_pool(policy), first, last, comp,
+                                                   std::bit_width(static_cast<size_t>(last - first)), true, grain);
+    } else {
+        ciel::sort(first, last, comp);
+    }
+}
+
+template<class ExecutionPolicy, class RandomIt>
+    requires details::execution_policy<ExecutionPolicy>
+auto sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last) -> void {
+    ciel::sort(std::forward<ExecutionPolicy>(policy), first, last, less<>());
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SORT_HPP_
\ No newline at end of file
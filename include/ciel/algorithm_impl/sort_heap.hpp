@@ -3,29 +3,30 @@
 
 #include <ciel/algorithm_impl/pop_heap.hpp>
 #include <ciel/config.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
 namespace details {
 
-template<class RandomIt, class Compare>
+template<size_t D, class RandomIt, class Compare>
 constexpr auto sort_heap_helper(RandomIt first, RandomIt last, Compare&& comp) -> void {
     while (last != first) {
-        ciel::pop_heap(first, last, comp);
+        ciel::pop_heap<D>(first, last, comp);
         --last;
     }
 }
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
+template<size_t D = 2, class RandomIt, class Compare>
 constexpr auto sort_heap(RandomIt first, RandomIt last, Compare comp) -> void {
-    details::sort_heap_helper(first, last, comp);
+    details::sort_heap_helper<D>(first, last, comp);
 }
 
-template<class RandomIt>
+template<size_t D = 2, class RandomIt>
 constexpr auto sort_heap(RandomIt first, RandomIt last) -> void {
-    details::sort_heap_helper(first, last, less<>());
+    details::sort_heap_helper<D>(first, last, less<>());
 }
 
 NAMESPACE_CIEL_END
@@ -0,0 +1,396 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SORT_SMALL_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SORT_SMALL_HPP_
+
+#include <bit>  // for std::bit_cast
+#include <ciel/algorithm_impl/iter_swap.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/greater.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/contiguous_iterator.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/limits.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/type_traits_impl/conditional.hpp>
+#include <ciel/type_traits_impl/is_arithmetic.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <ciel/type_traits_impl/is_floating_point.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <ciel/type_traits_impl/is_signed.hpp>
+#include <ciel/utility_impl/integer_sequence.hpp>
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+NAMESPACE_CIEL_BEGIN
+
+// Sorting networks for small ranges of fixed size.
+//
+// A sorting network is a fixed sequence of compare-exchanges, so it has no data dependent branches.
+// We use Batcher's odd-even mergesort network of the next power of two, with comparators touching the missing
+// inputs dropped. It's optimal up to N = 8, and only a few comparators larger than the best known ones up to N = 32.
+//
+// For arithmetic types with default comparators, every compare-exchange is a branchless min and max.
+// When AVX2 is available, up to 16 32-bit keys are sorted by bitonic networks in one or two vector registers,
+// they are mapped to signed integers of the same order first, so that one kernel serves all of them.
+// There is no 64-bit kernel, AVX2 has no 64-bit min and max, and the compiler vectorized scalar networks win.
+//
+// ciel::sort uses them on ranges shorter than its Threshold, the ranges are padded with the greatest value
+// to 4, 8, 16 or 32 elements, so that only a few networks are instantiated.
+
+namespace details {
+
+constexpr size_t SortSmallMax = 32;
+
+template<class T, class Compare>
+struct is_branchless_comparable : bool_constant<is_arithmetic_v<T>
+    && (is_same_v<Compare, less<>> || is_same_v<Compare, less<T>>
+        || is_same_v<Compare, greater<>> || is_same_v<Compare, greater<T>>)> {};
+
+template<class T, class Compare>
+inline constexpr bool is_descending_comparator_v = is_same_v<Compare, greater<>> || is_same_v<Compare, greater<T>>;
+
+struct network_comparator {
+    unsigned char first;
+    unsigned char second;
+};
+
+// Calls f(a, b) on every comparator in order
+template<class F>
+constexpr auto for_each_batcher_comparator(const size_t n, F f) noexcept -> void {
+    size_t width = 1;
+    while (width < n) {
+        width <<= 1;
+    }
+
+    for (size_t p = 1; p < width; p <<= 1) {
+        for (size_t k = p; k > 0; k >>= 1) {
+            for (size_t j = k % p; j + k < width; j += 2 * k) {
+                for (size_t i = 0; i < k && i + j + k < width; ++i) {
+                    const size_t a = i + j;
+                    const size_t b = a + k;
+
+                    // Inputs not less than n are treated as greater than everything, they never move
+                    if (a / (p * 2) == b / (p * 2) && b < n) {
+                        f(a, b);
+                    }
+                }
+            }
+        }
+    }
+}
+
+[[nodiscard]] constexpr auto batcher_network_size(const size_t n) noexcept -> size_t {
+    size_t count = 0;
+    details::for_each_batcher_comparator(n, [&count](size_t, size_t) {
+        ++count;
+    });
+    return count;
+}
+
+template<size_t N>
+struct sorting_network {
+    static constexpr size_t size = details::batcher_network_size(N);
+
+    network_comparator comparators[size == 0 ? 1 : size]{};
+
+    constexpr sorting_network() noexcept {
+        size_t i = 0;
+        details::for_each_batcher_comparator(N, [this, &i](size_t a, size_t b) {
+            comparators[i++] = {static_cast<unsigned char>(a), static_cast<unsigned char>(b)};
+        });
+    }
+};
+
+template<size_t N>
+inline constexpr sorting_network<N> sorting_network_v{};
+
+template<class RandomIt, class Compare>
+constexpr auto compare_exchange(RandomIt a, RandomIt b, Compare& comp) -> void {
+    using value_type = typename iterator_traits<RandomIt>::value_type;
+
+    if constexpr (is_branchless_comparable<value_type, Compare>::value && is_floating_point_v<value_type>
+                  && (sizeof(value_type) == sizeof(uint32_t) || sizeof(value_type) == sizeof(uint64_t))) {
+        // Compilers tend to branch on floating point comparisons, so select by masks on bits.
+        // Note that min and max instructions can't be used, they don't tell -0.0 from 0.0
+        using U = conditional_t<sizeof(value_type) == sizeof(uint32_t), uint32_t, uint64_t>;
+        const U x = std::bit_cast<U>(*a);
+        const U y = std::bit_cast<U>(*b);
+        const U mask = U(0) - static_cast<U>(comp(*b, *a));
+        const U diff = (x ^ y) & mask;
+        *a = std::bit_cast<value_type>(static_cast<U>(x ^ diff));
+        *b = std::bit_cast<value_type>(static_cast<U>(y ^ diff));
+
+    } else if constexpr (is_branchless_comparable<value_type, Compare>::value) {
+        const value_type x = *a;
+        const value_type y = *b;
+        *a = comp(y, x) ? y : x;
+        *b = comp(y, x) ? x : y;
+
+    } else {
+        if (comp(*b, *a)) {
+            ciel::iter_swap(a, b);
+        }
+    }
+}
+
+template<size_t N, class RandomIt, class Compare>
+constexpr auto network_sort(RandomIt first, Compare& comp) -> void {
+    constexpr const sorting_network<N>& network = sorting_network_v<N>;
+
+    [&]<size_t... I>(index_sequence<I...>) {
+        (details::compare_exchange(first + network.comparators[I].first, first + network.comparators[I].second, comp),
+         ...);
+    }(make_index_sequence<sorting_network<N>::size>());
+}
+
+// The value which is not less than anything, in terms of Compare
+template<class T, class Compare>
+[[nodiscard]] constexpr auto sort_small_sentinel() noexcept -> T {
+    if constexpr (is_floating_point_v<T>) {
+        return is_descending_comparator_v<T, Compare> ? static_cast<T>(-__builtin_inf())
+                                                      : static_cast<T>(__builtin_inf());
+    } else {
+        return is_descending_comparator_v<T, Compare> ? numeric_limits<T>::min() : numeric_limits<T>::max();
+    }
+}
+
+// Pads [first, first + n) to Size elements with the sentinel, precondition: n <= Size
+template<size_t Size, class RandomIt, class Compare>
+constexpr auto padded_network_sort(RandomIt first, const size_t n, Compare& comp) -> void {
+    using value_type = typename iterator_traits<RandomIt>::value_type;
+
+    value_type buffer[Size];
+    for (size_t i = 0; i < n; ++i) {
+        buffer[i] = first[i];
+    }
+    for (size_t i = n; i < Size; ++i) {
+        buffer[i] = details::sort_small_sentinel<value_type, Compare>();
+    }
+
+    details::network_sort<Size>(buffer + 0, comp);
+
+    for (size_t i = 0; i < n; ++i) {
+        first[i] = buffer[i];
+    }
+}
+
+#ifdef __AVX2__
+
+struct avx2_lanes32 {
+    static constexpr size_t lanes = 8;
+
+    [[nodiscard]] static auto min(__m256i a, __m256i b) noexcept -> __m256i {
+        return _mm256_min_epi32(a, b);
+    }
+
+    [[nodiscard]] static auto max(__m256i a, __m256i b) noexcept -> __m256i {
+        return _mm256_max_epi32(a, b);
+    }
+
+    // Every lane is compared with the lane in perm, lanes in HiMask take the greater one
+    template<int HiMask>
+    [[nodiscard]] static auto layer(__m256i v, __m256i perm) noexcept -> __m256i {
+        const __m256i p = _mm256_permutevar8x32_epi32(v, perm);
+        return _mm256_blend_epi32(min(v, p), max(v, p), HiMask);
+    }
+
+    [[nodiscard]] static auto reverse(__m256i v) noexcept -> __m256i {
+        return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+    }
+
+    // The optimal network of 19 comparators in 6 layers
+    [[nodiscard]] static auto sort(__m256i v) noexcept -> __m256i {
+        v = layer<0b11001100>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));   // (0,2) (1,3) (4,6) (5,7)
+        v = layer<0b11110000>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));   // (0,4) (1,5) (2,6) (3,7)
+        v = layer<0b10101010>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));   // (0,1) (2,3) (4,5) (6,7)
+        v = layer<0b00110000>(v, _mm256_setr_epi32(0, 1, 4, 5, 2, 3, 6, 7));   // (2,4) (3,5)
+        v = layer<0b01010000>(v, _mm256_setr_epi32(0, 4, 2, 6, 1, 5, 3, 7));   // (1,4) (3,6)
+        v = layer<0b01010100>(v, _mm256_setr_epi32(0, 2, 1, 4, 3, 6, 5, 7));   // (1,2) (3,4) (5,6)
+        return v;
+    }
+
+    // Sorts a bitonic sequence by half-cleaners
+    [[nodiscard]] static auto merge(__m256i v) noexcept -> __m256i {
+        v = layer<0b11110000>(v, _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3));
+        v = layer<0b11001100>(v, _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5));
+        v = layer<0b10101010>(v, _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6));
+        return v;
+    }
+
+    // Maps keys to signed integers of the same order, it's an involution
+    template<class T>
+    [[nodiscard]] static auto map_key(__m256i v) noexcept -> __m256i {
+        if constexpr (is_floating_point_v<T>) {
+            // Flip all the bits but the sign of negative numbers
+            return _mm256_xor_si256(v, _mm256_and_si256(_mm256_srai_epi32(v, 31), _mm256_set1_epi32(INT32_MAX)));
+
+        } else if constexpr (is_signed_v<T>) {
+            return v;
+
+        } else {
+            return _mm256_xor_si256(v, _mm256_set1_epi32(INT32_MIN));
+        }
+    }
+
+    [[nodiscard]] static auto greatest() noexcept -> __m256i {
+        return _mm256_set1_epi32(INT32_MAX);
+    }
+
+    // Lanes whose indices starting from first are less than n
+    [[nodiscard]] static auto valid_mask(size_t first, size_t n) noexcept -> __m256i {
+        const __m256i index = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int32_t>(first)),
+                                               _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32(static_cast<int32_t>(n)), index);
+    }
+
+    // Only lanes in mask are accessed
+    template<class T>
+    [[nodiscard]] static auto load(const T* p, __m256i mask) noexcept -> __m256i {
+        return _mm256_maskload_epi32(reinterpret_cast<const int*>(p), mask);
+    }
+
+    template<class T>
+    static auto store(T* p, __m256i mask, __m256i v) noexcept -> void {
+        _mm256_maskstore_epi32(reinterpret_cast<int*>(p), mask, v);
+    }
+
+};  // struct avx2_lanes32
+
+// Sorts R registers as a whole, R is a power of two
+template<size_t R>
+auto bitonic_sort(__m256i* v) noexcept -> void {
+    using Lanes = avx2_lanes32;
+
+    for (size_t i = 0; i < R; ++i) {
+        v[i] = Lanes::sort(v[i]);
+    }
+
+    // Merge every two adjacent sorted runs of width registers
+    for (size_t width = 1; width < R; width *= 2) {
+        for (size_t base = 0; base < R; base += width * 2) {
+            __m256i* lo = v + base;
+            __m256i* hi = lo + width;
+
+            // Compare the k-th element with the (2 * width * lanes - 1 - k)-th element,
+            // then both halves are bitonic and no element of the lower half is greater than the upper half
+            for (size_t i = 0; i < width; ++i) {
+                const __m256i a = lo[i];
+                const __m256i b = Lanes::reverse(hi[width - 1 - i]);
+                lo[i] = Lanes::min(a, b);
+                hi[width - 1 - i] = Lanes::reverse(Lanes::max(a, b));
+            }
+
+            // Half-cleaners across registers, then inside registers
+            for (size_t d = width / 2; d > 0; d /= 2) {
+                for (size_t r = 0; r < width * 2; r += d * 2) {
+                    for (size_t i = r; i < r + d; ++i) {
+                        const __m256i a = lo[i];
+                        const __m256i b = lo[i + d];
+                        lo[i] = Lanes::min(a, b);
+                        lo[i + d] = Lanes::max(a, b);
+                    }
+                }
+            }
+            for (size_t i = 0; i < width * 2; ++i) {
+                lo[i] = Lanes::merge(lo[i]);
+            }
+        }
+    }
+}
+
+// Beyond two registers, scalar networks are faster
+constexpr size_t SimdSortSmallMax = 16;
+
+template<class RandomIt, class Compare>
+inline constexpr bool is_simd_sortable_v = contiguous_iterator<RandomIt>
+    && is_branchless_comparable<typename iterator_traits<RandomIt>::value_type, Compare>::value
+    && sizeof(typename iterator_traits<RandomIt>::value_type) == sizeof(uint32_t);
+
+// Sorts [first, first + n) in R registers padded with the greatest key, precondition: n <= R * lanes
+template<size_t R, class T, class Compare>
+auto simd_sort_small(T* first, const size_t n, Compare&) noexcept -> void {
+    using lanes = avx2_lanes32;
+
+    // Descending comparators sort the complements of keys
+    const __m256i flip = is_descending_comparator_v<T, Compare> ? _mm256_set1_epi32(-1) : _mm256_setzero_si256();
+
+    __m256i v[R];
+    __m256i valid[R];
+    for (size_t r = 0; r < R; ++r) {
+        valid[r] = lanes::valid_mask(r * lanes::lanes, n);
+        const __m256i key = _mm256_xor_si256(lanes::template map_key<T>(lanes::load(first + r * lanes::lanes, valid[r])),
+                                             flip);
+        v[r] = _mm256_blendv_epi8(lanes::greatest(), key, valid[r]);
+    }
+
+    details::bitonic_sort<R>(v);
+
+    for (size_t r = 0; r < R; ++r) {
+        lanes::store(first + r * lanes::lanes, valid[r], lanes::template map_key<T>(_mm256_xor_si256(v[r], flip)));
+    }
+}
+
+#endif // __AVX2__
+
+// Sorts [first, first + n), precondition: n <= SortSmallMax and value_type is branchless comparable
+template<class RandomIt, class Compare>
+constexpr auto sort_small_n(RandomIt first, const size_t n, Compare& comp) -> void {
+    if (n < 2) {
+        return;
+    }
+
+#ifdef __AVX2__
+    if constexpr (is_simd_sortable_v<RandomIt, Compare>) {
+        if (!is_constant_evaluated() && n <= SimdSortSmallMax) {
+            if (n <= avx2_lanes32::lanes) {
+                details::simd_sort_small<1>(ciel::to_address(first), n, comp);
+            } else {
+                details::simd_sort_small<2>(ciel::to_address(first), n, comp);
+            }
+            return;
+        }
+    }
+#endif
+
+    if (n <= 4) {
+        details::padded_network_sort<4>(first, n, comp);
+    } else if (n <= 8) {
+        details::padded_network_sort<8>(first, n, comp);
+    } else if (n <= 16) {
+        details::padded_network_sort<16>(first, n, comp);
+    } else {
+        details::padded_network_sort<32>(first, n, comp);
+    }
+}
+
+}   // namespace details
+
+// Sorts [first, first + N)
+template<size_t N, class RandomIt, class Compare>
+    requires (N <= details::SortSmallMax)
+constexpr auto sort_small(RandomIt first, Compare comp) -> void {
+    if constexpr (N >= 2) {
+#ifdef __AVX2__
+        if constexpr (details::is_simd_sortable_v<RandomIt, Compare> && N <= details::SimdSortSmallMax) {
+            if (!is_constant_evaluated()) {
+                details::simd_sort_small<(N <= details::avx2_lanes32::lanes ? 1 : 2)>(ciel::to_address(first), N, comp);
+                return;
+            }
+        }
+#endif
+        details::network_sort<N>(first, comp);
+    }
+}
+
+template<size_t N, class RandomIt>
+    requires (N <= details::SortSmallMax)
+constexpr auto sort_small(RandomIt first) -> void {
+    ciel::sort_small<N>(first, less<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_SORT_SMALL_HPP_
\ No newline at end of file
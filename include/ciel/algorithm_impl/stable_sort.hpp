@@ -1,29 +1,42 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_STABLE_SORT_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_STABLE_SORT_HPP_
 
+#include <ciel/algorithm_impl/lower_bound.hpp>
+#include <ciel/algorithm_impl/max.hpp>
 #include <ciel/algorithm_impl/min.hpp>
 #include <ciel/algorithm_impl/move.hpp>
 #include <ciel/algorithm_impl/move_backward.hpp>
 #include <ciel/algorithm_impl/reverse.hpp>
 #include <ciel/algorithm_impl/upper_bound.hpp>
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
 #include <ciel/iterator_impl/next.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/memory_impl/destroy.hpp>
+#include <ciel/memory_impl/uninitialized_move.hpp>
 #include <ciel/vector.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 // https://android.googlesource.com/platform/libcore/+/gingerbread/luni/src/main/java/java/util/TimSort.java
+//
+// Merges work in the space of the two adjacent runs, only the shorter run is moved to a buffer.
+// When one run keeps winning for min_gallop times in a row, the merge switches to galloping mode, which finds
+// how many elements win in a row by exponential search. min_gallop is adaptive: it decreases while galloping pays off
+// and increases when galloping mode is left, so that random data doesn't pay for it.
+// The buffer can be provided by the caller to be reused across calls.
+//
+// The parallel version is a merge sort: the range is cut in halves recursively, and the pieces no larger than
+// ParallelStableSortGrain are TimSorted in parallel. Every merge is parallelized too: we pick the middle element of
+// the longer run, binary search its position in the shorter run, and merge both sides in parallel.
+// Results ping-pong between the range and a buffer of N elements, so every level moves each element once.
 
 namespace details {
 
 constexpr int MinMerge = 32;
 
-template<class RandomIt>
-struct run {
-    RandomIt first_;
-    typename iterator_traits<RandomIt>::difference_type len_;
-};
-
 // Find an increasing or decreasing range as long as possible (reverse it if it's decreasing)
 // return the range size
 // precondition: not empty range
@@ -71,120 +84,425 @@ template<class Size>
     return n + r;
 }
 
-// TODO: The following ranges are always adjacent, which makes last1 === first2
+// Returns k that [first, first + k) < key <= [first + k, first + len), that is, the leftmost position to insert key.
+// It gallops from hint: checks hint +- 1, 3, 7, 15... until key is bracketed, then binary searches in the bracket,
+// so it costs O(log(distance)) when key's position is close to hint.
+// precondition: 0 <= hint < len
+template<class RandomIt, class T, class Compare>
+[[nodiscard]] constexpr auto gallop_left(const T& key, RandomIt first,
+                                         typename iterator_traits<RandomIt>::difference_type len,
+                                         typename iterator_traits<RandomIt>::difference_type hint, Compare& comp)
+    -> typename iterator_traits<RandomIt>::difference_type {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    difference_type last_ofs = 0;
+    difference_type ofs = 1;
+
+    if (comp(first[hint], key)) {
+        // Gallop right until first[hint + last_ofs] < key <= first[hint + ofs]
+        const difference_type max_ofs = len - hint;
+        while (ofs < max_ofs && comp(first[hint + ofs], key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = ciel::min(ofs, max_ofs);
+        last_ofs += hint;
+        ofs += hint;
 
-template<class RandomIt, class Compare>
-constexpr auto gallop_left(RandomIt first1, RandomIt last1, RandomIt first2, Compare comp) -> RandomIt {
-    while (first1 != last1) {
-        if (!comp(*first2, *first1)) {
-            ++first1;
+    } else {
+        // Gallop left until first[hint - ofs] < key <= first[hint - last_ofs]
+        const difference_type max_ofs = hint + 1;
+        while (ofs < max_ofs && !comp(first[hint - ofs], key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = ciel::min(ofs, max_ofs);
+        const difference_type tmp = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - tmp;
+    }
+
+    // Now first[last_ofs] < key <= first[ofs], binary search in (last_ofs, ofs]
+    ++last_ofs;
+    while (last_ofs < ofs) {
+        const difference_type mid = last_ofs + (ofs - last_ofs) / 2;
+        if (comp(first[mid], key)) {
+            last_ofs = mid + 1;
         } else {
-            break;
+            ofs = mid;
         }
     }
-    return first1;
+    return ofs;
 }
-template<class RandomIt, class Compare>
-constexpr auto gallop_right(RandomIt last1, RandomIt first2, RandomIt last2, Compare comp) -> RandomIt {
-    --last1;
-    while (first2 != last2) {
-        if (!comp(*(last2 - 1), *last1)) {
-            --last2;
+
+// Returns k that [first, first + k) <= key < [first + k, first + len), that is, the rightmost position to insert key.
+// precondition: 0 <= hint < len
+template<class RandomIt, class T, class Compare>
+[[nodiscard]] constexpr auto gallop_right(const T& key, RandomIt first,
+                                          typename iterator_traits<RandomIt>::difference_type len,
+                                          typename iterator_traits<RandomIt>::difference_type hint, Compare& comp)
+    -> typename iterator_traits<RandomIt>::difference_type {
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    difference_type last_ofs = 0;
+    difference_type ofs = 1;
+
+    if (comp(key, first[hint])) {
+        // Gallop left until first[hint - ofs] <= key < first[hint - last_ofs]
+        const difference_type max_ofs = hint + 1;
+        while (ofs < max_ofs && comp(key, first[hint - ofs])) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = ciel::min(ofs, max_ofs);
+        const difference_type tmp = last_ofs;
+        last_ofs = hint - ofs;
+        ofs = hint - tmp;
+
+    } else {
+        // Gallop right until first[hint + last_ofs] <= key < first[hint + ofs]
+        const difference_type max_ofs = len - hint;
+        while (ofs < max_ofs && !comp(key, first[hint + ofs])) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+        ofs = ciel::min(ofs, max_ofs);
+        last_ofs += hint;
+        ofs += hint;
+    }
+
+    // Now first[last_ofs] <= key < first[ofs], binary search in (last_ofs, ofs]
+    ++last_ofs;
+    while (last_ofs < ofs) {
+        const difference_type mid = last_ofs + (ofs - last_ofs) / 2;
+        if (comp(key, first[mid])) {
+            ofs = mid;
         } else {
-            break;
+            last_ofs = mid + 1;
         }
     }
-    return last2;
+    return ofs;
 }
 
-// precondition: left half is shorter
-template<class RandomIt, class Compare>
-constexpr auto merge_low(RandomIt first1, RandomIt last1, RandomIt first2, RandomIt last2, Compare comp) -> void {
-    using value_type = typename iterator_traits<RandomIt>::value_type;
-    // store left half elements to tmp
-    vector<value_type> tmp;
-    tmp.reserve(last1 - first1);
-    auto it = first1;
-    while (it != last1) {
-        tmp.push_back(std::move(*it));
-        ++it;
-    }
-
-    auto b = tmp.begin();
-    for (; b != tmp.end(); ++first1) {
-        if (first2 == last2) {
-            std::move(b, tmp.end(), first1);
+constexpr int MinGallop = 7;
+
+// Run lengths on the stack grow faster than Fibonacci numbers, and F(93) > 2^64
+constexpr size_t MaxPendingRuns = 96;
+
+// Runs are always adjacent, i.e. the second run of every merge starts at the end of the first one.
+// So a merge moves only the shorter run to the buffer, and merges back into the space of both runs.
+template<class RandomIt, class Compare, class Buffer>
+class timsort {
+private:
+    using difference_type = typename iterator_traits<RandomIt>::difference_type;
+
+    struct run {
+        difference_type base_;
+        difference_type len_;
+    };
+
+    RandomIt first_;
+    difference_type len_;
+    Compare& comp_;
+    Buffer& buffer_;
+    run pending_[MaxPendingRuns];
+    size_t pending_size_{0};
+    int min_gallop_{MinGallop};
+
+    // Moves [src, src + n) to the buffer. Its capacity grows in powers of two up to len_ / 2,
+    // so that merges of increasing sizes don't reallocate every time.
+    constexpr auto move_to_buffer(RandomIt src, const difference_type n) -> void {
+        if (static_cast<difference_type>(buffer_.capacity()) < n) {
+            difference_type new_cap = 1;
+            while (new_cap < n) {
+                new_cap <<= 1;
+            }
+            buffer_.clear();
+            buffer_.reserve(static_cast<size_t>(ciel::max(n, ciel::min(new_cap, len_ / 2))));
+        }
+
+        buffer_.clear();
+        for (difference_type i = 0; i < n; ++i) {
+            buffer_.emplace_back(std::move(src[i]));
+        }
+    }
+
+    // precondition: len1 <= len2, first element of run2 is less than the first one of run1,
+    // and the last element of run1 is greater than the last one of run2
+    constexpr auto merge_low(RandomIt first1, difference_type len1, RandomIt first2, difference_type len2) -> void {
+        move_to_buffer(first1, len1);
+        auto cursor1 = buffer_.begin();
+        RandomIt cursor2 = first2;
+        RandomIt dest = first1;
+
+        *dest++ = std::move(*cursor2++);
+        if (--len2 == 0) {
+            ciel::move(cursor1, cursor1 + len1, dest);
             return;
         }
-        if (comp(*first2, *b)) {
-            *first1 = std::move(*first2);
-            ++first2;
+        if (len1 == 1) {
+            dest = ciel::move(cursor2, cursor2 + len2, dest);
+            *dest = std::move(*cursor1);
+            return;
+        }
+
+        int min_gallop = min_gallop_;
+        while (true) {
+            difference_type count1 = 0;     // times in a row that run1 won
+            difference_type count2 = 0;     // times in a row that run2 won
+
+            // One pair at a time until one run starts winning consistently
+            do {
+                if (comp_(*cursor2, *cursor1)) {
+                    *dest++ = std::move(*cursor2++);
+                    ++count2;
+                    count1 = 0;
+                    if (--len2 == 0) {
+                        break;
+                    }
+
+                } else {
+                    *dest++ = std::move(*cursor1++);
+                    ++count1;
+                    count2 = 0;
+                    if (--len1 == 1) {
+                        break;
+                    }
+                }
+            } while ((count1 | count2) < min_gallop);
+            if (len2 == 0 || len1 == 1) {
+                break;
+            }
+
+            // Galloping mode, until neither run wins consistently any more
+            do {
+                count1 = details::gallop_right(*cursor2, cursor1, len1, 0, comp_);
+                if (count1 != 0) {
+                    dest = ciel::move(cursor1, cursor1 + count1, dest);
+                    cursor1 += count1;
+                    len1 -= count1;
+                    if (len1 <= 1) {
+                        break;
+                    }
+                }
+                *dest++ = std::move(*cursor2++);
+                if (--len2 == 0) {
+                    break;
+                }
+
+                count2 = details::gallop_left(*cursor1, cursor2, len2, 0, comp_);
+                if (count2 != 0) {
+                    dest = ciel::move(cursor2, cursor2 + count2, dest);
+                    cursor2 += count2;
+                    len2 -= count2;
+                    if (len2 == 0) {
+                        break;
+                    }
+                }
+                *dest++ = std::move(*cursor1++);
+                if (--len1 == 1) {
+                    break;
+                }
+
+                --min_gallop;
+            } while (count1 >= MinGallop || count2 >= MinGallop);
+            if (len2 == 0 || len1 <= 1) {
+                break;
+            }
+
+            // Penalize leaving galloping mode
+            min_gallop = ciel::max(min_gallop, 0) + 2;
+        }
+
+        min_gallop_ = ciel::max(min_gallop, 1);
+
+        if (len1 == 1) {
+            dest = ciel::move(cursor2, cursor2 + len2, dest);
+            *dest = std::move(*cursor1);
+
         } else {
-            *first1 = std::move(*b);
-            ++b;
+            // len1 == 0 only happens when comp is not a strict weak ordering
+            ciel::move(cursor1, cursor1 + len1, dest);
         }
     }
-    std::move(first2, last2, first1);
-}
 
-// precondition: right half is shorter
-template<class RandomIt, class Compare>
-constexpr auto merge_high(RandomIt first1, RandomIt last1, RandomIt first2, RandomIt last2, Compare comp) -> void {
-    using value_type = typename iterator_traits<RandomIt>::value_type;
-    // store right half elements to tmp
-    vector<value_type> tmp;
-    tmp.reserve(last2 - first2);
-    auto it = first2;
-    while (it != last2) {
-        tmp.push_back(std::move(*it));
-        ++it;
-    }
-
-    auto e = tmp.end();
-    while (e != tmp.begin()) {
-        if (first1 == last1) {
-            std::move_backward(tmp.begin(), e, last2);
+    // Mirror of merge_low from the back, cursors point to one past the last remaining elements.
+    // precondition: len1 >= len2, first element of run2 is less than the first one of run1,
+    // and the last element of run1 is greater than the last one of run2
+    constexpr auto merge_high(RandomIt first1, difference_type len1, RandomIt first2, difference_type len2) -> void {
+        move_to_buffer(first2, len2);
+        auto cursor2 = buffer_.end();
+        RandomIt cursor1 = first1 + len1;
+        RandomIt dest = first2 + len2;
+
+        *--dest = std::move(*--cursor1);
+        if (--len1 == 0) {
+            ciel::move_backward(cursor2 - len2, cursor2, dest);
+            return;
+        }
+        if (len2 == 1) {
+            dest = ciel::move_backward(cursor1 - len1, cursor1, dest);
+            *--dest = std::move(*--cursor2);
             return;
         }
-        --last2;
-        if (comp(*(e - 1), *(last1 - 1))) {
-            --last1;
-            *last2 = std::move(*last1);
+
+        int min_gallop = min_gallop_;
+        while (true) {
+            difference_type count1 = 0;
+            difference_type count2 = 0;
+
+            do {
+                if (comp_(*(cursor2 - 1), *(cursor1 - 1))) {
+                    *--dest = std::move(*--cursor1);
+                    ++count1;
+                    count2 = 0;
+                    if (--len1 == 0) {
+                        break;
+                    }
+
+                } else {
+                    *--dest = std::move(*--cursor2);
+                    ++count2;
+                    count1 = 0;
+                    if (--len2 == 1) {
+                        break;
+                    }
+                }
+            } while ((count1 | count2) < min_gallop);
+            if (len1 == 0 || len2 == 1) {
+                break;
+            }
+
+            do {
+                count1 = len1 - details::gallop_right(*(cursor2 - 1), first1, len1, len1 - 1, comp_);
+                if (count1 != 0) {
+                    dest = ciel::move_backward(cursor1 - count1, cursor1, dest);
+                    cursor1 -= count1;
+                    len1 -= count1;
+                    if (len1 == 0) {
+                        break;
+                    }
+                }
+                *--dest = std::move(*--cursor2);
+                if (--len2 == 1) {
+                    break;
+                }
+
+                count2 = len2 - details::gallop_left(*(cursor1 - 1), cursor2 - len2, len2, len2 - 1, comp_);
+                if (count2 != 0) {
+                    dest = ciel::move_backward(cursor2 - count2, cursor2, dest);
+                    cursor2 -= count2;
+                    len2 -= count2;
+                    if (len2 <= 1) {
+                        break;
+                    }
+                }
+                *--dest = std::move(*--cursor1);
+                if (--len1 == 0) {
+                    break;
+                }
+
+                --min_gallop;
+            } while (count1 >= MinGallop || count2 >= MinGallop);
+            if (len1 == 0 || len2 <= 1) {
+                break;
+            }
+
+            min_gallop = ciel::max(min_gallop, 0) + 2;
+        }
+
+        min_gallop_ = ciel::max(min_gallop, 1);
+
+        if (len2 == 1) {
+            dest = ciel::move_backward(cursor1 - len1, cursor1, dest);
+            *--dest = std::move(*--cursor2);
+
         } else {
-            --e;
-            *last2 = std::move(*e);
+            // len2 == 0 only happens when comp is not a strict weak ordering
+            ciel::move_backward(cursor2 - len2, cursor2, dest);
         }
     }
-    std::move_backward(first1, last1, last2);
-}
 
-template<class RandomIt, class Compare>
-constexpr auto merge_at(vector<run<RandomIt>>& pending, typename vector<run<RandomIt>>::size_type n, Compare comp) -> void {
-    RandomIt first1 = pending[n].first_;
-    RandomIt last1 = first1 + pending[n].len_;
-    RandomIt first2 = pending[n + 1].first_;
-    RandomIt last2 = first2 + pending[n + 1].len_;
+    // Merges the runs at n and n + 1
+    constexpr auto merge_at(const size_t n) -> void {
+        difference_type base1 = pending_[n].base_;
+        difference_type len1 = pending_[n].len_;
+        const difference_type base2 = pending_[n + 1].base_;
+        difference_type len2 = pending_[n + 1].len_;
 
-    first1 = details::gallop_left(first1, last1, first2, comp);
-    last2 = details::gallop_right(last1, first2, last2, comp);
+        pending_[n].len_ = len1 + len2;
+        if (n == pending_size_ - 3) {
+            pending_[n + 1] = pending_[n + 2];
+        }
+        --pending_size_;
 
-    if (last1 - first1 <= last2 - first2) {
-        details::merge_low(first1, last1, first2, last2, comp);
-    } else {
-        details::merge_high(first1, last1, first2, last2, comp);
+        // Elements of run1 not greater than run2's first element are already in place
+        const difference_type k = details::gallop_right(first_[base2], first_ + base1, len1, 0, comp_);
+        base1 += k;
+        len1 -= k;
+        if (len1 == 0) {
+            return;
+        }
+
+        // Elements of run2 not less than run1's last element are already in place
+        len2 = details::gallop_left(first_[base1 + len1 - 1], first_ + base2, len2, len2 - 1, comp_);
+        if (len2 == 0) {
+            return;
+        }
+
+        if (len1 <= len2) {
+            merge_low(first_ + base1, len1, first_ + base2, len2);
+        } else {
+            merge_high(first_ + base1, len1, first_ + base2, len2);
+        }
     }
 
-    pending[n].len_ += pending[n + 1].len_;
-    if (n == pending.size() - 3) {
-        pending[n + 1] = pending[n + 2];
+public:
+    constexpr timsort(RandomIt first, const difference_type len, Compare& comp, Buffer& buffer) noexcept
+        : first_(first), len_(len), comp_(comp), buffer_(buffer) {}
+
+    constexpr auto push_run(const difference_type base, const difference_type len) noexcept -> void {
+        pending_[pending_size_++] = {base, len};
     }
-    pending.pop_back();
-}
+
+    // Keeps the invariants (so that run lengths grow at least as fast as Fibonacci numbers):
+    // 1. len[i - 3] > len[i - 2] + len[i - 1]
+    // 2. len[i - 2] > len[i - 1]
+    // Both the last three and the three before them are checked, see "On the Worst-Case Complexity of TimSort"
+    constexpr auto merge_collapse() -> void {
+        while (pending_size_ > 1) {
+            size_t n = pending_size_ - 2;
+            if ((n > 0 && pending_[n - 1].len_ <= pending_[n].len_ + pending_[n + 1].len_)
+                || (n > 1 && pending_[n - 2].len_ <= pending_[n - 1].len_ + pending_[n].len_)) {
+                if (pending_[n - 1].len_ < pending_[n + 1].len_) {
+                    --n;
+                }
+            } else if (pending_[n].len_ > pending_[n + 1].len_) {
+                break;
+            }
+            merge_at(n);
+        }
+    }
+
+    constexpr auto merge_force_collapse() -> void {
+        while (pending_size_ > 1) {
+            size_t n = pending_size_ - 2;
+            if (n > 0 && pending_[n - 1].len_ < pending_[n + 1].len_) {
+                --n;
+            }
+            merge_at(n);
+        }
+    }
+
+};  // class timsort
 
 }   // namespace details
 
-template<class RandomIt, class Compare>
-constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp) -> void {
+// buffer is the scratch space for merges, it's cleared when returning but its capacity is kept,
+// so that sorting many ranges in a loop with the same buffer allocates only a few times
+template<class RandomIt, class Compare, class Alloc>
+constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp,
+                           vector<typename iterator_traits<RandomIt>::value_type, Alloc>& buffer) -> void {
     auto remaining_len = last - first;
     if (remaining_len < 2) {
         return;
@@ -196,10 +514,10 @@ constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp) -> void
         return;
     }
 
-    // store every run (the increasing ranges to be merged)
-    vector<details::run<RandomIt>> pending;
+    details::timsort<RandomIt, Compare, vector<typename iterator_traits<RandomIt>::value_type, Alloc>>
+        ts(first, remaining_len, comp, buffer);
 
-    auto min_run_len = details::min_run_length(remaining_len);
+    const auto min_run_len = details::min_run_length(remaining_len);
 
     RandomIt it = first;
     // remaining_len === last - it
@@ -211,38 +529,31 @@ constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp) -> void
             sorted_len = forced_run_len;
         }
 
-        pending.emplace_back(it, sorted_len);
-        while (pending.size() > 1) {
-            auto n = pending.size() - 2;
-
-            // loop merging when meet one of these conditions:
-            // 1. runLen[i - 3] > runLen[i - 2] + runLen[i - 1]
-            // 2. runLen[i - 2] > runLen[i - 1]
-
-            // merge the runs at n and n + 1
-            if (n > 0 && pending[n - 1].len_ <= pending[n].len_ + pending[n + 1].len_) {
-                if (pending[n - 1].len_ < pending[n + 1].len_) {
-                    --n;
-                }
-                details::merge_at<RandomIt>(pending, n, comp);
-            } else if (pending[n].len_ <= pending[n + 1].len_) {
-                details::merge_at<RandomIt>(pending, n, comp);
-            } else {
-                break;
-            }
-        }
+        ts.push_run(it - first, sorted_len);
+        ts.merge_collapse();
 
         it += sorted_len;
         remaining_len -= sorted_len;
     } while (remaining_len > 0);
 
-    while (pending.size() > 1) {
-        int n = pending.size() - 2;
-        if (n > 0 && pending[n - 1].len_ < pending[n + 1].len_) {
-            --n;
-        }
-        details::merge_at<RandomIt>(pending, n, comp);
-    }
+    ts.merge_force_collapse();
+    buffer.clear();
+}
+
+template<class RandomIt, class Compare, class Alloc>
+constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp, const Alloc& alloc) -> void {
+    using value_type = typename iterator_traits<RandomIt>::value_type;
+    using buffer_type = vector<value_type, typename allocator_traits<Alloc>::template rebind_alloc<value_type>>;
+
+    const typename buffer_type::allocator_type buffer_alloc(alloc);
+    buffer_type buffer(buffer_alloc);
+    ciel::stable_sort(first, last, comp, buffer);
+}
+
+template<class RandomIt, class Compare>
+constexpr auto stable_sort(RandomIt first, RandomIt last, Compare comp) -> void {
+    vector<typename iterator_traits<RandomIt>::value_type> buffer;
+    ciel::stable_sort(first, last, comp, buffer);
 }
 
 template<class RandomIt>
@@ -250,6 +561,130 @@ constexpr auto stable_sort(RandomIt first, RandomIt last) -> void {
     ciel::stable_sort(first, last, less<>());
 }
 
+namespace details {
+
+constexpr ptrdiff_t ParallelStableSortGrain = 1 << 14;
+constexpr ptrdiff_t ParallelMergeGrain = 1 << 14;
+
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+auto move_merge(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+                OutputIt d_first, Compare comp) -> OutputIt {
+    for (; first1 != last1 && first2 != last2; ++d_first) {
+        if (comp(*first2, *first1)) {
+            *d_first = std::move(*first2);
+            ++first2;
+        } else {
+            *d_first = std::move(*first1);
+            ++first1;
+        }
+    }
+    d_first = ciel::move(first1, last1, d_first);
+    return ciel::move(first2, last2, d_first);
+}
+
+// Stable, elements from the first run go before the equal ones from the second run
+template<class InputIt1, class InputIt2, class OutputIt, class Compare>
+auto parallel_move_merge(thread_pool& pool, InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2,
+                         OutputIt d_first, Compare comp) -> void {
+    const auto len1 = last1 - first1;
+    const auto len2 = last2 - first2;
+    if (len1 + len2 <= ParallelMergeGrain) {
+        details::move_merge(first1, last1, first2, last2, d_first, comp);
+        return;
+    }
+
+    InputIt1 mid1;
+    InputIt2 mid2;
+    if (len1 < len2) {
+        mid2 = first2 + len2 / 2;
+        mid1 = ciel::upper_bound(first1, last1, *mid2, comp);
+    } else {
+        mid1 = first1 + len1 / 2;
+        mid2 = ciel::lower_bound(first2, last2, *mid1, comp);
+    }
+    OutputIt d_mid = d_first + ((mid1 - first1) + (mid2 - first2));
+
+    details::parallel_invoke(pool,
+        [&] { details::parallel_move_merge(pool, first1, mid1, first2, mid2, d_first, comp); },
+        [&] { details::parallel_move_merge(pool, mid1, last1, mid2, last2, d_mid, comp); });
+}
+
+// Sort [first, last) stably, using [buffer, buffer + N) as scratch.
+// The result is in [buffer, buffer + N) if to_buffer, otherwise it's in [first, last).
+template<class RandomIt, class BufferIt, class Compare>
+auto parallel_stable_sort_impl(thread_pool& pool, RandomIt first, RandomIt last, BufferIt buffer,
+                               Compare comp, bool to_buffer) -> void {
+    const auto len = last - first;
+    if (len <= ParallelStableSortGrain) {
+        ciel::stable_sort(first, last, comp);
+        if (to_buffer) {
+            ciel::move(first, last, buffer);
+        }
+        return;
+    }
+
+    const auto half = len / 2;
+    details::parallel_invoke(pool,
+        [&] { details::parallel_stable_sort_impl(pool, first, first + half, buffer, comp, !to_buffer); },
+        [&] { details::parallel_stable_sort_impl(pool, first + half, last, buffer + half, comp, !to_buffer); });
+
+    if (to_buffer) {
+        details::parallel_move_merge(pool, first, first + half, first + half, last, buffer, comp);
+    } else {
+        details::parallel_move_merge(pool, buffer, buffer + half, buffer + half, buffer + len, first, comp);
+    }
+}
+
+}   // namespace details
+
+template<class ExecutionPolicy, class RandomIt, class Compare>
+    requires details::execution_policy<ExecutionPolicy>
+auto stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last, Compare comp) -> void {
+    using value_type = typename iterator_traits<RandomIt>::value_type;
+    using alloc_traits = allocator_traits<allocator<value_type>>;
+
+    static_assert(is_nothrow_move_constructible_v<value_type> && is_nothrow_move_assignable_v<value_type>,
+                  "value_type is not allowed to throw in move constructor/assignment");
+
+    const auto len = last - first;
+    if constexpr (!details::parallel_execution_policy<ExecutionPolicy>) {
+        ciel::stable_sort(first, last, comp);
+
+    } else if (len <= details::ParallelStableSortGrain) {
+        ciel::stable_sort(first, last, comp);
+
+    } else {
+        thread_pool& pool = details::policy_pool(policy);
+
+        allocator<value_type> alloc;
+        value_type* buffer = alloc_traits::allocate(alloc, len);
+
+        // Move elements to the buffer in parallel, so the buffer holds the range
+        // and [first, last) is the scratch space
+        auto construct = [&](ptrdiff_t b, ptrdiff_t e) {
+            ciel::uninitialized_move(first + b, first + e, buffer + b);
+        };
+        details::parallel_for(pool, ptrdiff_t(0), ptrdiff_t(len), details::ParallelStableSortGrain, construct);
+
+        CIEL_TRY {
+            details::parallel_stable_sort_impl(pool, buffer, buffer + len, first, comp, true);
+        } CIEL_CATCH (...) {
+            ciel::destroy(buffer, buffer + len);
+            alloc_traits::deallocate(alloc, buffer, len);
+            CIEL_THROW;
+        }
+
+        ciel::destroy(buffer, buffer + len);
+        alloc_traits::deallocate(alloc, buffer, len);
+    }
+}
+
+template<class ExecutionPolicy, class RandomIt>
+    requires details::execution_policy<ExecutionPolicy>
+auto stable_sort(ExecutionPolicy&& policy, RandomIt first, RandomIt last) -> void {
+    ciel::stable_sort(std::forward<ExecutionPolicy>(policy), first, last, less<>());
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_STABLE_SORT_HPP_
\ No newline at end of file
@@ -2,6 +2,9 @@
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_TRANSFORM_HPP_
 
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -22,6 +25,38 @@ constexpr auto transform(InputIt1 first1, InputIt1 last1, InputIt2 first2, Outpu
     return d_first;
 }
 
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class UnaryOperation>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 d_first,
+               UnaryOperation unary_op) -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        details::parallel_for_pieces(policy, first1, last1, [&](ForwardIt1 b, ForwardIt1 e) {
+            ciel::transform(b, e, d_first + (b - first1), unary_op);
+        });
+        return d_first + (last1 - first1);
+
+    } else {
+        return ciel::transform(first1, last1, d_first, unary_op);
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class ForwardIt3, class BinaryOperation>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, ForwardIt3 d_first,
+               BinaryOperation binary_op) -> ForwardIt3 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2> && random_access_iterator<ForwardIt3>) {
+        details::parallel_for_pieces(policy, first1, last1, [&](ForwardIt1 b, ForwardIt1 e) {
+            ciel::transform(b, e, first2 + (b - first1), d_first + (b - first1), binary_op);
+        });
+        return d_first + (last1 - first1);
+
+    } else {
+        return ciel::transform(first1, last1, first2, d_first, binary_op);
+    }
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_TRANSFORM_HPP_
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_UNIQUE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_UNIQUE_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/equal_to.hpp>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class ForwardIt, class BinaryPredicate>
+constexpr auto unique(ForwardIt first, ForwardIt last, BinaryPredicate p) -> ForwardIt {
+    if (first == last) {
+        return last;
+    }
+
+    // Skip the leading unique run without moving anything
+    ForwardIt result = first;
+    while (++first != last) {
+        if (p(*result, *first)) {
+            break;
+        }
+        ++result;
+    }
+
+    if (first != last) {
+        while (++first != last) {
+            if (!p(*result, *first)) {
+                *++result = std::move(*first);
+            }
+        }
+    }
+    return ++result;
+}
+
+template<class ForwardIt>
+constexpr auto unique(ForwardIt first, ForwardIt last) -> ForwardIt {
+    return ciel::unique(first, last, equal_to<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_UNIQUE_HPP_
\ No newline at end of file
@@ -1,28 +1,39 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_UPPER_BOUND_HPP_
 #define CIELUTILS_INCLUDE_CIEL_ALGORITHM_IMPL_UPPER_BOUND_HPP_
 
+#include <ciel/algorithm_impl/lower_bound.hpp>
 #include <ciel/config.hpp>
 #include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/advance.hpp>
 #include <ciel/iterator_impl/distance.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/type_traits_impl/is_base_of.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
 template<class ForwardIt, class T, class Compare>
 [[nodiscard]] constexpr auto upper_bound(ForwardIt first, ForwardIt last, const T& value, Compare comp) -> ForwardIt {
-    auto count = ciel::distance(first, last);
-    while (count > 0) {
-        ForwardIt it = first;
-        auto step = count / 2;
-        ciel::advance(it, step);
-        if (!comp(value, *it)) {
-            first = ++it;
-            count -= step + 1;
-        } else {
-            count = step;
+    if constexpr (is_base_of_v<random_access_iterator_tag, typename iterator_traits<ForwardIt>::iterator_category>) {
+        auto pred = [&](const auto& element) -> bool {
+            return !comp(value, element);
+        };
+        return details::branchless_partition_point(first, last, pred);
+
+    } else {
+        auto count = ciel::distance(first, last);
+        while (count > 0) {
+            ForwardIt it = first;
+            auto step = count / 2;
+            ciel::advance(it, step);
+            if (!comp(value, *it)) {
+                first = ++it;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
         }
+        return first;
     }
-    return first;
 }
 
 template<class ForwardIt, class T>
@@ -153,7 +153,7 @@ struct array {
 
 template<class T, size_t N>
 [[nodiscard]] constexpr auto operator==(const array<T, N>& lhs, const array<T, N>& rhs) -> bool {
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 namespace details {
@@ -5,11 +5,16 @@
 #include <ciel/algorithm_impl/is_sorted.hpp>
 #include <ciel/algorithm_impl/max.hpp>
 #include <ciel/config.hpp>
+#include <ciel/iterator_impl/distance.hpp>
 #include <ciel/iterator_impl/iterator_tag.hpp>
 #include <ciel/iterator_impl/reverse_iterator.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/conditional.hpp>
+#include <ciel/type_traits_impl/is_base_of.hpp>
+#include <ciel/type_traits_impl/is_void.hpp>
 #include <ciel/utility_impl/pair.hpp>
 #include <cstddef>
+#include <cstdint>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -30,16 +35,20 @@ struct avl_node_base {
 
 };  // struct avl_node_base
 
+// An avl tree of N nodes is lower than 1.44 log2(N + 2), so int8_t is far enough for height_.
+// It is placed right before value_, so that small value_type fits in its padding,
+// e.g. avl_node<uint32_t> takes 32 bytes instead of 40.
 template<class T>
 struct avl_node : avl_node_base {
     avl_node_base* right_;
     avl_node_base* parent_;
-    size_t height_;
+    int8_t height_;
     T value_;
 
     template<class... Args>
-    avl_node(avl_node_base* l, avl_node_base* r, avl_node_base* p, const size_t h, Args... args)
-        : avl_node_base(l), right_(r), parent_(p), height_(h), value_(std::forward<Args>(args)...) {}
+    avl_node(avl_node_base* l, avl_node_base* r, avl_node_base* p, const size_t h, Args&&... args)
+        : avl_node_base(l), right_(r), parent_(p), height_(static_cast<int8_t>(h)),
+          value_(std::forward<Args>(args)...) {}
 
     [[nodiscard]] auto is_left_child() const noexcept -> bool {
         return parent_->left_ == this;
@@ -49,15 +58,44 @@ struct avl_node : avl_node_base {
         if (!node) {
             return 0;
         }
-        return node->height_;
+        return static_cast<size_t>(node->height_);
     }
 
     auto height_adjust() noexcept -> void {
-        height_ = 1 + ciel::max(height(static_cast<avl_node*>(left_)), height(static_cast<avl_node*>(right_)));
+        height_ = static_cast<int8_t>(
+            1 + ciel::max(height(static_cast<avl_node*>(left_)), height(static_cast<avl_node*>(right_))));
     }
 
 };  // struct avl_node
 
+// An augmentation keeps a summary of each subtree in its root node, the node derives from it.
+// The tree calls Augmentation::update(node) bottom-up whenever node's children change,
+// so a summary may only depend on the node itself and its children's summaries.
+// A new node is always a leaf, a default constructed augmentation must describe a single node.
+
+// The number of nodes in the subtree, which gives order statistics: nth, rank and distance in O(log N).
+struct avl_subtree_size {
+    size_t subtree_size_{1};
+
+    template<class Node>
+    static auto update(Node* node) noexcept -> void {
+        node->subtree_size_ = 1 + subtree_size(static_cast<Node*>(node->left_))
+                                + subtree_size(static_cast<Node*>(node->right_));
+    }
+
+    [[nodiscard]] static auto subtree_size(const avl_subtree_size* node) noexcept -> size_t {
+        return node == nullptr ? 0 : node->subtree_size_;
+    }
+
+};  // struct avl_subtree_size
+
+// It derives from avl_node<T>, so avl_iterator works on it unchanged.
+template<class T, class Augmentation>
+struct avl_augmented_node : avl_node<T>, Augmentation {
+    using avl_node<T>::avl_node;
+
+};  // struct avl_augmented_node
+
 template<class T, class Pointer, class Reference>
 class avl_iterator {
 public:
@@ -198,7 +236,7 @@ template<class T, class Pointer1, class Pointer2, class Reference1, class Refere
     return !(lhs == rhs);
 }
 
-template<class T, class Compare, class Allocator>
+template<class T, class Compare, class Allocator, class Augmentation = void>
 class avl {
 public:
     using value_type             = T;
@@ -214,10 +252,13 @@ public:
     using const_iterator         = avl_iterator<value_type, const_pointer, const_reference>;
     using reverse_iterator       = ciel::reverse_iterator<iterator>;
     using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+    using node_type              = conditional_t<is_void_v<Augmentation>, avl_node<value_type>,
+                                                 avl_augmented_node<value_type, Augmentation>>;
+
+    static constexpr bool order_statistics = is_base_of_v<avl_subtree_size, node_type>;
 
 private:
     using base_node_type         = avl_node_base;
-    using node_type              = avl_node<value_type>;
 
     using alloc_traits           = allocator_traits<allocator_type>;
     using node_allocator         = typename alloc_traits::template rebind_alloc<node_type>;
@@ -240,20 +281,30 @@ private:
     }
 
     [[nodiscard]] auto height(node_type* node) const noexcept -> size_t {
-        if (!node) {
-            return 0;
+        return node_type::height(node);
+    }
+
+    // Recalculate height_ and the augmentation after node's children changed.
+    static auto update_node(node_type* node) noexcept -> void {
+        node->height_adjust();
+        if constexpr (!is_void_v<Augmentation>) {
+            Augmentation::update(node);
         }
-        return node->height_;
     }
 
     auto destroy_and_deallocate_node(iterator node) noexcept -> void {
-        if (!node.parent()) {   // delete new node when there is duplicate node already
-            node_alloc_traits::destroy(allocator_, static_cast<node_type*>(node.base()));
-            node_alloc_traits::deallocate(allocator_, static_cast<node_type*>(node.base()), 1);
+        auto* n = static_cast<node_type*>(node.base());
+        if (node.parent()) {
+            unlink_node(node);
+        } else {    // delete new node when there is duplicate node already
             --size_;
-            return;
         }
+        node_alloc_traits::destroy(allocator_, n);
+        node_alloc_traits::deallocate(allocator_, n, 1);
+    }
 
+    // Take node out of the tree and rebalance, the node itself is left untouched.
+    auto unlink_node(iterator node) noexcept -> node_type* {
         if (node == begin()) {
             start_ = node.next().base();
         }
@@ -325,7 +376,7 @@ private:
         }
 
         while (upping != addressof(end_node_)) {
-            static_cast<node_type*>(upping)->height_adjust();
+            update_node(static_cast<node_type*>(upping));
 
             if (const auto balance = static_cast<make_signed_t<size_t>>(height(static_cast<node_type*>(upping->left_)))
                     - static_cast<make_signed_t<size_t>>(height(static_cast<node_type*>(static_cast<node_type*>(upping)->right_)));
@@ -352,9 +403,17 @@ private:
             upping = static_cast<node_type*>(upping)->parent_;
         }
 
-        node_alloc_traits::destroy(allocator_, static_cast<node_type*>(node.base()));
-        node_alloc_traits::deallocate(allocator_, static_cast<node_type*>(node.base()), 1);
         --size_;
+        return static_cast<node_type*>(node.base());
+    }
+
+    // Link a node extracted from a tree with an equal allocator.
+    auto link_extracted_node(iterator pos, node_type* node) noexcept -> iterator {
+        node->left_ = nullptr;
+        node->right_ = nullptr;
+        update_node(node);
+        ++size_;
+        return insert_node_at(pos, node);
     }
 
     template<class Key>
@@ -383,8 +442,8 @@ private:
             static_cast<node_type*>(head->left_)->parent_ = head;
         }
 
-        head->height_adjust();
-        new_head->height_adjust();
+        update_node(head);
+        update_node(new_head);
     }
 
     auto left_rotate(node_type* head) noexcept -> void {
@@ -403,8 +462,8 @@ private:
             static_cast<node_type*>(head->right_)->parent_ = head;
         }
 
-        head->height_adjust();
-        new_head->height_adjust();
+        update_node(head);
+        update_node(new_head);
     }
 
     template<class... Args>
@@ -443,7 +502,7 @@ private:
         auto* upping = static_cast<node_type*>(res.base());
         while (upping->parent_ != addressof(end_node_)) {
             upping = static_cast<node_type*>(upping->parent_);
-            upping->height_adjust();
+            update_node(upping);
 
             // Following codes only happen once at most
             if (const auto balance = static_cast<make_signed_t<size_t>>(height(static_cast<node_type*>(upping->left_)))
@@ -469,6 +528,286 @@ private:
         return res;
     }
 
+    [[nodiscard]] auto root() const noexcept -> node_type* {
+        return static_cast<node_type*>(end_node_.left_);
+    }
+
+    [[nodiscard]] static auto left_child(node_type* node) noexcept -> node_type* {
+        return static_cast<node_type*>(node->left_);
+    }
+
+    [[nodiscard]] static auto right_child(node_type* node) noexcept -> node_type* {
+        return static_cast<node_type*>(node->right_);
+    }
+
+    // Make subtree root the new tree, the subtree's parent_ can be anything before.
+    auto attach_root(node_type* subtree) noexcept -> void {
+        end_node_.left_ = subtree;
+        start_ = &end_node_;
+        if (subtree != nullptr) {
+            subtree->parent_ = &end_node_;
+            iterator it(subtree);
+            it.goto_tree_min();
+            start_ = it.base();
+        }
+    }
+
+    // Destroy one node that has been detached from the tree.
+    auto drop_node(node_type* node) noexcept -> void {
+        node_alloc_traits::destroy(allocator_, node);
+        node_alloc_traits::deallocate(allocator_, node, 1);
+        --size_;
+    }
+
+    // depth: H
+    auto drop_subtree(node_type* subtree) noexcept -> void {
+        if (subtree) {
+            drop_subtree(left_child(subtree));
+            drop_subtree(right_child(subtree));
+            drop_node(subtree);
+        }
+    }
+
+    // Build a perfectly balanced subtree from the next n elements in [first, last) and return its root.
+    // Both children get (n - 1) / 2 or n / 2 nodes, so their heights never differ by more than one.
+    // When Unique, the elements equivalent to a consumed one are skipped. depth: log(N)
+    template<bool Unique, class Iter>
+    [[nodiscard]] auto build_subtree(Iter& first, Iter last, const size_type n) -> node_type* {
+        if (n == 0) {
+            return nullptr;
+        }
+
+        const size_type left_size = (n - 1) / 2;
+        node_type* left = build_subtree<Unique>(first, last, left_size);
+
+        node_type* node = nullptr;
+        CIEL_TRY {
+            node = allocate_and_construct_node(*first);
+        } CIEL_CATCH (...) {
+            destroy_and_deallocate_root(iterator(left));
+            CIEL_THROW;
+        }
+
+        node->left_ = left;
+        if (left) {
+            left->parent_ = node;
+        }
+
+        node_type* right = nullptr;
+        CIEL_TRY {
+            ++first;
+            if constexpr (Unique) {
+                while (first != last && !comp_(node->value_, *first)) {
+                    ++first;
+                }
+            }
+            right = build_subtree<Unique>(first, last, n - 1 - left_size);
+        } CIEL_CATCH (...) {
+            destroy_and_deallocate_root(iterator(node));
+            CIEL_THROW;
+        }
+
+        return link(left, node, right);
+    }
+
+    // precondition: empty() and [first, last) is sorted, n is the number of its (unique when Unique) elements
+    template<bool Unique, class Iter>
+    auto build(Iter first, Iter last, const size_type n) -> void {
+        CIEL_PRECONDITION(empty());
+
+        node_type* subtree = nullptr;
+        CIEL_TRY {
+            subtree = build_subtree<Unique>(first, last, n);
+        } CIEL_CATCH (...) {
+            size_ = 0;
+            CIEL_THROW;
+        }
+        attach_root(subtree);
+    }
+
+    // Following helpers work on detached subtrees, they fix children's parent_ but leave the root's to the caller.
+    // They are the join and split primitives in "Just Join for Parallel Ordered Sets" by
+    // Guy E. Blelloch, Daniel Ferizovic and Yihan Sun.
+
+    static auto link(node_type* left, node_type* node, node_type* right) noexcept -> node_type* {
+        node->left_ = left;
+        if (left) {
+            left->parent_ = node;
+        }
+        node->right_ = right;
+        if (right) {
+            right->parent_ = node;
+        }
+        update_node(node);
+        return node;
+    }
+
+    static auto rotate_left(node_type* head) noexcept -> node_type* {
+        node_type* new_head = right_child(head);
+        return link(link(left_child(head), head, left_child(new_head)), new_head, right_child(new_head));
+    }
+
+    static auto rotate_right(node_type* head) noexcept -> node_type* {
+        node_type* new_head = left_child(head);
+        return link(left_child(new_head), new_head, link(right_child(new_head), head, right_child(head)));
+    }
+
+    // precondition: height(left) > height(right) + 1
+    auto join_right(node_type* left, node_type* node, node_type* right) noexcept -> node_type* {
+        node_type* ll = left_child(left);
+        node_type* lr = right_child(left);
+
+        if (height(lr) <= height(right) + 1) {
+            node_type* t = link(lr, node, right);
+            if (height(t) <= height(ll) + 1) {
+                return link(ll, left, t);
+            }
+            return rotate_left(link(ll, left, rotate_right(t)));
+        }
+
+        node_type* t = join_right(lr, node, right);
+        link(ll, left, t);
+        if (height(t) <= height(ll) + 1) {
+            return left;
+        }
+        return rotate_left(left);
+    }
+
+    // precondition: height(right) > height(left) + 1
+    auto join_left(node_type* left, node_type* node, node_type* right) noexcept -> node_type* {
+        node_type* rl = left_child(right);
+        node_type* rr = right_child(right);
+
+        if (height(rl) <= height(left) + 1) {
+            node_type* t = link(left, node, rl);
+            if (height(t) <= height(rr) + 1) {
+                return link(t, right, rr);
+            }
+            return rotate_right(link(rotate_left(t), right, rr));
+        }
+
+        node_type* t = join_left(left, node, rl);
+        link(t, right, rr);
+        if (height(t) <= height(rr) + 1) {
+            return right;
+        }
+        return rotate_right(right);
+    }
+
+    // Every element in left is less than node, which is less than every element in right.
+    // O(|height(left) - height(right)|)
+    auto join(node_type* left, node_type* node, node_type* right) noexcept -> node_type* {
+        if (height(left) > height(right) + 1) {
+            return join_right(left, node, right);
+        }
+        if (height(right) > height(left) + 1) {
+            return join_left(left, node, right);
+        }
+        return link(left, node, right);
+    }
+
+    // Same as join but without the middle node, the last node of left takes its place.
+    auto join2(node_type* left, node_type* right) noexcept -> node_type* {
+        if (left == nullptr) {
+            return right;
+        }
+        auto [rest, last] = split_last(left);
+        return join(rest, last, right);
+    }
+
+    auto split_last(node_type* subtree) noexcept -> pair<node_type*, node_type*> {
+        if (right_child(subtree) == nullptr) {
+            return {left_child(subtree), subtree};
+        }
+        auto [rest, last] = split_last(right_child(subtree));
+        return {join(left_child(subtree), subtree, rest), last};
+    }
+
+    struct split_result {
+        node_type* left;
+        node_type* middle;  // the node equivalent to key, or nullptr
+        node_type* right;
+    };
+
+    // O(H)
+    auto split(node_type* subtree, const value_type& key) noexcept -> split_result {
+        if (subtree == nullptr) {
+            return {nullptr, nullptr, nullptr};
+        }
+
+        node_type* l = left_child(subtree);
+        node_type* r = right_child(subtree);
+        if (comp_(key, subtree->value_)) {
+            split_result res = split(l, key);
+            res.right = join(res.right, subtree, r);
+            return res;
+        }
+        if (comp_(subtree->value_, key)) {
+            split_result res = split(r, key);
+            res.left = join(l, subtree, res.left);
+            return res;
+        }
+        return {l, subtree, r};
+    }
+
+    // Takes over all nodes of rhs, the ones equivalent to a node in lhs are destroyed and counted in duplicates.
+    auto unite_subtree(node_type* lhs, node_type* rhs, size_type& duplicates) noexcept -> node_type* {
+        if (rhs == nullptr) {
+            return lhs;
+        }
+        if (lhs == nullptr) {
+            return rhs;
+        }
+
+        node_type* rl = left_child(rhs);
+        node_type* rr = right_child(rhs);
+        split_result s = split(lhs, rhs->value_);
+        node_type* l = unite_subtree(s.left, rl, duplicates);
+        node_type* r = unite_subtree(s.right, rr, duplicates);
+
+        if (s.middle) {
+            node_alloc_traits::destroy(allocator_, rhs);
+            node_alloc_traits::deallocate(allocator_, rhs, 1);
+            ++duplicates;
+            return join(l, s.middle, r);
+        }
+        return join(l, rhs, r);
+    }
+
+    auto intersect_subtree(node_type* lhs, node_type* rhs) noexcept -> node_type* {
+        if (lhs == nullptr) {
+            return nullptr;
+        }
+        if (rhs == nullptr) {
+            drop_subtree(lhs);
+            return nullptr;
+        }
+
+        split_result s = split(lhs, rhs->value_);
+        node_type* l = intersect_subtree(s.left, left_child(rhs));
+        node_type* r = intersect_subtree(s.right, right_child(rhs));
+
+        if (s.middle) {
+            return join(l, s.middle, r);
+        }
+        return join2(l, r);
+    }
+
+    auto subtract_subtree(node_type* lhs, node_type* rhs) noexcept -> node_type* {
+        if (lhs == nullptr || rhs == nullptr) {
+            return lhs;
+        }
+
+        split_result s = split(lhs, rhs->value_);
+        node_type* l = subtract_subtree(s.left, left_child(rhs));
+        node_type* r = subtract_subtree(s.right, right_child(rhs));
+
+        if (s.middle) {
+            drop_node(s.middle);
+        }
+        return join2(l, r);
+    }
+
 public:
     avl()
         : start_(&end_node_), end_node_(nullptr), size_(0), allocator_(), comp_() {}
@@ -493,13 +832,14 @@ public:
 
     avl(const avl& other)
         : start_(&end_node_), end_node_(nullptr), size_(0),
-          allocator_(node_alloc_traits::select_on_container_copy_construction(other.get_allocator())), comp_() {
-        range_insert_multi(other.begin(), other.end());
+          allocator_(node_alloc_traits::select_on_container_copy_construction(other.get_allocator())),
+          comp_(other.comp_) {
+        build<false>(other.begin(), other.end(), other.size());
     }
 
     avl(const avl& other, const allocator_type& alloc)
-        : start_(&end_node_), end_node_(nullptr), size_(0), allocator_(alloc), comp_() {
-        range_insert_multi(other.begin(), other.end());
+        : start_(&end_node_), end_node_(nullptr), size_(0), allocator_(alloc), comp_(other.comp_) {
+        build<false>(other.begin(), other.end(), other.size());
     }
 
     avl(avl&& other) noexcept
@@ -538,14 +878,14 @@ public:
         if (alloc_traits::propagate_on_container_copy_assignment::value) {
             if (allocator_ != other.allocator_) {
                 avl(other.allocator_).swap(*this);
-                range_insert_multi(other.begin(), other.end());
+                build<false>(other.begin(), other.end(), other.size());
                 return *this;
             }
             allocator_ = other.allocator_;
         }
 
         clear();
-        range_insert_multi(other.begin(), other.end());
+        build<false>(other.begin(), other.end(), other.size());
         return *this;
     }
 
@@ -556,7 +896,7 @@ public:
 
         if (!alloc_traits::propagate_on_container_move_assignment::value && allocator_ != other.allocator_) {
             clear();
-            range_insert_multi(other.begin(), other.end());
+            build<false>(other.begin(), other.end(), other.size());
             return *this;
         }
 
@@ -615,47 +955,64 @@ public:
         size_ = 0;
     }
 
-    // When [first, last) is ordered range, the complexity turn to H + N
+    // When [first, last) is ordered range, a balanced tree is built in N if empty,
+    // otherwise it is built aside and united in M log(N / M + 1)
     template<legacy_input_iterator Iter>
     auto range_insert_unique(Iter first, Iter last) -> void {
-        if (is_forward_iterator<Iter>::value && ciel::is_sorted(first, last, comp_)) {
-            iterator pos = lower_bound(*first);
-            while (first != last) {
-                while (!is_right_insert_multi_place(pos, *first)) {
-                    ++pos;
+        if constexpr (is_forward_iterator<Iter>::value) {
+            if (ciel::is_sorted(first, last, comp_)) {
+                size_type n = 0;
+                for (Iter it = first; it != last; ++n) {
+                    Iter prev = it;
+                    while (++it != last && !comp_(*prev, *it)) {}
                 }
-                if (is_right_insert_unique_place(pos, *first)) {
-                    insert_node_at(pos, allocate_and_construct_node(*first));
+
+                if (empty()) {
+                    build<true>(first, last, n);
+
+                } else {
+                    avl other(comp_, get_allocator());
+                    other.build<true>(first, last, n);
+                    unite(std::move(other));
                 }
-                ++first;
+                return;
             }
-        } else {
-            while (first != last) {
-                if (iterator pos = lower_bound(*first); is_right_insert_unique_place(pos, *first)) {
-                    insert_node_at(pos, allocate_and_construct_node(*first));
-                }
-                ++first;
+        }
+
+        while (first != last) {
+            if (iterator pos = lower_bound(*first); is_right_insert_unique_place(pos, *first)) {
+                insert_node_at(pos, allocate_and_construct_node(*first));
             }
+            ++first;
         }
     }
 
+    // When [first, last) is ordered range, the complexity turn to N if empty, otherwise H + N
     template<legacy_input_iterator Iter>
     auto range_insert_multi(Iter first, Iter last) -> void {
-        if (is_forward_iterator<Iter>::value && ciel::is_sorted(first, last, comp_)) {
-            iterator pos = lower_bound(*first);
-            while (first != last) {
-                while (!is_right_insert_multi_place(pos, *first)) {
-                    ++pos;
+        if constexpr (is_forward_iterator<Iter>::value) {
+            if (first != last && ciel::is_sorted(first, last, comp_)) {
+                if (empty()) {
+                    build<false>(first, last, static_cast<size_type>(ciel::distance(first, last)));
+                    return;
                 }
-                insert_node_at(pos, allocate_and_construct_node(*first));
-                ++first;
-            }
-        } else {
-            while (first != last) {
-                insert_node_at(lower_bound(*first), allocate_and_construct_node(*first));
-                ++first;
+
+                iterator pos = lower_bound(*first);
+                while (first != last) {
+                    while (!is_right_insert_multi_place(pos, *first)) {
+                        ++pos;
+                    }
+                    insert_node_at(pos, allocate_and_construct_node(*first));
+                    ++first;
+                }
+                return;
             }
         }
+
+        while (first != last) {
+            insert_node_at(lower_bound(*first), allocate_and_construct_node(*first));
+            ++first;
+        }
     }
 
     template<class... Args>
@@ -745,7 +1102,77 @@ public:
         swap(comp_, other.comp_);
     }
 
-    // TODO: extract, merge
+    // Node handle support, nodes are relinked and rebalanced without allocation or moving elements.
+    [[nodiscard]] auto extract(iterator pos) noexcept -> node_type* {
+        return unlink_node(pos);
+    }
+
+    // When there is an equivalent element already, the node is not taken and its position is returned.
+    auto insert_node_unique(node_type* node) noexcept -> pair<iterator, bool> {
+        iterator pos = lower_bound(node->value_);
+        if (!is_right_insert_unique_place(pos, node->value_)) {
+            return {pos, false};
+        }
+        return {link_extracted_node(pos, node), true};
+    }
+
+    auto insert_node_unique_hint(iterator hint, node_type* node) noexcept -> pair<iterator, bool> {
+        if (!is_right_insert_multi_place(hint, node->value_)) {
+            hint = lower_bound(node->value_);
+        }
+
+        if (!is_right_insert_unique_place(hint, node->value_)) {
+            return {lower_bound(node->value_), false};
+        }
+        return {link_extracted_node(hint, node), true};
+    }
+
+    // Moves the nodes of source whose elements are not in *this.
+    // precondition: get_allocator() == source.get_allocator()
+    auto merge_unique(avl& source) -> void {
+        CIEL_PRECONDITION(allocator_ == source.allocator_);
+
+        for (iterator it = source.begin(); it != source.end();) {
+            if (iterator pos = lower_bound(*it); is_right_insert_unique_place(pos, *it)) {
+                link_extracted_node(pos, source.unlink_node(it++));
+
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Set algebra for unique trees. Each costs M log(N / M + 1) for sizes M <= N,
+    // instead of M insertions or erasures. Equivalent elements already in *this are kept.
+    // Both trees are taken apart into loose subtrees while comparing, so there is no valid state to leave
+    // on a throwing comparison. The recursion is noexcept and Compare must not throw.
+    auto unite(avl&& other) -> void {
+        if (allocator_ != other.allocator_) {
+            unite(avl(other, get_allocator()));
+            return;
+        }
+
+        size_type duplicates = 0;
+        node_type* res = unite_subtree(root(), other.root(), duplicates);
+        size_ += other.size_ - duplicates;
+        attach_root(res);
+
+        other.start_ = &other.end_node_;
+        other.end_node_.left_ = nullptr;
+        other.size_ = 0;
+    }
+
+    auto unite(const avl& other) -> void {
+        unite(avl(other, get_allocator()));
+    }
+
+    auto intersect(const avl& other) noexcept -> void {
+        attach_root(intersect_subtree(root(), other.root()));
+    }
+
+    auto subtract(const avl& other) noexcept -> void {
+        attach_root(subtract_subtree(root(), other.root()));
+    }
 
     template<class Key>
     [[nodiscard]] auto count_unique(const Key& key) const noexcept -> size_type {
@@ -818,28 +1245,98 @@ public:
         return res;
     }
 
+    // Order statistics, each walks one root path in O(log N).
+
+    // Returns end() if k >= size().
+    [[nodiscard]] auto nth(size_type k) const noexcept -> const_iterator
+        requires order_statistics
+    {
+        if (k >= size()) {
+            return end();
+        }
+
+        node_type* node = root();
+        while (true) {
+            const size_type left_size = avl_subtree_size::subtree_size(left_child(node));
+            if (k < left_size) {
+                node = left_child(node);
+
+            } else if (k == left_size) {
+                return const_iterator(node);
+
+            } else {
+                k -= left_size + 1;
+                node = right_child(node);
+            }
+        }
+    }
+
+    // The number of elements less than key, i.e. the index of lower_bound(key).
+    template<class Key>
+    [[nodiscard]] auto rank(const Key& key) const noexcept -> size_type
+        requires order_statistics
+    {
+        size_type res = 0;
+        for (node_type* node = root(); node != nullptr;) {
+            if (comp_(node->value_, key)) {
+                res += avl_subtree_size::subtree_size(left_child(node)) + 1;
+                node = right_child(node);
+
+            } else {
+                node = left_child(node);
+            }
+        }
+        return res;
+    }
+
+    // The index of pos, size() for end().
+    [[nodiscard]] auto index_of(const_iterator pos) const noexcept -> size_type
+        requires order_statistics
+    {
+        if (pos == end()) {
+            return size();
+        }
+
+        auto* node = static_cast<node_type*>(pos.base());
+        size_type res = avl_subtree_size::subtree_size(left_child(node));
+        while (node->parent_ != &end_node_) {
+            auto* parent = static_cast<node_type*>(node->parent_);
+            if (parent->right_ == node) {
+                res += avl_subtree_size::subtree_size(left_child(parent)) + 1;
+            }
+            node = parent;
+        }
+        return res;
+    }
+
+    [[nodiscard]] auto distance(const_iterator first, const_iterator last) const noexcept -> difference_type
+        requires order_statistics
+    {
+        return static_cast<difference_type>(index_of(last)) - static_cast<difference_type>(index_of(first));
+    }
+
     [[nodiscard]] auto value_comp() const -> value_compare {
         return comp_;
     }
 
 };  // class avl
 
-template<class Key, class Compare, class Alloc>
-[[nodiscard]] auto operator==(const avl<Key, Compare, Alloc>& lhs,
-                              const avl<Key, Compare, Alloc>& rhs) noexcept -> bool {
+template<class Key, class Compare, class Alloc, class Augmentation>
+[[nodiscard]] auto operator==(const avl<Key, Compare, Alloc, Augmentation>& lhs,
+                              const avl<Key, Compare, Alloc, Augmentation>& rhs) noexcept -> bool {
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 NAMESPACE_CIEL_END
 
 namespace std {
 
-template<class Key, class Compare, class Alloc>
-auto swap(ciel::avl<Key, Compare, Alloc>& lhs,
-          ciel::avl<Key, Compare, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+template<class Key, class Compare, class Alloc, class Augmentation>
+auto swap(ciel::avl<Key, Compare, Alloc, Augmentation>& lhs,
+          ciel::avl<Key, Compare, Alloc, Augmentation>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
     lhs.swap(rhs);
 }
 
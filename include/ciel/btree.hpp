@@ -0,0 +1,1127 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_BTREE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_BTREE_HPP_
+
+#include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/max.hpp>
+#include <ciel/algorithm_impl/min.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/greater.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/legacy_input_iterator.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/is_arithmetic.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <ciel/type_traits_impl/remove_cvref.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+// A B-tree: every node holds up to node_capacity values in one allocation, so a lookup touches
+// log_B(n) nodes instead of log_2(n), and an in-order iteration is mostly a sequential scan of arrays.
+//
+// All nodes share the header and the values, internal nodes have node_capacity + 1 children as well,
+// while leaves don't spend memory on them. A node knows its parent and its position in the parent,
+// so an iterator is a (node, index) pair and needs no stack.
+//
+// Values are relocated (moved into another slot and destroyed) within and between nodes,
+// so unlike avl, insertions and erasures invalidate all iterators, pointers and references.
+// A throwing move constructor of value_type leaves the tree in an unspecified state.
+//
+// end() is the position after the last value of the rightmost leaf,
+// since the last value of a B-tree is always in a leaf.
+
+namespace details {
+
+// About 256 bytes of values per node, it's clamped to [3, 64] so that both halves of a split are not empty,
+// and positions fit in uint8_t.
+template<class T>
+inline constexpr size_t btree_node_capacity = ciel::max(size_t(3), ciel::min(size_t(64), 256 / sizeof(T)));
+
+// Comparisons are cheap and without side effects, so a node is searched linearly
+template<class Key, class Compare>
+inline constexpr bool btree_linear_search = is_arithmetic_v<Key>
+    && (is_same_v<Compare, less<Key>> || is_same_v<Compare, less<>>
+        || is_same_v<Compare, greater<Key>> || is_same_v<Compare, greater<>>);
+
+}   // namespace details
+
+template<class T, size_t N>
+struct btree_node {
+    btree_node* parent_;
+    uint8_t position_;   // index in parent_->children()
+    uint8_t count_;
+    bool leaf_;
+    alignas(T) unsigned char values_[sizeof(T) * N];
+
+    explicit btree_node(const bool leaf) noexcept
+        : parent_(nullptr), position_(0), count_(0), leaf_(leaf) {}
+
+    [[nodiscard]] auto slot(const size_t i) noexcept -> T* {
+        return reinterpret_cast<T*>(values_) + i;
+    }
+
+    [[nodiscard]] auto value(const size_t i) noexcept -> T& {
+        return *std::launder(slot(i));
+    }
+
+    [[nodiscard]] auto value(const size_t i) const noexcept -> const T& {
+        return *std::launder(reinterpret_cast<const T*>(values_) + i);
+    }
+
+    // precondition: !leaf_
+    [[nodiscard]] auto children() noexcept -> btree_node**;
+
+    [[nodiscard]] auto child(const size_t i) noexcept -> btree_node* {
+        return children()[i];
+    }
+
+};  // struct btree_node
+
+template<class T, size_t N>
+struct btree_internal_node : btree_node<T, N> {
+    btree_node<T, N>* children_[N + 1];
+
+    btree_internal_node() noexcept : btree_node<T, N>(false) {}
+
+};  // struct btree_internal_node
+
+template<class T, size_t N>
+auto btree_node<T, N>::children() noexcept -> btree_node** {
+    CIEL_PRECONDITION(!leaf_);
+
+    return static_cast<btree_internal_node<T, N>*>(this)->children_;
+}
+
+template<class T, size_t N, class Pointer, class Reference>
+class btree_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = Pointer;
+    using reference         = Reference;
+    using iterator_category = bidirectional_iterator_tag;
+    using iterator_concept  = bidirectional_iterator_tag;
+
+private:
+    using node_type         = btree_node<value_type, N>;
+
+    node_type* node_;
+    size_t index_;
+
+public:
+    btree_iterator() noexcept : node_(nullptr), index_(0) {}
+
+    btree_iterator(const node_type* node, const size_t index) noexcept
+        : node_(const_cast<node_type*>(node)), index_(index) {}
+
+    template<class P, class R>
+    btree_iterator(const btree_iterator<T, N, P, R>& other) noexcept
+        : node_(const_cast<node_type*>(other.base())), index_(other.index()) {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return node_->value(index_);
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return &node_->value(index_);
+    }
+
+    auto operator++() noexcept -> btree_iterator& {
+        if (!node_->leaf_) {
+            node_ = node_->child(index_ + 1);
+            while (!node_->leaf_) {
+                node_ = node_->child(0);
+            }
+            index_ = 0;
+            return *this;
+        }
+
+        if (++index_ < node_->count_) {
+            return *this;
+        }
+
+        // Past the end of the leaf, go up until the subtree is not the last child.
+        // If there is no such ancestor, stay here, it's end().
+        node_type* node = node_;
+        size_t index = index_;
+        while (node->parent_ != nullptr && index == node->count_) {
+            index = node->position_;
+            node = node->parent_;
+        }
+        if (index != node->count_) {
+            node_ = node;
+            index_ = index;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> btree_iterator {
+        btree_iterator res(*this);
+        ++*this;
+        return res;
+    }
+
+    auto operator--() noexcept -> btree_iterator& {
+        if (!node_->leaf_) {
+            node_ = node_->child(index_);
+            while (!node_->leaf_) {
+                node_ = node_->child(node_->count_);
+            }
+            index_ = node_->count_ - 1;
+            return *this;
+        }
+
+        if (index_ > 0) {
+            --index_;
+            return *this;
+        }
+
+        // Before the beginning of the leaf, go up until the subtree is not the first child
+        while (node_->position_ == 0) {
+            node_ = node_->parent_;
+        }
+        index_ = node_->position_ - 1;
+        node_ = node_->parent_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> btree_iterator {
+        btree_iterator res(*this);
+        --*this;
+        return res;
+    }
+
+    [[nodiscard]] auto next() const noexcept -> btree_iterator {
+        btree_iterator res(*this);
+        ++res;
+        return res;
+    }
+
+    [[nodiscard]] auto prev() const noexcept -> btree_iterator {
+        btree_iterator res(*this);
+        --res;
+        return res;
+    }
+
+    [[nodiscard]] auto base() const noexcept -> node_type* {
+        return node_;
+    }
+
+    [[nodiscard]] auto index() const noexcept -> size_t {
+        return index_;
+    }
+
+};  // class btree_iterator
+
+template<class T, size_t N, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator==(const btree_iterator<T, N, Pointer1, Reference1>& lhs,
+                              const btree_iterator<T, N, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return lhs.base() == rhs.base() && lhs.index() == rhs.index();
+}
+
+template<class T, size_t N, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator!=(const btree_iterator<T, N, Pointer1, Reference1>& lhs,
+                              const btree_iterator<T, N, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+// LinearSearch: search in a node by counting the values less than the key without branches,
+// which the compiler vectorizes for arithmetic keys. Otherwise it's a binary search.
+template<class T, class Compare, class Allocator, bool LinearSearch = false>
+class btree {
+public:
+    using value_type             = T;
+    using value_compare          = Compare;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using allocator_type         = Allocator;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
+
+    static constexpr size_t node_capacity = details::btree_node_capacity<value_type>;
+
+    using iterator               = btree_iterator<value_type, node_capacity, pointer, reference>;
+    using const_iterator         = btree_iterator<value_type, node_capacity, const_pointer, const_reference>;
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    using node_type              = btree_node<value_type, node_capacity>;
+    using internal_node_type     = btree_internal_node<value_type, node_capacity>;
+
+    using alloc_traits           = allocator_traits<allocator_type>;
+    using leaf_allocator         = typename alloc_traits::template rebind_alloc<node_type>;
+    using leaf_alloc_traits      = typename alloc_traits::template rebind_traits<node_type>;
+    using internal_allocator     = typename alloc_traits::template rebind_alloc<internal_node_type>;
+    using internal_alloc_traits  = typename alloc_traits::template rebind_traits<internal_node_type>;
+
+    // A node other than the root is merged with or borrows from a sibling when it's less than half full.
+    // Insertions may leave nodes below it, see split.
+    static constexpr size_t min_count = (node_capacity - 1) / 2;
+
+    node_type* root_{nullptr};
+    node_type* leftmost_{nullptr};
+    node_type* rightmost_{nullptr};
+    size_type size_{0};
+    [[no_unique_address]] allocator_type allocator_;
+    [[no_unique_address]] value_compare comp_;
+
+    [[nodiscard]] auto allocate_node(const bool leaf) -> node_type* {
+        if (leaf) {
+            leaf_allocator alloc(allocator_);
+            node_type* res = leaf_alloc_traits::allocate(alloc, 1);
+            leaf_alloc_traits::construct(alloc, res, true);
+            return res;
+        }
+
+        internal_allocator alloc(allocator_);
+        internal_node_type* res = internal_alloc_traits::allocate(alloc, 1);
+        internal_alloc_traits::construct(alloc, res);
+        return res;
+    }
+
+    // Values are destroyed or relocated before
+    auto deallocate_node(node_type* node) noexcept -> void {
+        if (node->leaf_) {
+            leaf_allocator alloc(allocator_);
+            leaf_alloc_traits::destroy(alloc, node);
+            leaf_alloc_traits::deallocate(alloc, node, 1);
+
+        } else {
+            internal_allocator alloc(allocator_);
+            auto* internal = static_cast<internal_node_type*>(node);
+            internal_alloc_traits::destroy(alloc, internal);
+            internal_alloc_traits::deallocate(alloc, internal, 1);
+        }
+    }
+
+    // depth: H, only used in clear
+    auto destroy_subtree(node_type* node) noexcept -> void {
+        for (size_t i = 0; i < node->count_; ++i) {
+            alloc_traits::destroy(allocator_, node->slot(i));
+        }
+        if (!node->leaf_) {
+            for (size_t i = 0; i <= node->count_; ++i) {
+                destroy_subtree(node->child(i));
+            }
+        }
+        deallocate_node(node);
+    }
+
+    // Move the value in src's slot j to dst's empty slot i
+    auto relocate(node_type* dst, const size_t i, node_type* src, const size_t j) -> void {
+        alloc_traits::construct(allocator_, dst->slot(i), std::move(src->value(j)));
+        alloc_traits::destroy(allocator_, src->slot(j));
+    }
+
+    // Make slot i empty by moving [i, count_) one slot right
+    auto shift_right(node_type* node, const size_t i) -> void {
+        for (size_t j = node->count_; j > i; --j) {
+            relocate(node, j, node, j - 1);
+        }
+    }
+
+    // Fill the empty slot i by moving (i, count_) one slot left
+    auto shift_left(node_type* node, const size_t i) -> void {
+        for (size_t j = i + 1; j < node->count_; ++j) {
+            relocate(node, j - 1, node, j);
+        }
+    }
+
+    static auto set_child(node_type* node, const size_t i, node_type* child) noexcept -> void {
+        node->children()[i] = child;
+        child->parent_ = node;
+        child->position_ = static_cast<uint8_t>(i);
+    }
+
+    // Construct a value at i and, for internal nodes, put right_child after it.
+    // precondition: node->count_ < node_capacity
+    template<class... Args>
+    auto insert_value(node_type* node, const size_t i, node_type* right_child, Args&& ... args) -> void {
+        CIEL_PRECONDITION(node->count_ < node_capacity);
+
+        shift_right(node, i);
+        alloc_traits::construct(allocator_, node->slot(i), std::forward<Args>(args)...);
+        if (!node->leaf_) {
+            for (size_t j = node->count_ + 1; j > i + 1; --j) {
+                set_child(node, j, node->child(j - 1));
+            }
+            set_child(node, i + 1, right_child);
+        }
+        ++node->count_;
+    }
+
+    // Split the full node, the value in the middle goes up to the parent, and the right half goes to a new sibling.
+    // i is where a value is going to be inserted, returns where it is after the split.
+    //
+    // Appending to the end of the rightmost leaf, which is what sorted insertions and copies do,
+    // leaves only one value to the new sibling, so that the left one stays (almost) full,
+    // the same to prepending.
+    auto split(node_type* node, const size_t i) -> pair<node_type*, size_t> {
+        CIEL_PRECONDITION(node->count_ == node_capacity);
+
+        const size_t mid = i == node_capacity ? node_capacity - 2 : (i == 0 ? 1 : node_capacity / 2);
+
+        // All allocations happen before any modification
+        node_type* sibling;
+        if (node == root_) {
+            sibling = allocate_node(node->leaf_);
+            node_type* new_root;
+            CIEL_TRY {
+                new_root = allocate_node(false);
+            } CIEL_CATCH (...) {
+                deallocate_node(sibling);
+                CIEL_THROW;
+            }
+            set_child(new_root, 0, node);
+            root_ = new_root;
+
+        } else {
+            if (node->parent_->count_ == node_capacity) {
+                split(node->parent_, node->position_);
+            }
+            sibling = allocate_node(node->leaf_);
+        }
+
+        for (size_t j = mid + 1; j < node_capacity; ++j) {
+            relocate(sibling, j - mid - 1, node, j);
+        }
+        if (!node->leaf_) {
+            for (size_t j = mid + 1; j <= node_capacity; ++j) {
+                set_child(sibling, j - mid - 1, node->child(j));
+            }
+        }
+        sibling->count_ = static_cast<uint8_t>(node_capacity - mid - 1);
+
+        insert_value(node->parent_, node->position_, sibling, std::move(node->value(mid)));
+        alloc_traits::destroy(allocator_, node->slot(mid));
+        node->count_ = static_cast<uint8_t>(mid);
+
+        if (node == rightmost_) {
+            rightmost_ = sibling;
+        }
+
+        if (i <= mid) {
+            return {node, i};
+        }
+        return {sibling, i - mid - 1};
+    }
+
+    // Whether p is a value in node or its ancestors, which may be relocated by an insertion into node
+    [[nodiscard]] static auto is_in_path(const node_type* node, const value_type* p) noexcept -> bool {
+        const auto address = reinterpret_cast<uintptr_t>(p);
+        for (; node != nullptr; node = node->parent_) {
+            if (reinterpret_cast<uintptr_t>(node->values_) <= address
+                && address < reinterpret_cast<uintptr_t>(node->values_ + sizeof(node->values_))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // precondition: node is a leaf, or nullptr when empty
+    template<class... Args>
+    auto insert_at(node_type* node, size_t i, Args&& ... args) -> iterator {
+        // multiset.insert(*it) copies a value in the tree, it's copied out before relocations
+        if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...)) {
+            if (is_in_path(node, addressof((args, ...)))) {
+                value_type value((args, ...));
+                return insert_at(node, i, std::move(value));
+            }
+        }
+
+        if (node == nullptr) {
+            CIEL_PRECONDITION(root_ == nullptr);
+
+            root_ = leftmost_ = rightmost_ = node = allocate_node(true);
+            i = 0;
+        }
+
+        if (node->count_ == node_capacity) {
+            const pair<node_type*, size_t> p = split(node, i);
+            node = p.first;
+            i = p.second;
+        }
+
+        insert_value(node, i, nullptr, std::forward<Args>(args)...);
+        ++size_;
+        return iterator(node, i);
+    }
+
+    // Insert before pos, i.e. at pos if it's in a leaf, or after its previous value, which is the last one of a leaf.
+    template<class... Args>
+    auto insert_before(const_iterator pos, Args&& ... args) -> iterator {
+        node_type* node = pos.base();
+        size_t i = pos.index();
+
+        if (node != nullptr && !node->leaf_) {
+            node = node->child(i);
+            while (!node->leaf_) {
+                node = node->child(node->count_);
+            }
+            i = node->count_;
+        }
+
+        return insert_at(node, i, std::forward<Args>(args)...);
+    }
+
+    template<class Key>
+    [[nodiscard]] auto lower_bound_in_node(const node_type* node, const Key& key) const -> size_t {
+        if constexpr (LinearSearch) {
+            size_t res = 0;
+            for (size_t i = 0; i < node->count_; ++i) {
+                res += static_cast<size_t>(comp_(node->value(i), key));
+            }
+            return res;
+
+        } else {
+            size_t first = 0;
+            size_t len = node->count_;
+            while (len > 0) {
+                const size_t half = len / 2;
+                if (comp_(node->value(first + half), key)) {
+                    first += half + 1;
+                    len -= half + 1;
+
+                } else {
+                    len = half;
+                }
+            }
+            return first;
+        }
+    }
+
+    template<class Key>
+    [[nodiscard]] auto upper_bound_in_node(const node_type* node, const Key& key) const -> size_t {
+        if constexpr (LinearSearch) {
+            size_t res = 0;
+            for (size_t i = 0; i < node->count_; ++i) {
+                res += static_cast<size_t>(!comp_(key, node->value(i)));
+            }
+            return res;
+
+        } else {
+            size_t first = 0;
+            size_t len = node->count_;
+            while (len > 0) {
+                const size_t half = len / 2;
+                if (!comp_(key, node->value(first + half))) {
+                    first += half + 1;
+                    len -= half + 1;
+
+                } else {
+                    len = half;
+                }
+            }
+            return first;
+        }
+    }
+
+    template<class Key>
+    [[nodiscard]] auto is_right_insert_unique_place(const_iterator pos, const Key& key) const -> bool {
+        return static_cast<bool>((pos == end() || comp_(key, *pos)) && (pos == begin() || comp_(*pos.prev(), key)));
+    }
+
+    template<class Key>
+    [[nodiscard]] auto is_right_insert_multi_place(const_iterator pos, const Key& key) const -> bool {
+        return static_cast<bool>((pos == end() || !comp_(*pos, key)) && (pos == begin() || !comp_(key, *pos.prev())));
+    }
+
+    // Merge child(i + 1) and the value i of parent into child(i)
+    auto merge(node_type* parent, const size_t i, iterator& res) -> void {
+        node_type* left = parent->child(i);
+        node_type* right = parent->child(i + 1);
+        const size_t left_count = left->count_;
+
+        relocate(left, left_count, parent, i);
+        for (size_t j = 0; j < right->count_; ++j) {
+            relocate(left, left_count + 1 + j, right, j);
+        }
+        if (!left->leaf_) {
+            for (size_t j = 0; j <= right->count_; ++j) {
+                set_child(left, left_count + 1 + j, right->child(j));
+            }
+        }
+        left->count_ = static_cast<uint8_t>(left_count + 1 + right->count_);
+
+        if (res.base() == right) {
+            res = iterator(left, left_count + 1 + res.index());
+
+        } else if (res.base() == parent && res.index() >= i) {
+            res = res.index() == i ? iterator(left, left_count) : iterator(parent, res.index() - 1);
+        }
+
+        shift_left(parent, i);
+        for (size_t j = i + 1; j < parent->count_; ++j) {
+            set_child(parent, j, parent->child(j + 1));
+        }
+        --parent->count_;
+
+        if (right == rightmost_) {
+            rightmost_ = left;
+        }
+        deallocate_node(right);
+    }
+
+    // Move a value from child(i + 1) to child(i) through the value i of parent
+    auto rotate_left(node_type* parent, const size_t i, iterator& res) -> void {
+        node_type* left = parent->child(i);
+        node_type* right = parent->child(i + 1);
+        const size_t left_count = left->count_;
+
+        if (res.base() == parent && res.index() == i) {
+            res = iterator(left, left_count);
+
+        } else if (res.base() == right) {
+            res = res.index() == 0 ? iterator(parent, i) : iterator(right, res.index() - 1);
+        }
+
+        relocate(left, left_count, parent, i);
+        relocate(parent, i, right, 0);
+        shift_left(right, 0);
+        if (!left->leaf_) {
+            set_child(left, left_count + 1, right->child(0));
+            for (size_t j = 0; j < right->count_; ++j) {
+                set_child(right, j, right->child(j + 1));
+            }
+        }
+        ++left->count_;
+        --right->count_;
+    }
+
+    // Move a value from child(i) to child(i + 1) through the value i of parent
+    auto rotate_right(node_type* parent, const size_t i, iterator& res) -> void {
+        node_type* left = parent->child(i);
+        node_type* right = parent->child(i + 1);
+        const size_t left_count = left->count_;
+
+        if (res.base() == right) {
+            res = iterator(right, res.index() + 1);
+
+        } else if (res.base() == parent && res.index() == i) {
+            res = iterator(right, 0);
+
+        } else if (res.base() == left && res.index() == left_count - 1) {
+            res = iterator(parent, i);
+        }
+
+        shift_right(right, 0);
+        relocate(right, 0, parent, i);
+        relocate(parent, i, left, left_count - 1);
+        if (!right->leaf_) {
+            for (size_t j = right->count_ + 1; j > 0; --j) {
+                set_child(right, j, right->child(j - 1));
+            }
+            set_child(right, 0, left->child(left_count));
+        }
+        --left->count_;
+        ++right->count_;
+    }
+
+    // After a value is removed from node, merge it with a sibling or borrow a value from one
+    // when it's too small, which may go up to the root. res is kept pointing to the same value.
+    auto rebalance(node_type* node, iterator& res) -> void {
+        while (node != root_ && node->count_ < min_count) {
+            node_type* parent = node->parent_;
+            const size_t i = node->position_;
+
+            if (i > 0) {
+                if (parent->child(i - 1)->count_ + node->count_ < node_capacity) {
+                    merge(parent, i - 1, res);
+                    node = parent;
+                    continue;
+                }
+                rotate_right(parent, i - 1, res);
+                return;
+            }
+
+            if (parent->child(1)->count_ + node->count_ < node_capacity) {
+                merge(parent, 0, res);
+                node = parent;
+                continue;
+            }
+            rotate_left(parent, 0, res);
+            return;
+        }
+
+        if (node == root_ && root_->count_ == 0) {
+            if (root_->leaf_) {
+                deallocate_node(root_);
+                root_ = leftmost_ = rightmost_ = nullptr;
+
+            } else {
+                node_type* new_root = root_->child(0);
+                deallocate_node(root_);
+                root_ = new_root;
+                root_->parent_ = nullptr;
+                root_->position_ = 0;
+            }
+        }
+    }
+
+public:
+    btree() = default;
+
+    explicit btree(const value_compare& c, const allocator_type& alloc)
+        : allocator_(alloc), comp_(c) {}
+
+    explicit btree(const allocator_type& alloc)
+        : allocator_(alloc), comp_() {}
+
+    template<legacy_input_iterator Iter>
+    btree(true_type /*unused*/, Iter first, Iter last, const value_compare& c, const allocator_type& alloc)
+        : allocator_(alloc), comp_(c) {
+        range_insert_multi(first, last);
+    }
+
+    template<legacy_input_iterator Iter>
+    btree(false_type /*unused*/, Iter first, Iter last, const value_compare& c, const allocator_type& alloc)
+        : allocator_(alloc), comp_(c) {
+        range_insert_unique(first, last);
+    }
+
+    btree(const btree& other)
+        : allocator_(alloc_traits::select_on_container_copy_construction(other.allocator_)), comp_(other.comp_) {
+        range_insert_multi(other.begin(), other.end());
+    }
+
+    btree(const btree& other, const allocator_type& alloc)
+        : allocator_(alloc), comp_(other.comp_) {
+        range_insert_multi(other.begin(), other.end());
+    }
+
+    btree(btree&& other) noexcept
+        : root_(other.root_), leftmost_(other.leftmost_), rightmost_(other.rightmost_), size_(other.size_),
+          allocator_(std::move(other.allocator_)), comp_(std::move(other.comp_)) {
+        other.root_ = other.leftmost_ = other.rightmost_ = nullptr;
+        other.size_ = 0;
+    }
+
+    btree(btree&& other, const allocator_type& alloc)
+        : allocator_(alloc), comp_(other.comp_) {
+        if (allocator_ == other.allocator_) {
+            swap_nodes(other);
+
+        } else {
+            for (value_type& value : other) {
+                emplace_multi_hint(end(), std::move(value));
+            }
+        }
+    }
+
+    ~btree() {
+        clear();
+    }
+
+    auto operator=(const btree& other) -> btree& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+
+        clear();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+            allocator_ = other.allocator_;
+        }
+        comp_ = other.comp_;
+        range_insert_multi(other.begin(), other.end());
+        return *this;
+    }
+
+    auto operator=(btree&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                                         || alloc_traits::is_always_equal::value) -> btree& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+
+        clear();
+        comp_ = std::move(other.comp_);
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+
+        } else if (allocator_ != other.allocator_) {
+            for (value_type& value : other) {
+                emplace_multi_hint(end(), std::move(value));
+            }
+            return *this;
+        }
+
+        swap_nodes(other);
+        return *this;
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(leftmost_, 0);
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(leftmost_, 0);
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return iterator(rightmost_, rightmost_ != nullptr ? rightmost_->count_ : 0);
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator(rightmost_, rightmost_ != nullptr ? rightmost_->count_ : 0);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return leaf_alloc_traits::max_size(leaf_allocator(allocator_));
+    }
+
+    // Number of levels, for tests and benchmarks
+    [[nodiscard]] auto height() const noexcept -> size_t {
+        size_t res = 0;
+        for (node_type* node = root_; node != nullptr; node = node->leaf_ ? nullptr : node->child(0)) {
+            ++res;
+        }
+        return res;
+    }
+
+    auto clear() noexcept -> void {
+        if (root_ != nullptr) {
+            destroy_subtree(root_);
+        }
+        root_ = leftmost_ = rightmost_ = nullptr;
+        size_ = 0;
+    }
+
+    // When [first, last) is ordered, every insertion is at the end, the complexity turns to N
+    template<legacy_input_iterator Iter>
+    auto range_insert_unique(Iter first, Iter last) -> void {
+        for (; first != last; ++first) {
+            emplace_unique_hint(end(), *first);
+        }
+    }
+
+    template<legacy_input_iterator Iter>
+    auto range_insert_multi(Iter first, Iter last) -> void {
+        for (; first != last; ++first) {
+            emplace_multi_hint(end(), *first);
+        }
+    }
+
+    // Look up with key, and construct the value from args only when key is not found
+    template<class Key, class... Args>
+    auto emplace_unique_key(const Key& key, Args&& ... args) -> pair<iterator, bool> {
+        node_type* node = root_;
+        size_t i = 0;
+
+        if (node != nullptr) {
+            while (true) {
+                i = lower_bound_in_node(node, key);
+                if (i < node->count_ && !comp_(key, node->value(i))) {
+                    return {iterator(node, i), false};
+                }
+                if (node->leaf_) {
+                    break;
+                }
+                node = node->child(i);
+            }
+        }
+
+        return {insert_at(node, i, std::forward<Args>(args)...), true};
+    }
+
+    template<class... Args>
+    auto emplace_unique(Args&& ... args) -> pair<iterator, bool> {
+        if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...)) {
+            return emplace_unique_key(args..., std::forward<Args>(args)...);
+
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            return emplace_unique_key(value, std::move(value));
+        }
+    }
+
+    template<class... Args>
+    auto emplace_multi(Args&& ... args) -> iterator {
+        if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...)) {
+            const value_type& value = (args, ...);
+            node_type* node = root_;
+            size_t i = 0;
+
+            if (node != nullptr) {
+                while (true) {
+                    i = upper_bound_in_node(node, value);
+                    if (node->leaf_) {
+                        break;
+                    }
+                    node = node->child(i);
+                }
+            }
+
+            return insert_at(node, i, std::forward<Args>(args)...);
+
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            return emplace_multi(std::move(value));
+        }
+    }
+
+    template<class Key, class... Args>
+    auto emplace_unique_key_hint(const_iterator hint, const Key& key, Args&& ... args) -> iterator {
+        if (is_right_insert_unique_place(hint, key)) {
+            return insert_before(hint, std::forward<Args>(args)...);
+        }
+        return emplace_unique_key(key, std::forward<Args>(args)...).first;
+    }
+
+    template<class... Args>
+    auto emplace_unique_hint(const_iterator hint, Args&& ... args) -> iterator {
+        if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...)) {
+            return emplace_unique_key_hint(hint, (args, ...), std::forward<Args>(args)...);
+
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            return emplace_unique_hint(hint, std::move(value));
+        }
+    }
+
+    template<class... Args>
+    auto emplace_multi_hint(const_iterator hint, Args&& ... args) -> iterator {
+        if constexpr (sizeof...(Args) == 1 && (is_same_v<remove_cvref_t<Args>, value_type> && ...)) {
+            if (is_right_insert_multi_place(hint, (args, ...))) {
+                return insert_before(hint, std::forward<Args>(args)...);
+            }
+            return emplace_multi(std::forward<Args>(args)...);
+
+        } else {
+            value_type value(std::forward<Args>(args)...);
+            return emplace_multi_hint(hint, std::move(value));
+        }
+    }
+
+    // Returns the iterator to the next value
+    auto erase(const_iterator pos) -> iterator {
+        node_type* node = pos.base();
+        const size_t i = pos.index();
+        node_type* leaf = node;
+        iterator res;
+
+        if (node->leaf_) {
+            alloc_traits::destroy(allocator_, node->slot(i));
+            shift_left(node, i);
+            --node->count_;
+
+            // The next value is at i, or up in the ancestors if i is the end of the leaf.
+            // nullptr for end(), which is not known until rebalancing is done.
+            node_type* n = node;
+            size_t j = i;
+            while (n->parent_ != nullptr && j == n->count_) {
+                j = n->position_;
+                n = n->parent_;
+            }
+            if (j != n->count_) {
+                res = iterator(n, j);
+            }
+
+        } else {
+            // Replaced by the next value, which is the first one of the leftmost leaf in the right subtree
+            leaf = node->child(i + 1);
+            while (!leaf->leaf_) {
+                leaf = leaf->child(0);
+            }
+            alloc_traits::destroy(allocator_, node->slot(i));
+            relocate(node, i, leaf, 0);
+            shift_left(leaf, 0);
+            --leaf->count_;
+            res = iterator(node, i);
+        }
+
+        --size_;
+        rebalance(leaf, res);
+        return res.base() == nullptr ? end() : res;
+    }
+
+    // Iterators are invalidated by every erasure, so it's counted before
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        if (last == end()) {
+            while (first != end()) {
+                first = erase(first);
+            }
+            return end();
+        }
+
+        size_t n = 0;
+        for (const_iterator it = first; it != last; ++it) {
+            ++n;
+        }
+        iterator res(first);
+        while (n-- > 0) {
+            res = erase(res);
+        }
+        return res;
+    }
+
+    template<class Key>
+    auto erase_unique(const Key& key) -> size_type {
+        const const_iterator pos = find(key);
+        if (pos == end()) {
+            return 0;
+        }
+        erase(pos);
+        return 1;
+    }
+
+    template<class Key>
+    auto erase_multi(const Key& key) -> size_type {
+        const pair<const_iterator, const_iterator> er = equal_range(key);
+        const size_type res = size();
+        erase(er.first, er.second);
+        return res - size();
+    }
+
+    auto swap(btree& other) noexcept -> void {
+        using std::swap;
+
+        swap_nodes(other);
+        swap(allocator_, other.allocator_);
+        swap(comp_, other.comp_);
+    }
+
+    template<class Key>
+    [[nodiscard]] auto count_unique(const Key& key) const -> size_type {
+        return static_cast<size_type>(contains(key));
+    }
+
+    template<class Key>
+    [[nodiscard]] auto count_multi(const Key& key) const -> size_type {
+        size_type res = 0;
+        for (const_iterator it = lower_bound(key); it != end() && !comp_(key, *it); ++it) {
+            ++res;
+        }
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto find(const Key& key) -> iterator {
+        const const_iterator res = static_cast<const btree&>(*this).find(key);
+        return iterator(res.base(), res.index());
+    }
+
+    template<class Key>
+    [[nodiscard]] auto find(const Key& key) const -> const_iterator {
+        const const_iterator lb = lower_bound(key);
+
+        if (lb != end() && !comp_(key, *lb)) {
+            return lb;
+        }
+
+        return end();
+    }
+
+    template<class Key>
+    [[nodiscard]] auto contains(const Key& key) const -> bool {
+        return find(key) != end();
+    }
+
+    template<class Key>
+    [[nodiscard]] auto equal_range(const Key& key) -> pair<iterator, iterator> {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Key>
+    [[nodiscard]] auto equal_range(const Key& key) const -> pair<const_iterator, const_iterator> {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Key>
+    [[nodiscard]] auto lower_bound(const Key& key) -> iterator {
+        const const_iterator res = static_cast<const btree&>(*this).lower_bound(key);
+        return iterator(res.base(), res.index());
+    }
+
+    template<class Key>
+    [[nodiscard]] auto lower_bound(const Key& key) const -> const_iterator {
+        const_iterator res = end();
+        const node_type* node = root_;
+
+        while (node != nullptr) {
+            const size_t i = lower_bound_in_node(node, key);
+            if (i < node->count_) {
+                res = const_iterator(node, i);
+            }
+            node = node->leaf_ ? nullptr : const_cast<node_type*>(node)->child(i);
+        }
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto upper_bound(const Key& key) -> iterator {
+        const const_iterator res = static_cast<const btree&>(*this).upper_bound(key);
+        return iterator(res.base(), res.index());
+    }
+
+    template<class Key>
+    [[nodiscard]] auto upper_bound(const Key& key) const -> const_iterator {
+        const_iterator res = end();
+        const node_type* node = root_;
+
+        while (node != nullptr) {
+            const size_t i = upper_bound_in_node(node, key);
+            if (i < node->count_) {
+                res = const_iterator(node, i);
+            }
+            node = node->leaf_ ? nullptr : const_cast<node_type*>(node)->child(i);
+        }
+        return res;
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return comp_;
+    }
+
+private:
+    auto swap_nodes(btree& other) noexcept -> void {
+        std::swap(root_, other.root_);
+        std::swap(leftmost_, other.leftmost_);
+        std::swap(rightmost_, other.rightmost_);
+        std::swap(size_, other.size_);
+    }
+
+};  // class btree
+
+template<class T, class Compare, class Alloc, bool LinearSearch>
+[[nodiscard]] auto operator==(const btree<T, Compare, Alloc, LinearSearch>& lhs,
+                              const btree<T, Compare, Alloc, LinearSearch>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, class Compare, class Alloc, bool LinearSearch>
+auto swap(ciel::btree<T, Compare, Alloc, LinearSearch>& lhs,
+          ciel::btree<T, Compare, Alloc, LinearSearch>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_BTREE_HPP_
\ No newline at end of file
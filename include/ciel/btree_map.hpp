@@ -0,0 +1,917 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_BTREE_MAP_HPP_
+#define CIELUTILS_INCLUDE_CIEL_BTREE_MAP_HPP_
+
+#include <ciel/btree.hpp>
+#include <ciel/config.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/tuple.hpp>
+#include <stdexcept>
+
+NAMESPACE_CIEL_BEGIN
+
+// map and multimap on btree, with the same interface as map except that
+// insertions and erasures invalidate all iterators, see btree.hpp.
+
+namespace details {
+
+template<class Key, class T, class Compare>
+class btree_map_value_compare {
+private:
+    using value_type = pair<const Key, T>;
+
+    [[no_unique_address]] Compare comp_;
+
+public:
+    explicit btree_map_value_compare(const Compare& c = Compare()) : comp_(c) {}
+
+    [[nodiscard]] auto key_comp() const -> Compare {
+        return comp_;
+    }
+
+    [[nodiscard]] auto operator()(const value_type& lhs, const value_type& rhs) const -> bool {
+        return comp_(lhs.first, rhs.first);
+    }
+
+    [[nodiscard]] auto operator()(const Key& lhs, const value_type& rhs) const -> bool {
+        return comp_(lhs, rhs.first);
+    }
+
+    [[nodiscard]] auto operator()(const value_type& lhs, const Key& rhs) const -> bool {
+        return comp_(lhs.first, rhs);
+    }
+
+    template<class K>
+        requires requires { typename Compare::is_transparent; }
+    [[nodiscard]] auto operator()(const K& lhs, const value_type& rhs) const -> bool {
+        return comp_(lhs, rhs.first);
+    }
+
+    template<class K>
+        requires requires { typename Compare::is_transparent; }
+    [[nodiscard]] auto operator()(const value_type& lhs, const K& rhs) const -> bool {
+        return comp_(lhs.first, rhs);
+    }
+
+};  // class btree_map_value_compare
+
+}   // namespace details
+
+template<class Key, class T, class Compare = less<Key>, class Allocator = allocator<pair<const Key, T>>>
+class btree_map {
+public:
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = pair<const Key, T>;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using key_compare            = Compare;
+    using value_compare          = details::btree_map_value_compare<Key, T, Compare>;
+    using allocator_type         = Allocator;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
+
+private:
+    using tree_type              = btree<value_type, value_compare, allocator_type,
+                                         details::btree_linear_search<key_type, key_compare>>;
+    using alloc_traits           = allocator_traits<allocator_type>;
+
+public:
+    using iterator               = typename tree_type::iterator;
+    using const_iterator         = typename tree_type::const_iterator;
+
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    tree_type tree_;
+
+public:
+    btree_map() : tree_() {}
+
+    explicit btree_map(const key_compare& c, const allocator_type& alloc = allocator_type())
+        : tree_(value_compare(c), alloc) {}
+
+    explicit btree_map(const allocator_type& alloc) : tree_(alloc) {}
+
+    template<class Iter>
+    btree_map(Iter first, Iter last, const key_compare& c = key_compare(),
+              const allocator_type& alloc = allocator_type())
+        : tree_(false_type{}, first, last, value_compare(c), alloc) {}
+
+    template<class Iter>
+    btree_map(Iter first, Iter last, const allocator_type& alloc) : btree_map(first, last, key_compare(), alloc) {}
+
+    btree_map(const btree_map& other) : tree_(other.tree_) {}
+
+    btree_map(const btree_map& other, const allocator_type& alloc) : tree_(other.tree_, alloc) {}
+
+    btree_map(btree_map&& other) noexcept : tree_(std::move(other.tree_)) {}
+
+    btree_map(btree_map&& other, const allocator_type& alloc) : tree_(std::move(other.tree_), alloc) {}
+
+    btree_map(std::initializer_list<value_type> init, const key_compare& c = key_compare(),
+              const allocator_type& alloc = allocator_type())
+        : btree_map(init.begin(), init.end(), c, alloc) {}
+
+    btree_map(std::initializer_list<value_type> init, const allocator_type& alloc)
+        : btree_map(init, key_compare(), alloc) {}
+
+    ~btree_map() = default;
+
+    auto operator=(const btree_map& other) -> btree_map& = default;
+
+    auto operator=(btree_map&& other)
+        noexcept(alloc_traits::is_always_equal::value && is_nothrow_move_assignable_v<value_compare>)
+        -> btree_map& = default;
+
+    auto operator=(std::initializer_list<value_type> ilist) -> btree_map& {
+        clear();
+        tree_.range_insert_unique(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return tree_.get_allocator();
+    }
+
+    [[nodiscard]] auto at(const Key& key) -> T& {
+        auto pos = tree_.find(key);
+        if (pos == end()) {
+            THROW(std::out_of_range("key is not found in ciel::btree_map"));
+        }
+        return pos->second;
+    }
+
+    [[nodiscard]] auto at(const Key& key) const -> const T& {
+        auto pos = tree_.find(key);
+        if (pos == end()) {
+            THROW(std::out_of_range("key is not found in ciel::btree_map"));
+        }
+        return pos->second;
+    }
+
+    [[nodiscard]] auto operator[](const Key& key) -> T& {
+        return try_emplace(key).first->second;
+    }
+
+    [[nodiscard]] auto operator[](Key&& key) -> T& {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return tree_.begin();
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return tree_.begin();
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return tree_.end();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return tree_.end();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return tree_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return tree_.size();
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return tree_.max_size();
+    }
+
+    [[nodiscard]] auto height() const noexcept -> size_t {
+        return tree_.height();
+    }
+
+    auto clear() noexcept -> void {
+        tree_.clear();
+    }
+
+    auto insert(const value_type& value) -> pair<iterator, bool> {
+        return emplace(value);
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P&&>
+    auto insert(P&& value) -> pair<iterator, bool> {
+        return emplace(std::forward<P>(value));
+    }
+
+    auto insert(value_type&& value) -> pair<iterator, bool> {
+        return emplace(std::move(value));
+    }
+
+    auto insert(const_iterator hint, const value_type& value) -> iterator {
+        return emplace_hint(hint, value);
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P&&>
+    auto insert(const_iterator hint, P&& value) -> iterator {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    auto insert(const_iterator hint, value_type&& value) -> iterator {
+        return emplace_hint(hint, std::move(value));
+    }
+
+    template<class Iter>
+    auto insert(Iter first, Iter last) -> void {
+        tree_.range_insert_unique(first, last);
+    }
+
+    auto insert(std::initializer_list<value_type> ilist) -> void {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template<class M>
+        requires is_assignable_v<mapped_type&, M&&>
+    auto insert_or_assign(const key_type& k, M&& obj) -> pair<iterator, bool> {
+        pair<iterator, bool> res = tree_.emplace_unique_key(k, k, std::forward<M>(obj));
+        if (!res.second) {
+            res.first->second = std::forward<M>(obj);
+        }
+        return res;
+    }
+
+    template<class M>
+        requires is_assignable_v<mapped_type&, M&&>
+    auto insert_or_assign(key_type&& k, M&& obj) -> pair<iterator, bool> {
+        pair<iterator, bool> res = tree_.emplace_unique_key(k, std::move(k), std::forward<M>(obj));
+        if (!res.second) {
+            res.first->second = std::forward<M>(obj);
+        }
+        return res;
+    }
+
+    template<class M>
+        requires is_assignable_v<mapped_type&, M&&>
+    auto insert_or_assign(const_iterator hint, const key_type& k, M&& obj) -> iterator {
+        if (auto pos = find(k); pos != end()) {
+            pos->second = std::forward<M>(obj);
+            return pos;
+        }
+        return tree_.emplace_unique_key_hint(hint, k, k, std::forward<M>(obj));
+    }
+
+    template<class M>
+        requires is_assignable_v<mapped_type&, M&&>
+    auto insert_or_assign(const_iterator hint, key_type&& k, M&& obj) -> iterator {
+        if (auto pos = find(k); pos != end()) {
+            pos->second = std::forward<M>(obj);
+            return pos;
+        }
+        return tree_.emplace_unique_key_hint(hint, k, std::move(k), std::forward<M>(obj));
+    }
+
+    template<class... Args>
+    auto emplace(Args&& ... args) -> pair<iterator, bool> {
+        return tree_.emplace_unique(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    auto emplace_hint(const_iterator hint, Args&& ... args) -> iterator {
+        return tree_.emplace_unique_hint(hint, std::forward<Args>(args)...);
+    }
+
+    // The key is looked up before anything is constructed
+    template<class... Args>
+    auto try_emplace(const key_type& k, Args&& ... args) -> pair<iterator, bool> {
+        return tree_.emplace_unique_key(k, piecewise_construct, ciel::forward_as_tuple(k),
+                                        ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    auto try_emplace(key_type&& k, Args&& ... args) -> pair<iterator, bool> {
+        return tree_.emplace_unique_key(k, piecewise_construct, ciel::forward_as_tuple(std::move(k)),
+                                        ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    auto try_emplace(const_iterator hint, const key_type& k, Args&& ... args) -> iterator {
+        return tree_.emplace_unique_key_hint(hint, k, piecewise_construct, ciel::forward_as_tuple(k),
+                                             ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    auto try_emplace(const_iterator hint, key_type&& k, Args&& ... args) -> iterator {
+        return tree_.emplace_unique_key_hint(hint, k, piecewise_construct, ciel::forward_as_tuple(std::move(k)),
+                                             ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    auto erase(const_iterator pos) -> iterator {
+        return tree_.erase(pos);
+    }
+
+    auto erase(iterator pos) -> iterator {
+        return tree_.erase(pos);
+    }
+
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        return tree_.erase(first, last);
+    }
+
+    auto erase(const Key& key) -> size_type {
+        return tree_.erase_unique(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    auto erase(K&& x) -> size_type {
+        return tree_.erase_multi(x);
+    }
+
+    auto swap(btree_map& other)
+        noexcept(alloc_traits::is_always_equal::value && is_nothrow_swappable_v<value_compare>) -> void {
+        tree_.swap(other.tree_);
+    }
+
+    [[nodiscard]] auto count(const Key& key) const -> size_type {
+        return tree_.count_unique(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const -> size_type {
+        return tree_.count_multi(x);
+    }
+
+    [[nodiscard]] auto find(const Key& key) -> iterator {
+        return tree_.find(key);
+    }
+
+    [[nodiscard]] auto find(const Key& key) const -> const_iterator {
+        return tree_.find(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) -> iterator {
+        return tree_.find(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const -> const_iterator {
+        return tree_.find(x);
+    }
+
+    [[nodiscard]] auto contains(const Key& key) const -> bool {
+        return tree_.contains(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const -> bool {
+        return tree_.contains(x);
+    }
+
+    [[nodiscard]] auto equal_range(const Key& key) -> pair<iterator, iterator> {
+        return tree_.equal_range(key);
+    }
+
+    [[nodiscard]] auto equal_range(const Key& key) const -> pair<const_iterator, const_iterator> {
+        return tree_.equal_range(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) -> pair<iterator, iterator> {
+        return tree_.equal_range(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const -> pair<const_iterator, const_iterator> {
+        return tree_.equal_range(x);
+    }
+
+    [[nodiscard]] auto lower_bound(const Key& key) -> iterator {
+        return tree_.lower_bound(key);
+    }
+
+    [[nodiscard]] auto lower_bound(const Key& key) const -> const_iterator {
+        return tree_.lower_bound(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) -> iterator {
+        return tree_.lower_bound(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const -> const_iterator {
+        return tree_.lower_bound(x);
+    }
+
+    [[nodiscard]] auto upper_bound(const Key& key) -> iterator {
+        return tree_.upper_bound(key);
+    }
+
+    [[nodiscard]] auto upper_bound(const Key& key) const -> const_iterator {
+        return tree_.upper_bound(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) -> iterator {
+        return tree_.upper_bound(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const -> const_iterator {
+        return tree_.upper_bound(x);
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return value_comp().key_comp();
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return tree_.value_comp();
+    }
+
+};  // class btree_map
+
+template<class Key, class T, class Compare = less<Key>, class Allocator = allocator<pair<const Key, T>>>
+class btree_multimap {
+public:
+    using key_type               = Key;
+    using mapped_type            = T;
+    using value_type             = pair<const Key, T>;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using key_compare            = Compare;
+    using value_compare          = details::btree_map_value_compare<Key, T, Compare>;
+    using allocator_type         = Allocator;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
+
+private:
+    using tree_type              = btree<value_type, value_compare, allocator_type,
+                                         details::btree_linear_search<key_type, key_compare>>;
+    using alloc_traits           = allocator_traits<allocator_type>;
+
+public:
+    using iterator               = typename tree_type::iterator;
+    using const_iterator         = typename tree_type::const_iterator;
+
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    tree_type tree_;
+
+public:
+    btree_multimap() : tree_() {}
+
+    explicit btree_multimap(const key_compare& c, const allocator_type& alloc = allocator_type())
+        : tree_(value_compare(c), alloc) {}
+
+    explicit btree_multimap(const allocator_type& alloc) : tree_(alloc) {}
+
+    template<class Iter>
+    btree_multimap(Iter first, Iter last, const key_compare& c = key_compare(),
+                   const allocator_type& alloc = allocator_type())
+        : tree_(true_type{}, first, last, value_compare(c), alloc) {}
+
+    template<class Iter>
+    btree_multimap(Iter first, Iter last, const allocator_type& alloc)
+        : btree_multimap(first, last, key_compare(), alloc) {}
+
+    btree_multimap(const btree_multimap& other) : tree_(other.tree_) {}
+
+    btree_multimap(const btree_multimap& other, const allocator_type& alloc) : tree_(other.tree_, alloc) {}
+
+    btree_multimap(btree_multimap&& other) noexcept : tree_(std::move(other.tree_)) {}
+
+    btree_multimap(btree_multimap&& other, const allocator_type& alloc) : tree_(std::move(other.tree_), alloc) {}
+
+    btree_multimap(std::initializer_list<value_type> init, const key_compare& c = key_compare(),
+                   const allocator_type& alloc = allocator_type())
+        : btree_multimap(init.begin(), init.end(), c, alloc) {}
+
+    btree_multimap(std::initializer_list<value_type> init, const allocator_type& alloc)
+        : btree_multimap(init, key_compare(), alloc) {}
+
+    ~btree_multimap() = default;
+
+    auto operator=(const btree_multimap& other) -> btree_multimap& = default;
+
+    auto operator=(btree_multimap&& other)
+        noexcept(alloc_traits::is_always_equal::value && is_nothrow_move_assignable_v<value_compare>)
+        -> btree_multimap& = default;
+
+    auto operator=(std::initializer_list<value_type> ilist) -> btree_multimap& {
+        clear();
+        tree_.range_insert_multi(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return tree_.get_allocator();
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return tree_.begin();
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return tree_.begin();
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return tree_.end();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return tree_.end();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return tree_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return tree_.size();
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return tree_.max_size();
+    }
+
+    [[nodiscard]] auto height() const noexcept -> size_t {
+        return tree_.height();
+    }
+
+    auto clear() noexcept -> void {
+        tree_.clear();
+    }
+
+    auto insert(const value_type& value) -> iterator {
+        return emplace(value);
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P&&>
+    auto insert(P&& value) -> iterator {
+        return emplace(std::forward<P>(value));
+    }
+
+    auto insert(value_type&& value) -> iterator {
+        return emplace(std::move(value));
+    }
+
+    auto insert(const_iterator hint, const value_type& value) -> iterator {
+        return emplace_hint(hint, value);
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P&&>
+    auto insert(const_iterator hint, P&& value) -> iterator {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    auto insert(const_iterator hint, value_type&& value) -> iterator {
+        return emplace_hint(hint, std::move(value));
+    }
+
+    template<class Iter>
+    auto insert(Iter first, Iter last) -> void {
+        tree_.range_insert_multi(first, last);
+    }
+
+    auto insert(std::initializer_list<value_type> ilist) -> void {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template<class... Args>
+    auto emplace(Args&& ... args) -> iterator {
+        return tree_.emplace_multi(std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    auto emplace_hint(const_iterator hint, Args&& ... args) -> iterator {
+        return tree_.emplace_multi_hint(hint, std::forward<Args>(args)...);
+    }
+
+    auto erase(const_iterator pos) -> iterator {
+        return tree_.erase(pos);
+    }
+
+    auto erase(iterator pos) -> iterator {
+        return tree_.erase(pos);
+    }
+
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        return tree_.erase(first, last);
+    }
+
+    auto erase(const Key& key) -> size_type {
+        return tree_.erase_multi(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    auto erase(K&& x) -> size_type {
+        return tree_.erase_multi(x);
+    }
+
+    auto swap(btree_multimap& other)
+        noexcept(alloc_traits::is_always_equal::value && is_nothrow_swappable_v<value_compare>) -> void {
+        tree_.swap(other.tree_);
+    }
+
+    [[nodiscard]] auto count(const Key& key) const -> size_type {
+        return tree_.count_multi(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const -> size_type {
+        return tree_.count_multi(x);
+    }
+
+    [[nodiscard]] auto find(const Key& key) -> iterator {
+        return tree_.find(key);
+    }
+
+    [[nodiscard]] auto find(const Key& key) const -> const_iterator {
+        return tree_.find(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) -> iterator {
+        return tree_.find(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const -> const_iterator {
+        return tree_.find(x);
+    }
+
+    [[nodiscard]] auto contains(const Key& key) const -> bool {
+        return tree_.contains(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const -> bool {
+        return tree_.contains(x);
+    }
+
+    [[nodiscard]] auto equal_range(const Key& key) -> pair<iterator, iterator> {
+        return tree_.equal_range(key);
+    }
+
+    [[nodiscard]] auto equal_range(const Key& key) const -> pair<const_iterator, const_iterator> {
+        return tree_.equal_range(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) -> pair<iterator, iterator> {
+        return tree_.equal_range(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const -> pair<const_iterator, const_iterator> {
+        return tree_.equal_range(x);
+    }
+
+    [[nodiscard]] auto lower_bound(const Key& key) -> iterator {
+        return tree_.lower_bound(key);
+    }
+
+    [[nodiscard]] auto lower_bound(const Key& key) const -> const_iterator {
+        return tree_.lower_bound(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) -> iterator {
+        return tree_.lower_bound(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const -> const_iterator {
+        return tree_.lower_bound(x);
+    }
+
+    [[nodiscard]] auto upper_bound(const Key& key) -> iterator {
+        return tree_.upper_bound(key);
+    }
+
+    [[nodiscard]] auto upper_bound(const Key& key) const -> const_iterator {
+        return tree_.upper_bound(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) -> iterator {
+        return tree_.upper_bound(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const -> const_iterator {
+        return tree_.upper_bound(x);
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return value_comp().key_comp();
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return tree_.value_comp();
+    }
+
+};  // class btree_multimap
+
+template<class Key, class T, class Compare, class Alloc>
+[[nodiscard]] auto operator==(const btree_map<Key, T, Compare, Alloc>& lhs,
+                              const btree_map<Key, T, Compare, Alloc>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class Key, class T, class Compare, class Alloc>
+[[nodiscard]] auto operator==(const btree_multimap<Key, T, Compare, Alloc>& lhs,
+                              const btree_multimap<Key, T, Compare, Alloc>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+// Iterators are invalidated by erase, the returned one is used
+template<class Key, class T, class Compare, class Alloc, class Pred>
+auto erase_if(btree_map<Key, T, Compare, Alloc>& c, Pred pred)
+    -> typename btree_map<Key, T, Compare, Alloc>::size_type {
+    auto old_size = c.size();
+    for (auto i = c.begin(); i != c.end();) {
+        if (pred(*i)) {
+            i = c.erase(i);
+        } else {
+            ++i;
+        }
+    }
+    return old_size - c.size();
+}
+
+template<class Key, class T, class Compare, class Alloc, class Pred>
+auto erase_if(btree_multimap<Key, T, Compare, Alloc>& c, Pred pred)
+    -> typename btree_multimap<Key, T, Compare, Alloc>::size_type {
+    auto old_size = c.size();
+    for (auto i = c.begin(); i != c.end();) {
+        if (pred(*i)) {
+            i = c.erase(i);
+        } else {
+            ++i;
+        }
+    }
+    return old_size - c.size();
+}
+
+template<class Iter, class Comp = less<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>>,
+         class Alloc = allocator<pair<add_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                                                  typename iterator_traits<Iter>::value_type::second_type>>>
+btree_map(Iter, Iter, Comp = Comp(), Alloc = Alloc())
+    -> btree_map<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                 typename iterator_traits<Iter>::value_type::second_type, Comp, Alloc>;
+
+template<class Key, class T, class Comp = less<Key>, class Alloc = allocator<pair<const Key, T>>>
+btree_map(std::initializer_list<pair<const Key, T>>, Comp = Comp(), Alloc = Alloc()) -> btree_map<Key, T, Comp, Alloc>;
+
+template<class Iter, class Alloc>
+btree_map(Iter, Iter, Alloc)
+    -> btree_map<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                 typename iterator_traits<Iter>::value_type::second_type,
+                 less<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>>, Alloc>;
+
+template<class Key, class T, class Allocator>
+btree_map(std::initializer_list<pair<const Key, T>>, Allocator) -> btree_map<Key, T, less<Key>, Allocator>;
+
+template<class Iter, class Comp = less<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>>,
+         class Alloc = allocator<pair<add_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                                                  typename iterator_traits<Iter>::value_type::second_type>>>
+btree_multimap(Iter, Iter, Comp = Comp(), Alloc = Alloc())
+    -> btree_multimap<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                      typename iterator_traits<Iter>::value_type::second_type, Comp, Alloc>;
+
+template<class Key, class T, class Comp = less<Key>, class Alloc = allocator<pair<const Key, T>>>
+btree_multimap(std::initializer_list<pair<const Key, T>>, Comp = Comp(), Alloc = Alloc())
+    -> btree_multimap<Key, T, Comp, Alloc>;
+
+template<class Iter, class Alloc>
+btree_multimap(Iter, Iter, Alloc)
+    -> btree_multimap<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>,
+                      typename iterator_traits<Iter>::value_type::second_type,
+                      less<remove_const_t<typename iterator_traits<Iter>::value_type::first_type>>, Alloc>;
+
+template<class Key, class T, class Allocator>
+btree_multimap(std::initializer_list<pair<const Key, T>>, Allocator) -> btree_multimap<Key, T, less<Key>, Allocator>;
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class Key, class T, class Compare, class Alloc>
+auto swap(ciel::btree_map<Key, T, Compare, Alloc>& lhs,
+          ciel::btree_map<Key, T, Compare, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+    lhs.swap(rhs);
+}
+
+template<class Key, class T, class Compare, class Alloc>
+auto swap(ciel::btree_multimap<Key, T, Compare, Alloc>& lhs,
+          ciel::btree_multimap<Key, T, Compare, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_BTREE_MAP_HPP_
\ No newline at end of file
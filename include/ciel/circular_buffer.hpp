@@ -1075,7 +1075,7 @@ template<class T, class Alloc>
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 // So that we can test more efficiently
@@ -0,0 +1,702 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_COMPACT_AVL_HPP_
+#define CIELUTILS_INCLUDE_CIEL_COMPACT_AVL_HPP_
+
+#include <ciel/algorithm_impl/is_sorted.hpp>
+#include <ciel/algorithm_impl/max.hpp>
+#include <ciel/config.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/legacy_input_iterator.hpp>
+#include <ciel/iterator_impl/next.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+// compact_avl is an avl tree without parent pointers. A node only keeps two children and an int8_t height,
+// so a node of uint32_t takes 24 bytes, while avl_node<uint32_t> takes 32, and std::set's node takes 40.
+//
+// Without parents, an iterator carries the path from the root to its node in a small explicit stack.
+// It's larger than avl_iterator, and insertions and erasures invalidate all iterators since
+// rotations change the paths. Elements are never moved though, so pointers and references stay valid.
+
+template<class T>
+struct compact_avl_node {
+    compact_avl_node* left_;
+    compact_avl_node* right_;
+    int8_t height_;
+    T value_;
+
+    template<class... Args>
+    explicit compact_avl_node(Args&&... args)
+        : left_(nullptr), right_(nullptr), height_(1), value_(std::forward<Args>(args)...) {}
+
+    [[nodiscard]] static auto height(const compact_avl_node* node) noexcept -> int {
+        if (!node) {
+            return 0;
+        }
+        return node->height_;
+    }
+
+    auto height_adjust() noexcept -> void {
+        height_ = static_cast<int8_t>(1 + ciel::max(height(left_), height(right_)));
+    }
+
+};  // struct compact_avl_node
+
+template<class T>
+class compact_avl_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = const T*;
+    using reference         = const T&;
+    using iterator_category = bidirectional_iterator_tag;
+    using iterator_concept  = bidirectional_iterator_tag;
+
+    // An avl tree of height h has at least Fibonacci(h + 2) - 1 nodes, so height 64 needs more than 2.7e13 nodes.
+    static constexpr size_t max_height = 64;
+
+private:
+    using node_type         = compact_avl_node<value_type>;
+
+    // path_[0] is root_, path_[depth_ - 1] is the current node, and depth_ == 0 is end().
+    node_type* root_;
+    size_t depth_;
+    node_type* path_[max_height];
+
+    template<class, class, class>
+    friend class compact_avl;
+
+    auto push(node_type* node) noexcept -> void {
+        CIEL_PRECONDITION(depth_ < max_height);
+
+        path_[depth_++] = node;
+    }
+
+    auto push_min(node_type* node) noexcept -> void {
+        for (; node != nullptr; node = node->left_) {
+            push(node);
+        }
+    }
+
+    auto push_max(node_type* node) noexcept -> void {
+        for (; node != nullptr; node = node->right_) {
+            push(node);
+        }
+    }
+
+public:
+    compact_avl_iterator() noexcept : root_(nullptr), depth_(0) {}
+
+    explicit compact_avl_iterator(const node_type* root) noexcept
+        : root_(const_cast<node_type*>(root)), depth_(0) {}
+
+    // only copy the used part of the path
+    compact_avl_iterator(const compact_avl_iterator& other) noexcept
+        : root_(other.root_), depth_(other.depth_) {
+        for (size_t i = 0; i < depth_; ++i) {
+            path_[i] = other.path_[i];
+        }
+    }
+
+    auto operator=(const compact_avl_iterator& other) noexcept -> compact_avl_iterator& {
+        root_ = other.root_;
+        depth_ = other.depth_;
+        for (size_t i = 0; i < depth_; ++i) {
+            path_[i] = other.path_[i];
+        }
+        return *this;
+    }
+
+    ~compact_avl_iterator() = default;
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return base()->value_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return &base()->value_;
+    }
+
+    auto operator++() noexcept -> compact_avl_iterator& {
+        node_type* cur = path_[depth_ - 1];
+        if (cur->right_) {
+            push_min(cur->right_);
+            return *this;
+        }
+
+        // go up until coming from a left child
+        while (--depth_ > 0 && path_[depth_ - 1]->right_ == cur) {
+            cur = path_[depth_ - 1];
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> compact_avl_iterator {
+        compact_avl_iterator res(*this);
+        ++*this;
+        return res;
+    }
+
+    auto operator--() noexcept -> compact_avl_iterator& {
+        if (depth_ == 0) {
+            push_max(root_);
+            return *this;
+        }
+
+        node_type* cur = path_[depth_ - 1];
+        if (cur->left_) {
+            push_max(cur->left_);
+            return *this;
+        }
+
+        // go up until coming from a right child
+        while (--depth_ > 0 && path_[depth_ - 1]->left_ == cur) {
+            cur = path_[depth_ - 1];
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> compact_avl_iterator {
+        compact_avl_iterator res(*this);
+        --*this;
+        return res;
+    }
+
+    [[nodiscard]] auto base() const noexcept -> node_type* {
+        return depth_ == 0 ? nullptr : path_[depth_ - 1];
+    }
+
+};  // class compact_avl_iterator
+
+template<class T>
+[[nodiscard]] auto operator==(const compact_avl_iterator<T>& lhs, const compact_avl_iterator<T>& rhs) noexcept
+    -> bool {
+    return lhs.base() == rhs.base();
+}
+
+template<class T>
+[[nodiscard]] auto operator!=(const compact_avl_iterator<T>& lhs, const compact_avl_iterator<T>& rhs) noexcept
+    -> bool {
+    return !(lhs == rhs);
+}
+
+template<class T, class Compare, class Allocator>
+class compact_avl {
+public:
+    using value_type             = T;
+    using value_compare          = Compare;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using allocator_type         = Allocator;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
+    using iterator               = compact_avl_iterator<value_type>;
+    using const_iterator         = compact_avl_iterator<value_type>;
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    using node_type              = compact_avl_node<value_type>;
+
+    using alloc_traits           = allocator_traits<allocator_type>;
+    using node_allocator         = typename alloc_traits::template rebind_alloc<node_type>;
+    using node_alloc_traits      = typename alloc_traits::template rebind_traits<node_type>;
+
+    node_type* root_;
+    size_type size_;
+    [[no_unique_address]] node_allocator allocator_;
+    [[no_unique_address]] value_compare comp_;
+
+    template<class... Args>
+    [[nodiscard]] auto allocate_and_construct_node(Args&& ... args) -> node_type* {
+        node_type* new_node = node_alloc_traits::allocate(allocator_, 1);
+        CIEL_TRY {
+            node_alloc_traits::construct(allocator_, new_node, std::forward<Args>(args)...);
+        } CIEL_CATCH (...) {
+            node_alloc_traits::deallocate(allocator_, new_node, 1);
+            CIEL_THROW;
+        }
+        return new_node;
+    }
+
+    auto destroy_and_deallocate_node(node_type* node) noexcept -> void {
+        node_alloc_traits::destroy(allocator_, node);
+        node_alloc_traits::deallocate(allocator_, node, 1);
+    }
+
+    // depth: H
+    auto destroy_and_deallocate_root(node_type* root) noexcept -> void {
+        if (root) {
+            destroy_and_deallocate_root(root->left_);
+            destroy_and_deallocate_root(root->right_);
+            destroy_and_deallocate_node(root);
+        }
+    }
+
+    // Copy the exact shape of other, so no comparison or rebalancing is needed. depth: H
+    [[nodiscard]] auto clone(const node_type* other) -> node_type* {
+        if (!other) {
+            return nullptr;
+        }
+
+        node_type* node = allocate_and_construct_node(other->value_);
+        node->height_ = other->height_;
+        CIEL_TRY {
+            node->left_ = clone(other->left_);
+            node->right_ = clone(other->right_);
+        } CIEL_CATCH (...) {
+            destroy_and_deallocate_root(node);
+            CIEL_THROW;
+        }
+        return node;
+    }
+
+    // Build a perfectly balanced subtree from the next n unique elements in [first, last), see avl::build_subtree.
+    template<class Iter>
+    [[nodiscard]] auto build_subtree(Iter& first, Iter last, const size_type n) -> node_type* {
+        if (n == 0) {
+            return nullptr;
+        }
+
+        const size_type left_size = (n - 1) / 2;
+        node_type* left = build_subtree(first, last, left_size);
+
+        node_type* node = nullptr;
+        CIEL_TRY {
+            node = allocate_and_construct_node(*first);
+        } CIEL_CATCH (...) {
+            destroy_and_deallocate_root(left);
+            CIEL_THROW;
+        }
+        node->left_ = left;
+
+        CIEL_TRY {
+            ++first;
+            while (first != last && !comp_(node->value_, *first)) {
+                ++first;
+            }
+            node->right_ = build_subtree(first, last, n - 1 - left_size);
+        } CIEL_CATCH (...) {
+            destroy_and_deallocate_root(node);
+            CIEL_THROW;
+        }
+
+        node->height_adjust();
+        return node;
+    }
+
+    static auto rotate_left(node_type* head) noexcept -> node_type* {
+        node_type* new_head = head->right_;
+        head->right_ = new_head->left_;
+        new_head->left_ = head;
+        head->height_adjust();
+        new_head->height_adjust();
+        return new_head;
+    }
+
+    static auto rotate_right(node_type* head) noexcept -> node_type* {
+        node_type* new_head = head->left_;
+        head->left_ = new_head->right_;
+        new_head->right_ = head;
+        head->height_adjust();
+        new_head->height_adjust();
+        return new_head;
+    }
+
+    // Fix node whose children's heights differ by at most two, returns the new subtree root.
+    static auto balance(node_type* node) noexcept -> node_type* {
+        node->height_adjust();
+
+        const int diff = node_type::height(node->left_) - node_type::height(node->right_);
+        if (diff > 1) {
+            if (node_type::height(node->left_->left_) < node_type::height(node->left_->right_)) {
+                node->left_ = rotate_left(node->left_);
+            }
+            return rotate_right(node);
+        }
+        if (diff < -1) {
+            if (node_type::height(node->right_->right_) < node_type::height(node->right_->left_)) {
+                node->right_ = rotate_right(node->right_);
+            }
+            return rotate_left(node);
+        }
+        return node;
+    }
+
+    // Link new_node and returns it, or returns the equivalent node without linking new_node. depth: H
+    auto insert_node(node_type*& subtree, node_type* new_node) noexcept -> node_type* {
+        if (subtree == nullptr) {
+            subtree = new_node;
+            ++size_;
+            return new_node;
+        }
+
+        node_type* res = nullptr;
+        if (comp_(new_node->value_, subtree->value_)) {
+            res = insert_node(subtree->left_, new_node);
+
+        } else if (comp_(subtree->value_, new_node->value_)) {
+            res = insert_node(subtree->right_, new_node);
+
+        } else {
+            return subtree;
+        }
+
+        if (res == new_node) {
+            subtree = balance(subtree);
+        }
+        return res;
+    }
+
+    static auto unlink_min(node_type*& subtree) noexcept -> node_type* {
+        if (subtree->left_ == nullptr) {
+            node_type* res = subtree;
+            subtree = subtree->right_;
+            return res;
+        }
+
+        node_type* res = unlink_min(subtree->left_);
+        subtree = balance(subtree);
+        return res;
+    }
+
+    // Unlink the node equivalent to key and returns it, or nullptr if there is none. depth: H
+    template<class Key>
+    auto unlink_node(node_type*& subtree, const Key& key) noexcept -> node_type* {
+        if (subtree == nullptr) {
+            return nullptr;
+        }
+
+        node_type* res = nullptr;
+        if (comp_(key, subtree->value_)) {
+            res = unlink_node(subtree->left_, key);
+
+        } else if (comp_(subtree->value_, key)) {
+            res = unlink_node(subtree->right_, key);
+
+        } else {
+            res = subtree;
+            --size_;
+            if (res->left_ == nullptr) {
+                subtree = res->right_;
+                return res;
+            }
+            if (res->right_ == nullptr) {
+                subtree = res->left_;
+                return res;
+            }
+
+            // replace it by the next node
+            node_type* next = unlink_min(res->right_);
+            next->left_ = res->left_;
+            next->right_ = res->right_;
+            subtree = balance(next);
+            return res;
+        }
+
+        if (res) {
+            subtree = balance(subtree);
+        }
+        return res;
+    }
+
+    // The iterator pointing to node.
+    [[nodiscard]] auto locate(const node_type* node) const noexcept -> iterator {
+        return node == nullptr ? end() : lower_bound(node->value_);
+    }
+
+public:
+    compact_avl()
+        : root_(nullptr), size_(0), allocator_(), comp_() {}
+
+    explicit compact_avl(const value_compare& c, const allocator_type& alloc)
+        : root_(nullptr), size_(0), allocator_(alloc), comp_(c) {}
+
+    explicit compact_avl(const allocator_type& alloc)
+        : root_(nullptr), size_(0), allocator_(alloc), comp_() {}
+
+    template<legacy_input_iterator Iter>
+    compact_avl(false_type /*unused*/, Iter first, Iter last, const value_compare& c, const allocator_type& alloc)
+        : root_(nullptr), size_(0), allocator_(alloc), comp_(c) {
+        range_insert_unique(first, last);
+    }
+
+    compact_avl(const compact_avl& other)
+        : root_(nullptr), size_(0),
+          allocator_(node_alloc_traits::select_on_container_copy_construction(other.get_allocator())),
+          comp_(other.comp_) {
+        root_ = clone(other.root_);
+        size_ = other.size_;
+    }
+
+    compact_avl(const compact_avl& other, const allocator_type& alloc)
+        : root_(nullptr), size_(0), allocator_(alloc), comp_(other.comp_) {
+        root_ = clone(other.root_);
+        size_ = other.size_;
+    }
+
+    compact_avl(compact_avl&& other) noexcept
+        : root_(other.root_), size_(other.size_),
+          allocator_(std::move(other.allocator_)), comp_(std::move(other.comp_)) {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    compact_avl(compact_avl&& other, const allocator_type& alloc) noexcept
+        : root_(other.root_), size_(other.size_), allocator_(alloc), comp_(std::move(other.comp_)) {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    ~compact_avl() {
+        clear();
+    }
+
+    auto operator=(const compact_avl& other) -> compact_avl& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+
+        clear();
+        if (alloc_traits::propagate_on_container_copy_assignment::value) {
+            allocator_ = other.allocator_;
+        }
+        comp_ = other.comp_;
+        root_ = clone(other.root_);
+        size_ = other.size_;
+        return *this;
+    }
+
+    auto operator=(compact_avl&& other) noexcept(alloc_traits::propagate_on_container_move_assignment::value
+                                               || alloc_traits::is_always_equal::value) -> compact_avl& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+
+        clear();
+        comp_ = std::move(other.comp_);
+        if (!alloc_traits::propagate_on_container_move_assignment::value && allocator_ != other.allocator_) {
+            root_ = clone(other.root_);
+            size_ = other.size_;
+            return *this;
+        }
+
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        root_ = other.root_;
+        size_ = other.size_;
+        other.root_ = nullptr;
+        other.size_ = 0;
+        return *this;
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        const_iterator res(root_);
+        res.push_min(root_);
+        return res;
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator(root_);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return node_alloc_traits::max_size(allocator_);
+    }
+
+    [[nodiscard]] auto height() const noexcept -> size_t {
+        return static_cast<size_t>(node_type::height(root_));
+    }
+
+    auto clear() noexcept -> void {
+        destroy_and_deallocate_root(root_);
+        root_ = nullptr;
+        size_ = 0;
+    }
+
+    // When [first, last) is ordered range and the tree is empty, a balanced tree is built in N
+    template<legacy_input_iterator Iter>
+    auto range_insert_unique(Iter first, Iter last) -> void {
+        if constexpr (is_forward_iterator<Iter>::value) {
+            if (empty() && ciel::is_sorted(first, last, comp_)) {
+                size_type n = 0;
+                for (Iter it = first; it != last; ++n) {
+                    Iter prev = it;
+                    while (++it != last && !comp_(*prev, *it)) {}
+                }
+
+                root_ = build_subtree(first, last, n);
+                size_ = n;
+                return;
+            }
+        }
+
+        while (first != last) {
+            emplace_unique(*first);
+            ++first;
+        }
+    }
+
+    template<class... Args>
+    auto emplace_unique(Args&& ... args) -> pair<iterator, bool> {
+        node_type* new_node = allocate_and_construct_node(std::forward<Args>(args)...);
+        node_type* res = insert_node(root_, new_node);
+        if (res != new_node) {
+            destroy_and_deallocate_node(new_node);
+            return {locate(res), false};
+        }
+        return {locate(res), true};
+    }
+
+    // The hint doesn't help without parent pointers.
+    template<class... Args>
+    auto emplace_unique_hint(const_iterator /*unused*/, Args&& ... args) -> iterator {
+        return emplace_unique(std::forward<Args>(args)...).first;
+    }
+
+    auto erase(const_iterator pos) noexcept -> iterator {
+        CIEL_PRECONDITION(pos != end());
+
+        // the next node survives the erasure, but its path may be rotated, so look it up again
+        const node_type* next = ciel::next(pos).base();
+        destroy_and_deallocate_node(unlink_node(root_, *pos));
+        return locate(next);
+    }
+
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+        // iterators are invalidated by each erasure, but the node of last is kept
+        const node_type* last_node = last.base();
+        while (first.base() != last_node) {
+            first = erase(first);
+        }
+        return first;
+    }
+
+    template<class Key>
+    auto erase_unique(const Key& key) noexcept -> size_type {
+        node_type* node = unlink_node(root_, key);
+        if (node == nullptr) {
+            return 0;
+        }
+
+        destroy_and_deallocate_node(node);
+        return 1;
+    }
+
+    auto swap(compact_avl& other) noexcept -> void {
+        using std::swap;
+
+        swap(root_, other.root_);
+        swap(size_, other.size_);
+        swap(allocator_, other.allocator_);
+        swap(comp_, other.comp_);
+    }
+
+    template<class Key>
+    [[nodiscard]] auto count_unique(const Key& key) const noexcept -> size_type {
+        return static_cast<size_type>(contains(key));
+    }
+
+    template<class Key>
+    [[nodiscard]] auto find(const Key& key) const noexcept -> const_iterator {
+        const_iterator res = lower_bound(key);
+        if (res != end() && comp_(key, *res)) {
+            return end();
+        }
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto contains(const Key& key) const noexcept -> bool {
+        for (const node_type* node = root_; node != nullptr;) {
+            if (comp_(key, node->value_)) {
+                node = node->left_;
+
+            } else if (comp_(node->value_, key)) {
+                node = node->right_;
+
+            } else {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto equal_range(const Key& key) const noexcept -> pair<const_iterator, const_iterator> {
+        const_iterator first = find(key);
+        if (first == end()) {
+            return {first, first};
+        }
+        const_iterator last = first;
+        return {first, ++last};
+    }
+
+    // The path to the candidate is a prefix of the search path.
+    template<class Key>
+    [[nodiscard]] auto lower_bound(const Key& key) const noexcept -> const_iterator {
+        const_iterator res(root_);
+        size_t found = 0;
+        for (node_type* node = root_; node != nullptr;) {
+            res.push(node);
+            if (!comp_(node->value_, key)) {
+                found = res.depth_;
+                node = node->left_;
+
+            } else {
+                node = node->right_;
+            }
+        }
+        res.depth_ = found;
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto upper_bound(const Key& key) const noexcept -> const_iterator {
+        const_iterator res(root_);
+        size_t found = 0;
+        for (node_type* node = root_; node != nullptr;) {
+            res.push(node);
+            if (comp_(key, node->value_)) {
+                found = res.depth_;
+                node = node->left_;
+
+            } else {
+                node = node->right_;
+            }
+        }
+        res.depth_ = found;
+        return res;
+    }
+
+    [[nodiscard]] auto value_comp() const noexcept -> value_compare {
+        return comp_;
+    }
+
+};  // class compact_avl
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_COMPACT_AVL_HPP_
\ No newline at end of file
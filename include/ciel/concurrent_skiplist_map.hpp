@@ -0,0 +1,717 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_CONCURRENT_SKIPLIST_MAP_HPP_
+#define CIELUTILS_INCLUDE_CIEL_CONCURRENT_SKIPLIST_MAP_HPP_
+
+#include <atomic>
+#include <bit>  // for std::countr_zero
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/memory_impl/epoch_domain.hpp>
+#include <ciel/tuple.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+// A lock-free ordered map on a skiplist, all member functions but clear() may run concurrently.
+//
+// Following "A Pragmatic Implementation of Non-Blocking Linked-Lists" by Timothy L. Harris and
+// "Practical lock-freedom" by Keir Fraser, erasing a node first marks the low bit of its next pointers,
+// from the top level down to level 0, and whoever marks level 0 owns the erasure. Marked nodes are logically
+// deleted, every search snips the marked nodes on its path. Insertion links a node bottom-up, and it's present
+// once linked at level 0.
+//
+// A node may still be linked at upper levels by its inserter after being erased, so it's retired only after
+// both its inserter and its eraser are done with it, and each of them snips it from all levels before that.
+// Retired nodes are reclaimed by an epoch_domain, so readers never touch freed memory.
+//
+// Iterators pin the domain while they live, and must only be used by the thread that created them.
+// They skip erased elements, and see elements inserted concurrently or not, in key order either way.
+// Mapped values are not synchronized by the map.
+//
+// There is no at() or operator[]: a returned reference would outlive the pin, so a concurrent erase could
+// free the element under it. Hold the iterator from find() or try_emplace() instead.
+
+namespace details {
+
+struct skiplist_node_base {
+    // next_[i] is the successor at level i, with the low bit marking this node erased at that level
+    std::atomic<uintptr_t>* next_;
+    uint8_t height_;
+    // inserted_bit | erased_bit, the one who sets the second retires the node
+    std::atomic<uint8_t> state_;
+
+    static constexpr uint8_t inserted_bit = 1;
+    static constexpr uint8_t erased_bit = 2;
+
+    skiplist_node_base(std::atomic<uintptr_t>* next, const size_t height) noexcept
+        : next_(next), height_(static_cast<uint8_t>(height)), state_(0) {}
+
+};  // struct skiplist_node_base
+
+// The tower of next_ is allocated right after the node.
+template<class T>
+struct skiplist_node : skiplist_node_base {
+    T value_;
+
+    template<class... Args>
+    skiplist_node(std::atomic<uintptr_t>* next, const size_t height, Args&&... args)
+        : skiplist_node_base(next, height), value_(std::forward<Args>(args)...) {}
+
+};  // struct skiplist_node
+
+[[nodiscard]] inline auto skiplist_is_marked(const uintptr_t p) noexcept -> bool {
+    return (p & 1) != 0;
+}
+
+[[nodiscard]] inline auto skiplist_unmarked(const uintptr_t p) noexcept -> skiplist_node_base* {
+    return reinterpret_cast<skiplist_node_base*>(p & ~uintptr_t{1});
+}
+
+[[nodiscard]] inline auto skiplist_address(const skiplist_node_base* p) noexcept -> uintptr_t {
+    return reinterpret_cast<uintptr_t>(p);
+}
+
+}   // namespace details
+
+template<class T, class Pointer, class Reference>
+class skiplist_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = Pointer;
+    using reference         = Reference;
+    using iterator_category = forward_iterator_tag;
+    using iterator_concept  = forward_iterator_tag;
+
+private:
+    using base_node_type    = details::skiplist_node_base;
+    using node_type         = details::skiplist_node<value_type>;
+
+    epoch_guard guard_;
+    base_node_type* it_;
+
+    template<class, class, class>
+    friend class skiplist_iterator;
+
+public:
+    skiplist_iterator() noexcept
+        : guard_(), it_(nullptr) {}
+
+    // precondition: guard pins the domain of the map that p belongs to
+    skiplist_iterator(epoch_guard guard, const base_node_type* p) noexcept
+        : guard_(std::move(guard)), it_(const_cast<base_node_type*>(p)) {}
+
+    template<class P, class R>
+    skiplist_iterator(const skiplist_iterator<T, P, R>& other)
+        : guard_(other.guard_), it_(other.it_) {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return static_cast<node_type*>(it_)->value_;
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return &static_cast<node_type*>(it_)->value_;
+    }
+
+    // skip the erased ones
+    auto operator++() noexcept -> skiplist_iterator& {
+        do {
+            it_ = details::skiplist_unmarked(it_->next_[0].load(std::memory_order_acquire));
+        } while (it_ != nullptr && details::skiplist_is_marked(it_->next_[0].load(std::memory_order_acquire)));
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) -> skiplist_iterator {
+        skiplist_iterator res(*this);
+        ++*this;
+        return res;
+    }
+
+    [[nodiscard]] auto base() const noexcept -> base_node_type* {
+        return it_;
+    }
+
+};  // class skiplist_iterator
+
+template<class T, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator==(const skiplist_iterator<T, Pointer1, Reference1>& lhs,
+                              const skiplist_iterator<T, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return lhs.base() == rhs.base();
+}
+
+template<class T, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator!=(const skiplist_iterator<T, Pointer1, Reference1>& lhs,
+                              const skiplist_iterator<T, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+template<class Key, class T, class Compare = less<Key>, class Allocator = allocator<pair<const Key, T>>>
+class concurrent_skiplist_map {
+public:
+    using key_type        = Key;
+    using mapped_type     = T;
+    using value_type      = pair<const Key, T>;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using key_compare     = Compare;
+    using allocator_type  = Allocator;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer   = typename allocator_traits<allocator_type>::const_pointer;
+    using iterator        = skiplist_iterator<value_type, pointer, reference>;
+    using const_iterator  = skiplist_iterator<value_type, const_pointer, const_reference>;
+
+    // With p = 1/2 per level, 32 levels are enough for 2^32 elements.
+    static constexpr size_t max_height = 32;
+
+private:
+    using base_node_type  = details::skiplist_node_base;
+    using node_type       = details::skiplist_node<value_type>;
+    using link_type       = std::atomic<uintptr_t>;
+
+    // The allocation unit, a node and its tower take a whole number of them.
+    struct alignas(node_type) block {
+        unsigned char bytes_[alignof(node_type)];
+    };
+
+    using alloc_traits          = allocator_traits<allocator_type>;
+    using block_allocator       = typename alloc_traits::template rebind_alloc<block>;
+    using block_alloc_traits    = typename alloc_traits::template rebind_traits<block>;
+
+    link_type head_tower_[max_height];
+    base_node_type head_;
+    std::atomic<size_type> size_;
+    [[no_unique_address]] block_allocator allocator_;
+    [[no_unique_address]] key_compare comp_;
+    // Declared last so that it's destroyed first, its retired nodes need allocator_.
+    epoch_domain domain_;
+
+    [[nodiscard]] static auto block_count(const size_t height) noexcept -> size_t {
+        return (sizeof(node_type) + height * sizeof(link_type) + sizeof(block) - 1) / sizeof(block);
+    }
+
+    // xorshift64 per thread, the height is 1 + the number of trailing zeros, so p = 1/2 per level.
+    [[nodiscard]] static auto random_height() noexcept -> size_t {
+        thread_local uint64_t state = reinterpret_cast<uintptr_t>(&state) * 0x9E3779B97F4A7C15ULL | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<size_t>(std::countr_zero(state | (uint64_t{1} << (max_height - 1)))) + 1;
+    }
+
+    template<class... Args>
+    [[nodiscard]] auto allocate_and_construct_node(Args&& ... args) -> node_type* {
+        const size_t height = random_height();
+        block* p = block_alloc_traits::allocate(allocator_, block_count(height));
+        auto* tower = reinterpret_cast<link_type*>(reinterpret_cast<unsigned char*>(p) + sizeof(node_type));
+        for (size_t i = 0; i < height; ++i) {
+            ::new (tower + i) link_type(0);
+        }
+
+        CIEL_TRY {
+            return ::new (p) node_type(tower, height, std::forward<Args>(args)...);
+        } CIEL_CATCH (...) {
+            block_alloc_traits::deallocate(allocator_, p, block_count(height));
+            CIEL_THROW;
+        }
+    }
+
+    auto destroy_and_deallocate_node(base_node_type* node) noexcept -> void {
+        const size_t height = node->height_;
+        static_cast<node_type*>(node)->~node_type();
+        block_alloc_traits::deallocate(allocator_, reinterpret_cast<block*>(node), block_count(height));
+    }
+
+    static auto retired_node_deleter(void* context, void* p) noexcept -> void {
+        static_cast<concurrent_skiplist_map*>(context)->destroy_and_deallocate_node(
+            static_cast<base_node_type*>(p));
+    }
+
+    // Called by the inserter and the eraser when they are done, the second one retires node.
+    auto release(base_node_type* node, const uint8_t bit) -> void {
+        if (node->state_.fetch_or(bit, std::memory_order_acq_rel) != 0) {
+            domain_.retire(node, this, &retired_node_deleter);
+        }
+    }
+
+    template<class K>
+    [[nodiscard]] auto less_than_key(const base_node_type* node, const K& key) const -> bool {
+        return comp_(static_cast<const node_type*>(node)->value_.first, key);
+    }
+
+    template<class K>
+    [[nodiscard]] auto key_less_than(const K& key, const base_node_type* node) const -> bool {
+        return comp_(key, static_cast<const node_type*>(node)->value_.first);
+    }
+
+    // Fill preds and succs at every level, such that preds[i] < key <= succs[i], and snip marked nodes on the way.
+    // Returns the unmarked node equivalent to key at level 0, or nullptr.
+    // precondition: pinned
+    template<class K>
+    auto search(const K& key, base_node_type** preds, base_node_type** succs) -> base_node_type* {
+    retry:
+        base_node_type* pred = &head_;
+        base_node_type* curr = nullptr;
+        for (size_t level = max_height; level-- > 0;) {
+            curr = details::skiplist_unmarked(pred->next_[level].load(std::memory_order_acquire));
+            while (curr != nullptr) {
+                uintptr_t succ = curr->next_[level].load(std::memory_order_acquire);
+                while (details::skiplist_is_marked(succ)) {
+                    uintptr_t expected = details::skiplist_address(curr);
+                    if (!pred->next_[level].compare_exchange_strong(expected, succ & ~uintptr_t{1},
+                                                                     std::memory_order_acq_rel)) {
+                        goto retry;
+                    }
+                    curr = details::skiplist_unmarked(succ);
+                    if (curr == nullptr) {
+                        break;
+                    }
+                    succ = curr->next_[level].load(std::memory_order_acquire);
+                }
+
+                if (curr == nullptr || !less_than_key(curr, key)) {
+                    break;
+                }
+                pred = curr;
+                curr = details::skiplist_unmarked(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+
+        if (curr != nullptr && !key_less_than(key, curr)) {
+            return curr;
+        }
+        return nullptr;
+    }
+
+    // The first unmarked node not less than key at level 0, read only.
+    // Marked nodes are stepped over but never taken as pred, their frozen next_ may miss later insertions.
+    // precondition: pinned
+    template<class K>
+    [[nodiscard]] auto lower_bound_node(const K& key) const -> base_node_type* {
+        const base_node_type* pred = &head_;
+        base_node_type* curr = nullptr;
+        for (size_t level = max_height; level-- > 0;) {
+            curr = details::skiplist_unmarked(pred->next_[level].load(std::memory_order_acquire));
+            while (curr != nullptr) {
+                const uintptr_t succ = curr->next_[level].load(std::memory_order_acquire);
+                if (!details::skiplist_is_marked(succ)) {
+                    if (!less_than_key(curr, key)) {
+                        break;
+                    }
+                    pred = curr;
+                }
+                curr = details::skiplist_unmarked(succ);
+            }
+        }
+        return curr;
+    }
+
+    // Links node, or returns the existing equivalent node without linking it.
+    // precondition: pinned
+    auto insert_node(node_type* node) -> pair<base_node_type*, bool> {
+        base_node_type* preds[max_height];
+        base_node_type* succs[max_height];
+        const key_type& key = node->value_.first;
+
+        while (true) {
+            if (base_node_type* found = search(key, preds, succs)) {
+                return {found, false};
+            }
+
+            for (size_t i = 0; i < node->height_; ++i) {
+                node->next_[i].store(details::skiplist_address(succs[i]), std::memory_order_relaxed);
+            }
+
+            uintptr_t expected = details::skiplist_address(succs[0]);
+            if (preds[0]->next_[0].compare_exchange_strong(expected, details::skiplist_address(node),
+                                                            std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+
+        // Link the upper levels, stop once the node is being erased.
+        for (size_t level = 1; level < node->height_; ++level) {
+            while (true) {
+                uintptr_t next = node->next_[level].load(std::memory_order_acquire);
+                if (details::skiplist_is_marked(next)) {
+                    goto done;
+                }
+                if (next != details::skiplist_address(succs[level])
+                    && !node->next_[level].compare_exchange_strong(next, details::skiplist_address(succs[level]),
+                                                                    std::memory_order_acq_rel)) {
+                    goto done;
+                }
+
+                uintptr_t expected = details::skiplist_address(succs[level]);
+                if (preds[level]->next_[level].compare_exchange_strong(expected, details::skiplist_address(node),
+                                                                        std::memory_order_acq_rel)) {
+                    break;
+                }
+                search(key, preds, succs);
+                if (succs[0] != node) {
+                    // erased at level 0 already
+                    goto done;
+                }
+            }
+        }
+
+    done:
+        // An eraser may have missed the levels linked after its search.
+        if (details::skiplist_is_marked(node->next_[0].load(std::memory_order_acquire))) {
+            search(key, preds, succs);
+        }
+        release(node, base_node_type::inserted_bit);
+        return {node, true};
+    }
+
+    template<class... Args>
+    auto emplace_node(Args&& ... args) -> pair<iterator, bool> {
+        epoch_guard guard(domain_);
+        node_type* node = allocate_and_construct_node(std::forward<Args>(args)...);
+        auto [pos, inserted] = insert_node(node);
+        if (!inserted) {
+            destroy_and_deallocate_node(node);
+        }
+        return {iterator(std::move(guard), pos), inserted};
+    }
+
+    // Not thread-safe, destroy every node still linked at level 0, the others are retired already.
+    auto destroy_all() noexcept -> void {
+        base_node_type* node = details::skiplist_unmarked(head_.next_[0].load(std::memory_order_acquire));
+        while (node != nullptr) {
+            base_node_type* next = details::skiplist_unmarked(node->next_[0].load(std::memory_order_relaxed));
+            destroy_and_deallocate_node(node);
+            node = next;
+        }
+    }
+
+public:
+    concurrent_skiplist_map()
+        : concurrent_skiplist_map(key_compare(), allocator_type()) {}
+
+    explicit concurrent_skiplist_map(const key_compare& c, const allocator_type& alloc = allocator_type())
+        : head_tower_{}, head_(head_tower_, max_height), size_(0), allocator_(alloc), comp_(c) {}
+
+    explicit concurrent_skiplist_map(const allocator_type& alloc)
+        : concurrent_skiplist_map(key_compare(), alloc) {}
+
+    template<class Iter>
+    concurrent_skiplist_map(Iter first, Iter last, const key_compare& c = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+        : concurrent_skiplist_map(c, alloc) {
+        insert(first, last);
+    }
+
+    concurrent_skiplist_map(std::initializer_list<value_type> init, const key_compare& c = key_compare(),
+                            const allocator_type& alloc = allocator_type())
+        : concurrent_skiplist_map(init.begin(), init.end(), c, alloc) {}
+
+    concurrent_skiplist_map(const concurrent_skiplist_map&) = delete;
+    auto operator=(const concurrent_skiplist_map&) -> concurrent_skiplist_map& = delete;
+
+    // precondition: no other thread is using it
+    ~concurrent_skiplist_map() {
+        destroy_all();
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    [[nodiscard]] auto begin() -> iterator {
+        epoch_guard guard(domain_);
+        return iterator(std::move(guard), lower_bound_node_first());
+    }
+
+    [[nodiscard]] auto begin() const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).begin();
+    }
+
+    [[nodiscard]] auto cbegin() const -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return iterator();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    // Exact when no modification is in flight.
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return block_alloc_traits::max_size(allocator_) / block_count(1);
+    }
+
+    // Not thread-safe.
+    auto clear() noexcept -> void {
+        destroy_all();
+        for (link_type& link : head_tower_) {
+            link.store(0, std::memory_order_relaxed);
+        }
+        size_.store(0, std::memory_order_relaxed);
+    }
+
+    auto insert(const value_type& value) -> pair<iterator, bool> {
+        return emplace_node(value);
+    }
+
+    auto insert(value_type&& value) -> pair<iterator, bool> {
+        return emplace_node(std::move(value));
+    }
+
+    template<class Iter>
+    auto insert(Iter first, Iter last) -> void {
+        for (; first != last; ++first) {
+            static_cast<void>(emplace_node(*first));
+        }
+    }
+
+    auto insert(std::initializer_list<value_type> ilist) -> void {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    template<class... Args>
+    auto emplace(Args&& ... args) -> pair<iterator, bool> {
+        return emplace_node(std::forward<Args>(args)...);
+    }
+
+    // The element is only constructed when key is not found, though another thread may still win the insertion.
+    template<class... Args>
+    auto try_emplace(const key_type& key, Args&& ... args) -> pair<iterator, bool> {
+        if (iterator it = find(key); it != end()) {
+            return {std::move(it), false};
+        }
+        return emplace_node(piecewise_construct, ciel::forward_as_tuple(key),
+                            ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    auto try_emplace(key_type&& key, Args&& ... args) -> pair<iterator, bool> {
+        if (iterator it = find(key); it != end()) {
+            return {std::move(it), false};
+        }
+        return emplace_node(piecewise_construct, ciel::forward_as_tuple(std::move(key)),
+                            ciel::forward_as_tuple(std::forward<Args>(args)...));
+    }
+
+    auto erase(const key_type& key) -> size_type {
+        epoch_guard guard(domain_);
+        base_node_type* preds[max_height];
+        base_node_type* succs[max_height];
+
+        base_node_type* node = search(key, preds, succs);
+        if (node == nullptr) {
+            return 0;
+        }
+
+        for (size_t level = node->height_ - 1; level > 0; --level) {
+            uintptr_t next = node->next_[level].load(std::memory_order_acquire);
+            while (!details::skiplist_is_marked(next)
+                   && !node->next_[level].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {}
+        }
+
+        uintptr_t next = node->next_[0].load(std::memory_order_acquire);
+        while (true) {
+            if (details::skiplist_is_marked(next)) {
+                // erased by another thread
+                return 0;
+            }
+            if (node->next_[0].compare_exchange_weak(next, next | 1, std::memory_order_acq_rel)) {
+                break;
+            }
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+
+        search(key, preds, succs);
+        release(node, base_node_type::erased_bit);
+        return 1;
+    }
+
+    [[nodiscard]] auto count(const key_type& key) const -> size_type {
+        return static_cast<size_type>(contains(key));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const -> size_type {
+        return static_cast<size_type>(contains(x));
+    }
+
+    [[nodiscard]] auto find(const key_type& key) -> iterator {
+        return find_impl<iterator>(key);
+    }
+
+    [[nodiscard]] auto find(const key_type& key) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).template find_impl<const_iterator>(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) -> iterator {
+        return find_impl<iterator>(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).template find_impl<const_iterator>(x);
+    }
+
+    [[nodiscard]] auto contains(const key_type& key) const -> bool {
+        return contains_impl(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const -> bool {
+        return contains_impl(x);
+    }
+
+    [[nodiscard]] auto equal_range(const key_type& key) -> pair<iterator, iterator> {
+        return equal_range_impl(key);
+    }
+
+    [[nodiscard]] auto equal_range(const key_type& key) const -> pair<const_iterator, const_iterator> {
+        auto [first, last] = const_cast<concurrent_skiplist_map&>(*this).equal_range_impl(key);
+        return {first, last};
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) -> pair<iterator, iterator> {
+        return equal_range_impl(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const -> pair<const_iterator, const_iterator> {
+        auto [first, last] = const_cast<concurrent_skiplist_map&>(*this).equal_range_impl(x);
+        return {first, last};
+    }
+
+    [[nodiscard]] auto lower_bound(const key_type& key) -> iterator {
+        return lower_bound_impl(key);
+    }
+
+    [[nodiscard]] auto lower_bound(const key_type& key) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).lower_bound(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) -> iterator {
+        return lower_bound_impl(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).lower_bound(x);
+    }
+
+    [[nodiscard]] auto upper_bound(const key_type& key) -> iterator {
+        return upper_bound_impl(key);
+    }
+
+    [[nodiscard]] auto upper_bound(const key_type& key) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).upper_bound_impl(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) -> iterator {
+        return upper_bound_impl(x);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const -> const_iterator {
+        return const_cast<concurrent_skiplist_map&>(*this).upper_bound_impl(x);
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return comp_;
+    }
+
+private:
+    [[nodiscard]] auto lower_bound_node_first() const noexcept -> base_node_type* {
+        base_node_type* curr = details::skiplist_unmarked(head_.next_[0].load(std::memory_order_acquire));
+        while (curr != nullptr && details::skiplist_is_marked(curr->next_[0].load(std::memory_order_acquire))) {
+            curr = details::skiplist_unmarked(curr->next_[0].load(std::memory_order_acquire));
+        }
+        return curr;
+    }
+
+    template<class K>
+    [[nodiscard]] auto lower_bound_impl(const K& key) -> iterator {
+        epoch_guard guard(domain_);
+        base_node_type* node = lower_bound_node(key);
+        return iterator(std::move(guard), node);
+    }
+
+    template<class Iter, class K>
+    [[nodiscard]] auto find_impl(const K& key) -> Iter {
+        epoch_guard guard(domain_);
+        base_node_type* node = lower_bound_node(key);
+        if (node == nullptr || key_less_than(key, node)) {
+            return Iter();
+        }
+        return Iter(std::move(guard), node);
+    }
+
+    template<class K>
+    [[nodiscard]] auto equal_range_impl(const K& key) -> pair<iterator, iterator> {
+        iterator first = lower_bound_impl(key);
+        if (first == end() || key_less_than(key, first.base())) {
+            return {first, first};
+        }
+        iterator last = first;
+        return {std::move(first), ++last};
+    }
+
+    template<class K>
+    [[nodiscard]] auto upper_bound_impl(const K& key) -> iterator {
+        iterator res = lower_bound_impl(key);
+        if (res != end() && !key_less_than(key, res.base())) {
+            ++res;
+        }
+        return res;
+    }
+
+    template<class K>
+    [[nodiscard]] auto contains_impl(const K& key) const -> bool {
+        epoch_guard guard(const_cast<epoch_domain&>(domain_));
+        const base_node_type* node = lower_bound_node(key);
+        return node != nullptr && !key_less_than(key, node);
+    }
+
+};  // class concurrent_skiplist_map
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_CONCURRENT_SKIPLIST_MAP_HPP_
\ No newline at end of file
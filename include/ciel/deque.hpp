@@ -993,7 +993,7 @@ template<class T, class Alloc, size_t Size1, size_t Size2>
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 // So that we can test more efficiently
@@ -0,0 +1,8 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_EXECUTION_HPP_
+#define CIELUTILS_INCLUDE_CIEL_EXECUTION_HPP_
+
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/execution_impl/thread_pool.hpp>
+
+#endif // CIELUTILS_INCLUDE_CIEL_EXECUTION_HPP_
\ No newline at end of file
@@ -0,0 +1,124 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_EXECUTION_POLICY_HPP_
+#define CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_EXECUTION_POLICY_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/type_traits_impl/integral_constant.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <ciel/type_traits_impl/remove_cvref.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+class thread_pool;
+
+namespace execution {
+
+// Differences between std::execution policies and these classes:
+// Parallel policies can be bound to a thread_pool by on(pool), otherwise default_thread_pool() is used.
+// Parallel policies can be given a grain by with_grain(n): no piece of work handed to a thread is split
+// below n elements. 0 (the default) lets every algorithm choose its own.
+
+class sequenced_policy {};
+
+class parallel_policy {
+private:
+    thread_pool* pool_{nullptr};
+    size_t grain_{0};
+
+public:
+    constexpr parallel_policy() noexcept = default;
+
+    [[nodiscard]] constexpr auto on(thread_pool& pool) const noexcept -> parallel_policy {
+        parallel_policy res(*this);
+        res.pool_ = &pool;
+        return res;
+    }
+
+    [[nodiscard]] constexpr auto with_grain(const size_t grain) const noexcept -> parallel_policy {
+        parallel_policy res(*this);
+        res.grain_ = grain;
+        return res;
+    }
+
+    [[nodiscard]] constexpr auto pool() const noexcept -> thread_pool* {
+        return pool_;
+    }
+
+    [[nodiscard]] constexpr auto grain() const noexcept -> size_t {
+        return grain_;
+    }
+
+};  // class parallel_policy
+
+class parallel_unsequenced_policy {
+private:
+    thread_pool* pool_{nullptr};
+    size_t grain_{0};
+
+public:
+    constexpr parallel_unsequenced_policy() noexcept = default;
+
+    [[nodiscard]] constexpr auto on(thread_pool& pool) const noexcept -> parallel_unsequenced_policy {
+        parallel_unsequenced_policy res(*this);
+        res.pool_ = &pool;
+        return res;
+    }
+
+    [[nodiscard]] constexpr auto with_grain(const size_t grain) const noexcept -> parallel_unsequenced_policy {
+        parallel_unsequenced_policy res(*this);
+        res.grain_ = grain;
+        return res;
+    }
+
+    [[nodiscard]] constexpr auto pool() const noexcept -> thread_pool* {
+        return pool_;
+    }
+
+    [[nodiscard]] constexpr auto grain() const noexcept -> size_t {
+        return grain_;
+    }
+
+};  // class parallel_unsequenced_policy
+
+class unsequenced_policy {};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+inline constexpr unsequenced_policy unseq{};
+
+}   // namespace execution
+
+template<class T>
+struct is_execution_policy : false_type {};
+
+template<>
+struct is_execution_policy<execution::sequenced_policy> : true_type {};
+
+template<>
+struct is_execution_policy<execution::parallel_policy> : true_type {};
+
+template<>
+struct is_execution_policy<execution::parallel_unsequenced_policy> : true_type {};
+
+template<>
+struct is_execution_policy<execution::unsequenced_policy> : true_type {};
+
+template<class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+namespace details {
+
+template<class T>
+concept execution_policy = is_execution_policy_v<remove_cvref_t<T>>;
+
+// Policies which are allowed to run on multiple threads
+template<class T>
+concept parallel_execution_policy = is_same_v<remove_cvref_t<T>, execution::parallel_policy>
+    || is_same_v<remove_cvref_t<T>, execution::parallel_unsequenced_policy>;
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_EXECUTION_POLICY_HPP_
\ No newline at end of file
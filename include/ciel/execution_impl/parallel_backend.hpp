@@ -0,0 +1,129 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_PARALLEL_BACKEND_HPP_
+#define CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_PARALLEL_BACKEND_HPP_
+
+#include <atomic>
+#include <ciel/concepts_impl/integral.hpp>
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/thread_pool.hpp>
+#include <cstddef>
+#include <exception>
+#include <thread>
+
+NAMESPACE_CIEL_BEGIN
+
+namespace details {
+
+template<class ExecutionPolicy>
+[[nodiscard]] auto policy_pool(const ExecutionPolicy& policy) -> thread_pool& {
+    thread_pool* pool = policy.pool();
+    return pool ? *pool : default_thread_pool();
+}
+
+// Pieces smaller than this cost more to fork and join than they save, for most of element-wise operations
+constexpr size_t ParallelMinGrain = 1 << 12;
+
+// The grain of the policy, or about 4 pieces per thread so that stealing can balance uneven pieces
+template<class ExecutionPolicy>
+[[nodiscard]] auto policy_grain(const ExecutionPolicy& policy, const thread_pool& pool, const size_t n) -> size_t {
+    if (policy.grain() != 0) {
+        return policy.grain();
+    }
+    const size_t grain = n / (pool.concurrency() * 4);
+    return grain > ParallelMinGrain ? grain : ParallelMinGrain;
+}
+
+// Fork f2 to the pool, run f1 on current thread, then join f2.
+// Exceptions are propagated after both finished, f1's exception is preferred.
+template<class F1, class F2>
+auto parallel_invoke(thread_pool& pool, F1&& f1, F2&& f2) -> void {
+    std::atomic<bool> done{false};
+    std::exception_ptr f2_exception;
+
+    pool.submit([&]() noexcept {
+        CIEL_TRY {
+            f2();
+        } CIEL_CATCH (...) {
+            f2_exception = std::current_exception();
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    std::exception_ptr f1_exception;
+    CIEL_TRY {
+        f1();
+    } CIEL_CATCH (...) {
+        f1_exception = std::current_exception();
+    }
+
+    // Help running other tasks instead of blocking
+    while (!done.load(std::memory_order_acquire)) {
+        if (!pool.run_one()) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (f1_exception) {
+        std::rethrow_exception(f1_exception);
+    }
+    if (f2_exception) {
+        std::rethrow_exception(f2_exception);
+    }
+}
+
+// Recursively split [first, last) into halves until no larger than grain, call f(sub_first, sub_last) on each piece
+template<class Size, class F>
+auto parallel_for(thread_pool& pool, Size first, Size last, Size grain, F& f) -> void {
+    if (last - first <= grain) {
+        f(first, last);
+        return;
+    }
+    const Size mid = first + (last - first) / 2;
+    details::parallel_invoke(pool,
+                             [&] { details::parallel_for(pool, first, mid, grain, f); },
+                             [&] { details::parallel_for(pool, mid, last, grain, f); });
+}
+
+// Split [first, last) of a random access range into pieces by the policy's pool and grain,
+// call f(sub_first, sub_last) on each piece
+template<class ExecutionPolicy, class RandomIt, class F>
+auto parallel_for_pieces(const ExecutionPolicy& policy, RandomIt first, RandomIt last, F&& f) -> void {
+    thread_pool& pool = details::policy_pool(policy);
+    const size_t n = static_cast<size_t>(last - first);
+
+    auto piece = [first, &f](const size_t b, const size_t e) {
+        f(first + b, first + e);
+    };
+    details::parallel_for(pool, size_t(0), n, details::policy_grain(policy, pool, n), piece);
+}
+
+}   // namespace details
+
+// Call f(i) for every i in [first, last), in parallel unless the policy is sequenced or unsequenced
+template<class ExecutionPolicy, class Index, class F>
+    requires details::execution_policy<ExecutionPolicy> && integral<Index>
+auto parallel_for(ExecutionPolicy&& policy, const Index first, const Index last, F f) -> void {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy>) {
+        if (first >= last) {
+            return;
+        }
+        thread_pool& pool = details::policy_pool(policy);
+        const size_t n = static_cast<size_t>(last - first);
+
+        auto piece = [first, &f](const size_t b, const size_t e) {
+            for (size_t i = b; i != e; ++i) {
+                f(static_cast<Index>(first + static_cast<Index>(i)));
+            }
+        };
+        details::parallel_for(pool, size_t(0), n, details::policy_grain(policy, pool, n), piece);
+
+    } else {
+        for (Index i = first; i < last; ++i) {
+            f(i);
+        }
+    }
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_PARALLEL_BACKEND_HPP_
\ No newline at end of file
@@ -0,0 +1,190 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_THREAD_POOL_HPP_
+#define CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_THREAD_POOL_HPP_
+
+#include <atomic>
+#include <ciel/config.hpp>
+#include <ciel/deque.hpp>
+#include <ciel/functional_impl/function.hpp>
+#include <ciel/memory_impl/unique_ptr.hpp>
+#include <ciel/vector.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+NAMESPACE_CIEL_BEGIN
+
+// A work-stealing thread pool for fork-join parallelism.
+//
+// Every worker owns a task queue, tasks submitted by a worker go to the back of its own queue,
+// and tasks submitted by other threads go to an extra shared queue. A worker takes tasks from the back of its own
+// queue first (the most recently forked, so the hottest in cache), and steals from the front of other queues
+// (the oldest, so the largest pieces of work) when it runs out of tasks.
+//
+// Threads waiting for a forked task keep running other tasks by run_one() instead of blocking,
+// so nested fork-join never deadlocks, and a pool without workers still works on the waiting thread.
+
+class thread_pool {
+public:
+    using task_type = function<void()>;
+    using size_type = size_t;
+
+private:
+    struct task_queue {
+        std::mutex mutex_;
+        deque<task_type> tasks_;
+    };
+
+    vector<std::thread> workers_;
+    unique_ptr<task_queue[]> queues_;   // queues_[workers_.size()] is shared by non-worker threads
+    std::atomic<size_type> pending_{0};
+    std::atomic<size_type> sleeping_{0};
+    std::atomic<bool> stop_{false};
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_cv_;
+
+    inline static thread_local thread_pool* current_pool_ = nullptr;
+    inline static thread_local size_type current_index_ = 0;
+
+    [[nodiscard]] auto local_index() const noexcept -> size_type {
+        return current_pool_ == this ? current_index_ : workers_.size();
+    }
+
+    [[nodiscard]] auto pop_back(size_type index, task_type& task) -> bool {
+        task_queue& q = queues_[index];
+        std::lock_guard<std::mutex> lock(q.mutex_);
+        if (q.tasks_.empty()) {
+            return false;
+        }
+        task = std::move(q.tasks_.back());
+        q.tasks_.pop_back();
+        return true;
+    }
+
+    [[nodiscard]] auto steal_front(size_type index, task_type& task) -> bool {
+        task_queue& q = queues_[index];
+        std::unique_lock<std::mutex> lock(q.mutex_, std::try_to_lock);
+        if (!lock.owns_lock() || q.tasks_.empty()) {
+            return false;
+        }
+        task = std::move(q.tasks_.front());
+        q.tasks_.pop_front();
+        return true;
+    }
+
+    auto worker_loop(const size_type index) -> void {
+        current_pool_ = this;
+        current_index_ = index;
+
+        while (true) {
+            if (run_one()) {
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(sleep_mutex_);
+            sleeping_.fetch_add(1);
+            sleep_cv_.wait(lock, [this] { return stop_.load() || pending_.load() > 0; });
+            sleeping_.fetch_sub(1);
+
+            if (stop_.load() && pending_.load() == 0) {
+                return;
+            }
+        }
+    }
+
+public:
+    explicit thread_pool(const size_type worker_count = default_worker_count())
+        : queues_(make_unique<task_queue[]>(worker_count + 1)) {
+        workers_.reserve(worker_count);
+        for (size_type i = 0; i < worker_count; ++i) {
+            workers_.emplace_back([this, i] { worker_loop(i); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    auto operator=(const thread_pool&) -> thread_pool& = delete;
+
+    // All the submitted tasks are finished before destruction
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stop_.store(true);
+        }
+        sleep_cv_.notify_all();
+
+        for (std::thread& t : workers_) {
+            t.join();
+        }
+
+        task_type task;
+        while (pop_back(workers_.size(), task)) {
+            task();
+        }
+    }
+
+    // Hardware threads minus the one which submits tasks and helps while waiting
+    [[nodiscard]] static auto default_worker_count() noexcept -> size_type {
+        const size_type n = std::thread::hardware_concurrency();
+        return n > 1 ? n - 1 : 0;
+    }
+
+    [[nodiscard]] auto worker_count() const noexcept -> size_type {
+        return workers_.size();
+    }
+
+    // Worker threads plus the waiting thread
+    [[nodiscard]] auto concurrency() const noexcept -> size_type {
+        return workers_.size() + 1;
+    }
+
+    // task shall not throw
+    auto submit(task_type task) -> void {
+        // Count it first so that pending_ never underflows when it's taken by others immediately
+        pending_.fetch_add(1);
+        task_queue& q = queues_[local_index()];
+        {
+            std::lock_guard<std::mutex> lock(q.mutex_);
+            q.tasks_.push_back(std::move(task));
+        }
+
+        if (sleeping_.load() > 0) {
+            { std::lock_guard<std::mutex> lock(sleep_mutex_); }
+            sleep_cv_.notify_one();
+        }
+    }
+
+    // Run one task from local queue or steal one from others, return false when there is none
+    auto run_one() -> bool {
+        if (pending_.load() == 0) {
+            return false;
+        }
+
+        const size_type local = local_index();
+        const size_type queue_count = workers_.size() + 1;
+
+        task_type task;
+        bool found = pop_back(local, task);
+        for (size_type i = 1; !found && i < queue_count; ++i) {
+            found = steal_front((local + i) % queue_count, task);
+        }
+
+        if (!found) {
+            return false;
+        }
+
+        pending_.fetch_sub(1);
+        task();
+        return true;
+    }
+
+};  // class thread_pool
+
+// The pool used by parallel policies not bound to any pool
+[[nodiscard]] inline auto default_thread_pool() -> thread_pool& {
+    static thread_pool pool;
+    return pool;
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_EXECUTION_IMPL_THREAD_POOL_HPP_
\ No newline at end of file
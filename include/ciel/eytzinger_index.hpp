@@ -0,0 +1,187 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_EYTZINGER_INDEX_HPP_
+#define CIELUTILS_INCLUDE_CIEL_EYTZINGER_INDEX_HPP_
+
+#include <bit>  // for std::countr_one
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/prefetch.hpp>
+#include <ciel/type_traits_impl/is_base_of.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// A read-only search index over sorted elements, stored in Eytzinger (BFS) order:
+// the root is at 1, and the children of k are 2k and 2k + 1 (the 1-based index k is stored at data_[k - 1]).
+//
+// Binary search on a sorted array touches a different cache line on nearly every level,
+// and the probes of the next level are far apart. In Eytzinger order the first levels are packed together
+// and stay in cache, and all the descendants of k at the same level are contiguous, so one prefetch
+// brings in the next few levels. Every loop is k = 2k + (element < key), which has no branch to mispredict.
+//
+// lower_bound and upper_bound return the pointer to the found element, or nullptr if there is none.
+
+template<class T, class Compare = less<T>, class Allocator = allocator<T>>
+class eytzinger_index {
+public:
+    using value_type      = T;
+    using key_compare     = Compare;
+    using allocator_type  = Allocator;
+    using size_type       = size_t;
+    using difference_type = ptrdiff_t;
+    using const_reference = const value_type&;
+    using const_pointer   = const value_type*;
+
+private:
+    vector<value_type, allocator_type> data_;
+    [[no_unique_address]] key_compare comp_;
+
+    // Descendants of k four levels below start at 16k, prefetch the cache line holding them.
+    // When value_type is large, fewer of them fit in one cache line.
+    static constexpr size_type prefetch_multiplier = sizeof(value_type) <= 4 ? 16
+                                                   : sizeof(value_type) <= 8 ? 8
+                                                   : sizeof(value_type) <= 16 ? 4 : 1;
+
+    // Fills the subtree rooted at k by an in-order traversal, which visits the nodes in sorted order.
+    // ranks[k - 1] is set to the rank of node k.
+    static auto build_ranks(vector<size_type>& ranks, size_type k, size_type& rank) -> void {
+        const size_type n = ranks.size();
+        while (k <= n) {
+            build_ranks(ranks, 2 * k, rank);
+            ranks[k - 1] = rank++;
+            k = 2 * k + 1;
+        }
+    }
+
+    template<class RandomIt>
+    auto build(RandomIt first, const size_type n) -> void {
+        vector<size_type> ranks(n);
+        size_type rank = 0;
+        build_ranks(ranks, 1, rank);
+
+        data_.reserve(n);
+        for (size_type k = 0; k < n; ++k) {
+            data_.emplace_back(first[ranks[k]]);
+        }
+    }
+
+    // The last loop goes left at the result, and then right at every level until it falls out of the tree.
+    // Cancelling those right turns (trailing ones) and the last left turn gives the result.
+    [[nodiscard]] auto to_pointer(size_type k) const noexcept -> const_pointer {
+        k >>= std::countr_one(k) + 1;
+        return k == 0 ? nullptr : data_.data() + (k - 1);
+    }
+
+    template<class Pred>
+    [[nodiscard]] auto search(Pred pred) const -> const_pointer {
+        const size_type n = data_.size();
+        const_pointer data = data_.data();
+
+        size_type k = 1;
+        while (k <= n) {
+            if (k * prefetch_multiplier <= n) {
+                details::prefetch(data + (k * prefetch_multiplier - 1));
+            }
+            k = 2 * k + static_cast<size_type>(pred(data[k - 1]));
+        }
+        return to_pointer(k);
+    }
+
+public:
+    eytzinger_index() = default;
+
+    explicit eytzinger_index(const key_compare& comp, const allocator_type& alloc = allocator_type())
+        : data_(alloc), comp_(comp) {}
+
+    explicit eytzinger_index(const allocator_type& alloc) : data_(alloc), comp_() {}
+
+    // precondition: [first, last) is sorted by comp
+    template<class Iter>
+    eytzinger_index(Iter first, Iter last, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+        : data_(alloc), comp_(comp) {
+        using category = typename iterator_traits<Iter>::iterator_category;
+
+        if constexpr (is_base_of_v<random_access_iterator_tag, category>) {
+            build(first, static_cast<size_type>(last - first));
+
+        } else {
+            const vector<value_type, allocator_type> sorted(first, last, alloc);
+            build(sorted.begin(), sorted.size());
+        }
+    }
+
+    // precondition: init is sorted by comp
+    eytzinger_index(std::initializer_list<value_type> init, const key_compare& comp = key_compare(),
+                    const allocator_type& alloc = allocator_type())
+        : eytzinger_index(init.begin(), init.end(), comp, alloc) {}
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return data_.get_allocator();
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return comp_;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return data_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return data_.size();
+    }
+
+    // Elements in Eytzinger order
+    [[nodiscard]] auto data() const noexcept -> const_pointer {
+        return data_.data();
+    }
+
+    // The first element not less than key
+    template<class K>
+    [[nodiscard]] auto lower_bound(const K& key) const -> const_pointer {
+        return search([&](const value_type& element) -> bool {
+            return comp_(element, key);
+        });
+    }
+
+    // The first element greater than key
+    template<class K>
+    [[nodiscard]] auto upper_bound(const K& key) const -> const_pointer {
+        return search([&](const value_type& element) -> bool {
+            return !comp_(key, element);
+        });
+    }
+
+    template<class K>
+    [[nodiscard]] auto contains(const K& key) const -> bool {
+        const const_pointer p = lower_bound(key);
+        return p != nullptr && !comp_(key, *p);
+    }
+
+    auto clear() noexcept -> void {
+        data_.clear();
+    }
+
+    auto swap(eytzinger_index& other) noexcept -> void {
+        data_.swap(other.data_);
+        std::swap(comp_, other.comp_);
+    }
+
+};  // class eytzinger_index
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, class Compare, class Allocator>
+auto swap(ciel::eytzinger_index<T, Compare, Allocator>& lhs,
+          ciel::eytzinger_index<T, Compare, Allocator>& rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_EYTZINGER_INDEX_HPP_
\ No newline at end of file
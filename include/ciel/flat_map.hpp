@@ -0,0 +1,870 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_FLAT_MAP_HPP_
+#define CIELUTILS_INCLUDE_CIEL_FLAT_MAP_HPP_
+
+#include <ciel/algorithm_impl/lower_bound.hpp>
+#include <ciel/algorithm_impl/stable_sort.hpp>
+#include <ciel/algorithm_impl/upper_bound.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/tuple.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <ciel/utility_impl/piecewise_construct.hpp>
+#include <ciel/utility_impl/sorted_unique.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+// C++23 flat_map, keys and mapped values are kept in two sorted sequence containers.
+//
+// Lookups only touch the keys, which are densely packed no matter how large the mapped type is,
+// and go through ciel::lower_bound, which is branchless and prefetches both possible probes.
+// Bulk insertions append, sort the new elements through an index permutation (keys and values live apart)
+// and merge them with the old ones in O(N + M log M) instead of shifting for each element.
+// Iterators are invalidated by every insertion and erasure.
+
+namespace details {
+
+// Dereferencing returns pair<const Key&, T&> by value, so operator-> has to keep it alive.
+template<class Reference>
+class flat_map_arrow_proxy {
+private:
+    Reference ref_;
+
+public:
+    explicit flat_map_arrow_proxy(Reference ref) noexcept
+        : ref_(ref) {}
+
+    [[nodiscard]] auto operator->() noexcept -> Reference* {
+        return ciel::addressof(ref_);
+    }
+
+};  // class flat_map_arrow_proxy
+
+template<class KeyIter, class MappedIter>
+class flat_map_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = pair<typename iterator_traits<KeyIter>::value_type,
+                                   typename iterator_traits<MappedIter>::value_type>;
+    using reference         = pair<typename iterator_traits<KeyIter>::reference,
+                                   typename iterator_traits<MappedIter>::reference>;
+    using pointer           = flat_map_arrow_proxy<reference>;
+    using iterator_category = random_access_iterator_tag;
+
+private:
+    KeyIter key_;
+    MappedIter mapped_;
+
+public:
+    flat_map_iterator() noexcept = default;
+
+    flat_map_iterator(KeyIter key, MappedIter mapped) noexcept
+        : key_(key), mapped_(mapped) {}
+
+    template<class MI>
+        requires is_convertible_v<MI, MappedIter>
+    flat_map_iterator(const flat_map_iterator<KeyIter, MI>& other) noexcept
+        : key_(other.key_iterator()), mapped_(other.mapped_iterator()) {}
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return reference(*key_, *mapped_);
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return pointer(**this);
+    }
+
+    [[nodiscard]] auto operator[](const difference_type n) const noexcept -> reference {
+        return *(*this + n);
+    }
+
+    auto operator++() noexcept -> flat_map_iterator& {
+        ++key_;
+        ++mapped_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> flat_map_iterator {
+        flat_map_iterator res(*this);
+        ++(*this);
+        return res;
+    }
+
+    auto operator--() noexcept -> flat_map_iterator& {
+        --key_;
+        --mapped_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> flat_map_iterator {
+        flat_map_iterator res(*this);
+        --(*this);
+        return res;
+    }
+
+    auto operator+=(const difference_type n) noexcept -> flat_map_iterator& {
+        key_ += n;
+        mapped_ += n;
+        return *this;
+    }
+
+    auto operator-=(const difference_type n) noexcept -> flat_map_iterator& {
+        return *this += -n;
+    }
+
+    [[nodiscard]] auto operator+(const difference_type n) const noexcept -> flat_map_iterator {
+        flat_map_iterator res(*this);
+        res += n;
+        return res;
+    }
+
+    [[nodiscard]] auto operator-(const difference_type n) const noexcept -> flat_map_iterator {
+        return *this + (-n);
+    }
+
+    [[nodiscard]] friend auto operator+(const difference_type n, const flat_map_iterator& it) noexcept
+        -> flat_map_iterator {
+        return it + n;
+    }
+
+    [[nodiscard]] auto key_iterator() const noexcept -> KeyIter {
+        return key_;
+    }
+
+    [[nodiscard]] auto mapped_iterator() const noexcept -> MappedIter {
+        return mapped_;
+    }
+
+};  // class flat_map_iterator
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator==(const flat_map_iterator<KeyIter, MI1>& lhs,
+                              const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return lhs.key_iterator() == rhs.key_iterator();
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator!=(const flat_map_iterator<KeyIter, MI1>& lhs,
+                              const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator<(const flat_map_iterator<KeyIter, MI1>& lhs,
+                             const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return lhs.key_iterator() < rhs.key_iterator();
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator>(const flat_map_iterator<KeyIter, MI1>& lhs,
+                             const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return rhs < lhs;
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator<=(const flat_map_iterator<KeyIter, MI1>& lhs,
+                              const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return !(rhs < lhs);
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator>=(const flat_map_iterator<KeyIter, MI1>& lhs,
+                              const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> bool {
+    return !(lhs < rhs);
+}
+
+template<class KeyIter, class MI1, class MI2>
+[[nodiscard]] auto operator-(const flat_map_iterator<KeyIter, MI1>& lhs,
+                             const flat_map_iterator<KeyIter, MI2>& rhs) noexcept -> ptrdiff_t {
+    return lhs.key_iterator() - rhs.key_iterator();
+}
+
+}   // namespace details
+
+template<class Key, class T, class Compare = less<Key>, class KeyContainer = vector<Key>,
+         class MappedContainer = vector<T>>
+class flat_map {
+    static_assert(is_same_v<Key, typename KeyContainer::value_type>);
+    static_assert(is_same_v<T, typename MappedContainer::value_type>);
+
+public:
+    using key_type                = Key;
+    using mapped_type             = T;
+    using value_type              = pair<key_type, mapped_type>;
+    using key_compare             = Compare;
+    using reference               = pair<const key_type&, mapped_type&>;
+    using const_reference         = pair<const key_type&, const mapped_type&>;
+    using size_type               = size_t;
+    using difference_type         = ptrdiff_t;
+    using iterator                = details::flat_map_iterator<typename KeyContainer::const_iterator,
+                                                               typename MappedContainer::iterator>;
+    using const_iterator          = details::flat_map_iterator<typename KeyContainer::const_iterator,
+                                                               typename MappedContainer::const_iterator>;
+    using reverse_iterator        = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator  = ciel::reverse_iterator<const_iterator>;
+    using key_container_type      = KeyContainer;
+    using mapped_container_type   = MappedContainer;
+
+    class value_compare {
+    private:
+        [[no_unique_address]] key_compare comp_;
+
+        explicit value_compare(const key_compare& c) : comp_(c) {}
+
+        friend flat_map;
+
+    public:
+        [[nodiscard]] auto operator()(const_reference lhs, const_reference rhs) const -> bool {
+            return comp_(lhs.first, rhs.first);
+        }
+
+    };  // class value_compare
+
+    struct containers {
+        key_container_type keys;
+        mapped_container_type values;
+    };
+
+private:
+    key_container_type keys_;
+    mapped_container_type values_;
+    [[no_unique_address]] key_compare compare_;
+
+    [[nodiscard]] auto make_iterator(const size_type i) noexcept -> iterator {
+        return iterator(keys_.cbegin() + static_cast<difference_type>(i),
+                        values_.begin() + static_cast<difference_type>(i));
+    }
+
+    [[nodiscard]] auto make_iterator(const size_type i) const noexcept -> const_iterator {
+        return const_iterator(keys_.cbegin() + static_cast<difference_type>(i),
+                              values_.cbegin() + static_cast<difference_type>(i));
+    }
+
+    [[nodiscard]] auto index_of(const const_iterator pos) const noexcept -> size_type {
+        return static_cast<size_type>(pos.key_iterator() - keys_.cbegin());
+    }
+
+    template<class K>
+    [[nodiscard]] auto key_lower_bound(const K& x) const -> size_type {
+        return static_cast<size_type>(ciel::lower_bound(keys_.begin(), keys_.end(), x, compare_) - keys_.begin());
+    }
+
+    template<class K>
+    [[nodiscard]] auto key_upper_bound(const K& x) const -> size_type {
+        return static_cast<size_type>(ciel::upper_bound(keys_.begin(), keys_.end(), x, compare_) - keys_.begin());
+    }
+
+    template<class K>
+    [[nodiscard]] auto key_find(const K& x) const -> size_type {
+        const size_type i = key_lower_bound(x);
+        if (i == size() || compare_(x, keys_[i])) {
+            return size();
+        }
+        return i;
+    }
+
+    template<class K, class... Args>
+    auto insert_at(const size_type i, K&& key, Args&& ... args) -> iterator {
+        const auto key_pos = keys_.begin() + static_cast<difference_type>(i);
+        const auto mapped_pos = values_.begin() + static_cast<difference_type>(i);
+        keys_.emplace(key_pos, std::forward<K>(key));
+        CIEL_TRY {
+            values_.emplace(mapped_pos, std::forward<Args>(args)...);
+        }
+        CIEL_CATCH (...) {
+            keys_.erase(keys_.begin() + static_cast<difference_type>(i));
+            CIEL_THROW;
+        }
+        return make_iterator(i);
+    }
+
+    template<class K, class... Args>
+    auto try_emplace_impl(K&& key, Args&& ... args) -> pair<iterator, bool> {
+        const size_type i = key_lower_bound(key);
+        if (i != size() && !compare_(key, keys_[i])) {
+            return {make_iterator(i), false};
+        }
+        return {insert_at(i, std::forward<K>(key), std::forward<Args>(args)...), true};
+    }
+
+    template<class K, class... Args>
+    auto try_emplace_hint_impl(const const_iterator hint, K&& key, Args&& ... args) -> iterator {
+        const size_type i = index_of(hint);
+        if ((i == 0 || compare_(keys_[i - 1], key)) && (i == size() || compare_(key, keys_[i]))) {
+            return insert_at(i, std::forward<K>(key), std::forward<Args>(args)...);
+        }
+        return try_emplace_impl(std::forward<K>(key), std::forward<Args>(args)...).first;
+    }
+
+    // Elements in [old_size, size()) are new ones. Sort them by key through an index permutation,
+    // unless they are already sorted, and merge them into [0, old_size).
+    // Old elements win over new ones with equivalent keys, earlier new elements win over later ones.
+    auto merge_from(const size_type old_size, const bool sorted) -> void {
+        const size_type n = size();
+        vector<size_type> order;
+        order.reserve(n - old_size);
+        for (size_type i = old_size; i < n; ++i) {
+            order.emplace_back(i);
+        }
+        if (!sorted) {
+            ciel::stable_sort(order.begin(), order.end(), [this](const size_type lhs, const size_type rhs) {
+                return compare_(keys_[lhs], keys_[rhs]);
+            });
+        }
+
+        key_container_type keys;
+        mapped_container_type values;
+        keys.reserve(n);
+        values.reserve(n);
+
+        auto push = [&](const size_type i) {
+            keys.emplace_back(std::move(keys_[i]));
+            values.emplace_back(std::move(values_[i]));
+        };
+
+        size_type i = 0;
+        size_type j = 0;
+        while (i < old_size && j < order.size()) {
+            if (compare_(keys_[order[j]], keys_[i])) {
+                if (keys.empty() || compare_(keys.back(), keys_[order[j]])) {
+                    push(order[j]);
+                }
+                ++j;
+
+            } else {
+                push(i++);
+            }
+        }
+        for (; i < old_size; ++i) {
+            push(i);
+        }
+        for (; j < order.size(); ++j) {
+            if (keys.empty() || compare_(keys.back(), keys_[order[j]])) {
+                push(order[j]);
+            }
+        }
+
+        keys_ = std::move(keys);
+        values_ = std::move(values);
+    }
+
+    template<class Iter>
+    auto append(Iter first, Iter last) -> void {
+        for (; first != last; ++first) {
+            // Converts *first to value_type once, so that proxies like our own reference work too
+            value_type value(*first);
+            keys_.emplace_back(std::move(value.first));
+            CIEL_TRY {
+                values_.emplace_back(std::move(value.second));
+            }
+            CIEL_CATCH (...) {
+                keys_.pop_back();
+                CIEL_THROW;
+            }
+        }
+    }
+
+public:
+    flat_map() : keys_(), values_(), compare_() {}
+
+    explicit flat_map(const key_compare& comp) : keys_(), values_(), compare_(comp) {}
+
+    // precondition: key_cont.size() == mapped_cont.size()
+    flat_map(key_container_type key_cont, mapped_container_type mapped_cont,
+             const key_compare& comp = key_compare())
+        : keys_(std::move(key_cont)), values_(std::move(mapped_cont)), compare_(comp) {
+        CIEL_PRECONDITION(keys_.size() == values_.size());
+        merge_from(0, false);
+    }
+
+    // precondition: key_cont.size() == mapped_cont.size(), key_cont is sorted and unique
+    flat_map(sorted_unique_t /*unused*/, key_container_type key_cont, mapped_container_type mapped_cont,
+             const key_compare& comp = key_compare())
+        : keys_(std::move(key_cont)), values_(std::move(mapped_cont)), compare_(comp) {
+        CIEL_PRECONDITION(keys_.size() == values_.size());
+    }
+
+    template<class Iter>
+    flat_map(Iter first, Iter last, const key_compare& comp = key_compare())
+        : keys_(), values_(), compare_(comp) {
+        insert(first, last);
+    }
+
+    template<class Iter>
+    flat_map(sorted_unique_t s, Iter first, Iter last, const key_compare& comp = key_compare())
+        : keys_(), values_(), compare_(comp) {
+        insert(s, first, last);
+    }
+
+    flat_map(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_map(init.begin(), init.end(), comp) {}
+
+    flat_map(sorted_unique_t s, std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_map(s, init.begin(), init.end(), comp) {}
+
+    auto operator=(std::initializer_list<value_type> ilist) -> flat_map& {
+        clear();
+        insert(ilist);
+        return *this;
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return make_iterator(0);
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return make_iterator(0);
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return make_iterator(size());
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return make_iterator(size());
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return keys_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return keys_.size();
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return keys_.max_size() < values_.max_size() ? keys_.max_size() : values_.max_size();
+    }
+
+    [[nodiscard]] auto operator[](const key_type& key) -> mapped_type& {
+        return try_emplace(key).first->second;
+    }
+
+    [[nodiscard]] auto operator[](key_type&& key) -> mapped_type& {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    [[nodiscard]] auto at(const key_type& key) -> mapped_type& {
+        const size_type i = key_find(key);
+        if (i == size()) {
+            THROW(std::out_of_range("key not found in ciel::flat_map::at"));
+        }
+        return values_[i];
+    }
+
+    [[nodiscard]] auto at(const key_type& key) const -> const mapped_type& {
+        const size_type i = key_find(key);
+        if (i == size()) {
+            THROW(std::out_of_range("key not found in ciel::flat_map::at"));
+        }
+        return values_[i];
+    }
+
+    template<class... Args>
+    auto emplace(Args&& ... args) -> pair<iterator, bool> {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace_impl(std::move(value.first), std::move(value.second));
+    }
+
+    template<class... Args>
+    auto emplace_hint(const_iterator hint, Args&& ... args) -> iterator {
+        value_type value(std::forward<Args>(args)...);
+        return try_emplace_hint_impl(hint, std::move(value.first), std::move(value.second));
+    }
+
+    auto insert(const value_type& value) -> pair<iterator, bool> {
+        return try_emplace_impl(value.first, value.second);
+    }
+
+    auto insert(value_type&& value) -> pair<iterator, bool> {
+        return try_emplace_impl(std::move(value.first), std::move(value.second));
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P>
+    auto insert(P&& value) -> pair<iterator, bool> {
+        return emplace(std::forward<P>(value));
+    }
+
+    auto insert(const_iterator hint, const value_type& value) -> iterator {
+        return try_emplace_hint_impl(hint, value.first, value.second);
+    }
+
+    auto insert(const_iterator hint, value_type&& value) -> iterator {
+        return try_emplace_hint_impl(hint, std::move(value.first), std::move(value.second));
+    }
+
+    template<class P>
+        requires is_constructible_v<value_type, P>
+    auto insert(const_iterator hint, P&& value) -> iterator {
+        return emplace_hint(hint, std::forward<P>(value));
+    }
+
+    template<class Iter>
+    auto insert(Iter first, Iter last) -> void {
+        const size_type old_size = size();
+        append(first, last);
+        merge_from(old_size, false);
+    }
+
+    // precondition: [first, last) is sorted and unique
+    template<class Iter>
+    auto insert(sorted_unique_t /*unused*/, Iter first, Iter last) -> void {
+        const size_type old_size = size();
+        append(first, last);
+        // Appending greater keys, which is how sorted input usually arrives, needs no merge at all
+        if (old_size != 0 && old_size != size() && !compare_(keys_[old_size - 1], keys_[old_size])) {
+            merge_from(old_size, true);
+        }
+    }
+
+    auto insert(std::initializer_list<value_type> ilist) -> void {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    auto insert(sorted_unique_t s, std::initializer_list<value_type> ilist) -> void {
+        insert(s, ilist.begin(), ilist.end());
+    }
+
+    template<class... Args>
+    auto try_emplace(const key_type& key, Args&& ... args) -> pair<iterator, bool> {
+        return try_emplace_impl(key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    auto try_emplace(key_type&& key, Args&& ... args) -> pair<iterator, bool> {
+        return try_emplace_impl(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    auto try_emplace(const_iterator hint, const key_type& key, Args&& ... args) -> iterator {
+        return try_emplace_hint_impl(hint, key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    auto try_emplace(const_iterator hint, key_type&& key, Args&& ... args) -> iterator {
+        return try_emplace_hint_impl(hint, std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    auto insert_or_assign(const key_type& key, M&& obj) -> pair<iterator, bool> {
+        auto res = try_emplace_impl(key, std::forward<M>(obj));
+        if (!res.second) {
+            res.first->second = std::forward<M>(obj);
+        }
+        return res;
+    }
+
+    template<class M>
+    auto insert_or_assign(key_type&& key, M&& obj) -> pair<iterator, bool> {
+        auto res = try_emplace_impl(std::move(key), std::forward<M>(obj));
+        if (!res.second) {
+            res.first->second = std::forward<M>(obj);
+        }
+        return res;
+    }
+
+    template<class M>
+    auto insert_or_assign(const_iterator hint, const key_type& key, M&& obj) -> iterator {
+        const size_type i = key_find(key);
+        if (i != size()) {
+            values_[i] = std::forward<M>(obj);
+            return make_iterator(i);
+        }
+        return try_emplace_hint_impl(hint, key, std::forward<M>(obj));
+    }
+
+    template<class M>
+    auto insert_or_assign(const_iterator hint, key_type&& key, M&& obj) -> iterator {
+        const size_type i = key_find(key);
+        if (i != size()) {
+            values_[i] = std::forward<M>(obj);
+            return make_iterator(i);
+        }
+        return try_emplace_hint_impl(hint, std::move(key), std::forward<M>(obj));
+    }
+
+    [[nodiscard]] auto extract() && -> containers {
+        containers res{std::move(keys_), std::move(values_)};
+        clear();
+        return res;
+    }
+
+    // precondition: key_cont.size() == mapped_cont.size(), key_cont is sorted and unique
+    auto replace(key_container_type&& key_cont, mapped_container_type&& mapped_cont) -> void {
+        CIEL_PRECONDITION(key_cont.size() == mapped_cont.size());
+        keys_ = std::move(key_cont);
+        values_ = std::move(mapped_cont);
+    }
+
+    auto erase(const_iterator pos) -> iterator {
+        return erase(pos, pos + 1);
+    }
+
+    auto erase(iterator pos) -> iterator {
+        return erase(const_iterator(pos));
+    }
+
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        const size_type i = index_of(first);
+        const size_type j = index_of(last);
+        keys_.erase(keys_.begin() + static_cast<difference_type>(i), keys_.begin() + static_cast<difference_type>(j));
+        values_.erase(values_.begin() + static_cast<difference_type>(i),
+                      values_.begin() + static_cast<difference_type>(j));
+        return make_iterator(i);
+    }
+
+    auto erase(const key_type& key) -> size_type {
+        const size_type i = key_find(key);
+        if (i == size()) {
+            return 0;
+        }
+        erase(make_iterator(i));
+        return 1;
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    auto erase(K&& x) -> size_type {
+        const size_type first = key_lower_bound(x);
+        const size_type last = key_upper_bound(x);
+        erase(make_iterator(first), make_iterator(last));
+        return last - first;
+    }
+
+    auto swap(flat_map& other) noexcept -> void {
+        using std::swap;
+        swap(keys_, other.keys_);
+        swap(values_, other.values_);
+        swap(compare_, other.compare_);
+    }
+
+    auto clear() noexcept -> void {
+        keys_.clear();
+        values_.clear();
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return compare_;
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return value_compare(compare_);
+    }
+
+    [[nodiscard]] auto keys() const noexcept -> const key_container_type& {
+        return keys_;
+    }
+
+    [[nodiscard]] auto values() const noexcept -> const mapped_container_type& {
+        return values_;
+    }
+
+    [[nodiscard]] auto find(const key_type& key) -> iterator {
+        return make_iterator(key_find(key));
+    }
+
+    [[nodiscard]] auto find(const key_type& key) const -> const_iterator {
+        return make_iterator(key_find(key));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) -> iterator {
+        return make_iterator(key_find(x));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const -> const_iterator {
+        return make_iterator(key_find(x));
+    }
+
+    [[nodiscard]] auto count(const key_type& key) const -> size_type {
+        return contains(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const -> size_type {
+        return key_upper_bound(x) - key_lower_bound(x);
+    }
+
+    [[nodiscard]] auto contains(const key_type& key) const -> bool {
+        return key_find(key) != size();
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const -> bool {
+        return key_find(x) != size();
+    }
+
+    [[nodiscard]] auto lower_bound(const key_type& key) -> iterator {
+        return make_iterator(key_lower_bound(key));
+    }
+
+    [[nodiscard]] auto lower_bound(const key_type& key) const -> const_iterator {
+        return make_iterator(key_lower_bound(key));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) -> iterator {
+        return make_iterator(key_lower_bound(x));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const -> const_iterator {
+        return make_iterator(key_lower_bound(x));
+    }
+
+    [[nodiscard]] auto upper_bound(const key_type& key) -> iterator {
+        return make_iterator(key_upper_bound(key));
+    }
+
+    [[nodiscard]] auto upper_bound(const key_type& key) const -> const_iterator {
+        return make_iterator(key_upper_bound(key));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) -> iterator {
+        return make_iterator(key_upper_bound(x));
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const -> const_iterator {
+        return make_iterator(key_upper_bound(x));
+    }
+
+    [[nodiscard]] auto equal_range(const key_type& key) -> pair<iterator, iterator> {
+        const size_type i = key_find(key);
+        if (i == size()) {
+            return {lower_bound(key), lower_bound(key)};
+        }
+        return {make_iterator(i), make_iterator(i + 1)};
+    }
+
+    [[nodiscard]] auto equal_range(const key_type& key) const -> pair<const_iterator, const_iterator> {
+        const size_type i = key_find(key);
+        if (i == size()) {
+            return {lower_bound(key), lower_bound(key)};
+        }
+        return {make_iterator(i), make_iterator(i + 1)};
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) -> pair<iterator, iterator> {
+        return {lower_bound(x), upper_bound(x)};
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const -> pair<const_iterator, const_iterator> {
+        return {lower_bound(x), upper_bound(x)};
+    }
+
+};  // class flat_map
+
+template<class Key, class T, class Compare, class KeyContainer, class MappedContainer>
+[[nodiscard]] auto operator==(const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& lhs,
+                              const flat_map<Key, T, Compare, KeyContainer, MappedContainer>& rhs) -> bool {
+    return lhs.keys() == rhs.keys() && lhs.values() == rhs.values();
+}
+
+template<class Key, class T, class Compare, class KeyContainer, class MappedContainer, class Pred>
+auto erase_if(flat_map<Key, T, Compare, KeyContainer, MappedContainer>& c, Pred pred)
+    -> typename flat_map<Key, T, Compare, KeyContainer, MappedContainer>::size_type {
+    // Removing keeps the order, so the remaining elements can be put back without sorting
+    auto cont = std::move(c).extract();
+    const size_t old_size = cont.keys.size();
+    size_t j = 0;
+    for (size_t i = 0; i < old_size; ++i) {
+        if (!pred(pair<const Key&, T&>(cont.keys[i], cont.values[i]))) {
+            if (i != j) {
+                cont.keys[j] = std::move(cont.keys[i]);
+                cont.values[j] = std::move(cont.values[i]);
+            }
+            ++j;
+        }
+    }
+    cont.keys.erase(cont.keys.begin() + static_cast<ptrdiff_t>(j), cont.keys.end());
+    cont.values.erase(cont.values.begin() + static_cast<ptrdiff_t>(j), cont.values.end());
+    c.replace(std::move(cont.keys), std::move(cont.values));
+    return old_size - j;
+}
+
+template<class KeyContainer, class MappedContainer, class Compare = less<typename KeyContainer::value_type>>
+flat_map(KeyContainer, MappedContainer, Compare = Compare())
+    -> flat_map<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer,
+                MappedContainer>;
+
+template<class KeyContainer, class MappedContainer, class Compare = less<typename KeyContainer::value_type>>
+flat_map(sorted_unique_t, KeyContainer, MappedContainer, Compare = Compare())
+    -> flat_map<typename KeyContainer::value_type, typename MappedContainer::value_type, Compare, KeyContainer,
+                MappedContainer>;
+
+template<class Key, class T, class Compare = less<Key>>
+flat_map(std::initializer_list<pair<Key, T>>, Compare = Compare()) -> flat_map<Key, T, Compare>;
+
+template<class Key, class T, class Compare = less<Key>>
+flat_map(sorted_unique_t, std::initializer_list<pair<Key, T>>, Compare = Compare()) -> flat_map<Key, T, Compare>;
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class Key, class T, class Compare, class KeyContainer, class MappedContainer>
+auto swap(ciel::flat_map<Key, T, Compare, KeyContainer, MappedContainer>& lhs,
+          ciel::flat_map<Key, T, Compare, KeyContainer, MappedContainer>& rhs) noexcept(noexcept(lhs.swap(rhs)))
+    -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_FLAT_MAP_HPP_
\ No newline at end of file
@@ -0,0 +1,425 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_FLAT_SET_HPP_
+#define CIELUTILS_INCLUDE_CIEL_FLAT_SET_HPP_
+
+#include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/lower_bound.hpp>
+#include <ciel/algorithm_impl/remove_if.hpp>
+#include <ciel/algorithm_impl/sort.hpp>
+#include <ciel/algorithm_impl/unique.hpp>
+#include <ciel/algorithm_impl/upper_bound.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <ciel/utility_impl/sorted_unique.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+// C++23 flat_set, a sorted and unique sequence container adaptor.
+//
+// Lookups are ciel::lower_bound on contiguous memory, which is branchless and prefetches both possible probes.
+// Single insertions and erasures shift elements, bulk insertions append, sort the new elements
+// and merge them with the old ones in O(N + M log M) instead of shifting for each element.
+// Iterators are invalidated by every insertion and erasure.
+
+template<class Key, class Compare = less<Key>, class KeyContainer = vector<Key>>
+class flat_set {
+    static_assert(is_same_v<Key, typename KeyContainer::value_type>);
+
+public:
+    using key_type               = Key;
+    using value_type             = Key;
+    using key_compare            = Compare;
+    using value_compare          = Compare;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using size_type              = typename KeyContainer::size_type;
+    using difference_type        = typename KeyContainer::difference_type;
+    using iterator               = typename KeyContainer::const_iterator;
+    using const_iterator         = typename KeyContainer::const_iterator;
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+    using container_type         = KeyContainer;
+
+private:
+    container_type c_;
+    [[no_unique_address]] key_compare compare_;
+
+    [[nodiscard]] auto equivalent(const key_type& lhs, const key_type& rhs) const -> bool {
+        return !compare_(lhs, rhs) && !compare_(rhs, lhs);
+    }
+
+    [[nodiscard]] auto mutable_iterator(const const_iterator pos) -> typename container_type::iterator {
+        return c_.begin() + (pos - c_.cbegin());
+    }
+
+    // Elements in [old_size, size()) are new ones, which are already sorted and unique when sorted is true.
+    // Merge them into [0, old_size), new elements equivalent to old ones are dropped.
+    auto merge_from(const size_type old_size, const bool sorted) -> void {
+        const auto mid = c_.begin() + static_cast<difference_type>(old_size);
+        if (!sorted) {
+            ciel::sort(mid, c_.end(), compare_);
+            c_.erase(ciel::unique(mid, c_.end(), [this](const key_type& lhs, const key_type& rhs) {
+                return equivalent(lhs, rhs);
+            }), c_.end());
+        }
+
+        // Appending greater elements, which is how sorted input usually arrives, needs no merge at all
+        if (old_size == 0 || old_size == c_.size() || compare_(c_[old_size - 1], c_[old_size])) {
+            return;
+        }
+
+        container_type merged;
+        merged.reserve(c_.size());
+        auto first1 = c_.begin();
+        auto first2 = c_.begin() + static_cast<difference_type>(old_size);
+        const auto last1 = first2;
+        const auto last2 = c_.end();
+        while (first1 != last1 && first2 != last2) {
+            if (compare_(*first2, *first1)) {
+                merged.emplace_back(std::move(*first2++));
+
+            } else {
+                if (!compare_(*first1, *first2)) {
+                    ++first2;
+                }
+                merged.emplace_back(std::move(*first1++));
+            }
+        }
+        for (; first1 != last1; ++first1) {
+            merged.emplace_back(std::move(*first1));
+        }
+        for (; first2 != last2; ++first2) {
+            merged.emplace_back(std::move(*first2));
+        }
+        c_ = std::move(merged);
+    }
+
+public:
+    flat_set() : c_(), compare_() {}
+
+    explicit flat_set(const key_compare& comp) : c_(), compare_(comp) {}
+
+    explicit flat_set(container_type cont, const key_compare& comp = key_compare())
+        : c_(std::move(cont)), compare_(comp) {
+        merge_from(0, false);
+    }
+
+    flat_set(sorted_unique_t /*unused*/, container_type cont, const key_compare& comp = key_compare())
+        : c_(std::move(cont)), compare_(comp) {}
+
+    template<class Iter>
+    flat_set(Iter first, Iter last, const key_compare& comp = key_compare()) : c_(), compare_(comp) {
+        insert(first, last);
+    }
+
+    template<class Iter>
+    flat_set(sorted_unique_t s, Iter first, Iter last, const key_compare& comp = key_compare())
+        : c_(), compare_(comp) {
+        insert(s, first, last);
+    }
+
+    flat_set(std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_set(init.begin(), init.end(), comp) {}
+
+    flat_set(sorted_unique_t s, std::initializer_list<value_type> init, const key_compare& comp = key_compare())
+        : flat_set(s, init.begin(), init.end(), comp) {}
+
+    auto operator=(std::initializer_list<value_type> ilist) -> flat_set& {
+        clear();
+        insert(ilist);
+        return *this;
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return c_.begin();
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return c_.end();
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return c_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return c_.size();
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return c_.max_size();
+    }
+
+    template<class... Args>
+    auto emplace(Args&& ... args) -> pair<iterator, bool> {
+        value_type value(std::forward<Args>(args)...);
+        const auto pos = lower_bound(value);
+        if (pos != end() && !compare_(value, *pos)) {
+            return {pos, false};
+        }
+        return {c_.insert(mutable_iterator(pos), std::move(value)), true};
+    }
+
+    // If value belongs right before hint, no search is done
+    template<class... Args>
+    auto emplace_hint(const_iterator hint, Args&& ... args) -> iterator {
+        value_type value(std::forward<Args>(args)...);
+        if ((hint == begin() || compare_(*(hint - 1), value)) && (hint == end() || compare_(value, *hint))) {
+            return c_.insert(mutable_iterator(hint), std::move(value));
+        }
+        return emplace(std::move(value)).first;
+    }
+
+    auto insert(const value_type& value) -> pair<iterator, bool> {
+        return emplace(value);
+    }
+
+    auto insert(value_type&& value) -> pair<iterator, bool> {
+        return emplace(std::move(value));
+    }
+
+    auto insert(const_iterator hint, const value_type& value) -> iterator {
+        return emplace_hint(hint, value);
+    }
+
+    auto insert(const_iterator hint, value_type&& value) -> iterator {
+        return emplace_hint(hint, std::move(value));
+    }
+
+    template<class Iter>
+    auto insert(Iter first, Iter last) -> void {
+        const size_type old_size = size();
+        c_.insert(c_.end(), first, last);
+        merge_from(old_size, false);
+    }
+
+    // precondition: [first, last) is sorted and unique
+    template<class Iter>
+    auto insert(sorted_unique_t /*unused*/, Iter first, Iter last) -> void {
+        const size_type old_size = size();
+        c_.insert(c_.end(), first, last);
+        merge_from(old_size, true);
+    }
+
+    auto insert(std::initializer_list<value_type> ilist) -> void {
+        insert(ilist.begin(), ilist.end());
+    }
+
+    auto insert(sorted_unique_t s, std::initializer_list<value_type> ilist) -> void {
+        insert(s, ilist.begin(), ilist.end());
+    }
+
+    [[nodiscard]] auto extract() && -> container_type {
+        container_type res = std::move(c_);
+        c_.clear();
+        return res;
+    }
+
+    // precondition: cont is sorted and unique
+    auto replace(container_type&& cont) -> void {
+        c_ = std::move(cont);
+    }
+
+    auto erase(const_iterator pos) -> iterator {
+        return c_.erase(mutable_iterator(pos));
+    }
+
+    auto erase(const_iterator first, const_iterator last) -> iterator {
+        return c_.erase(mutable_iterator(first), mutable_iterator(last));
+    }
+
+    auto erase(const key_type& key) -> size_type {
+        const auto pos = find(key);
+        if (pos == end()) {
+            return 0;
+        }
+        erase(pos);
+        return 1;
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    auto erase(K&& x) -> size_type {
+        const auto er = equal_range(x);
+        const size_type res = er.second - er.first;
+        erase(er.first, er.second);
+        return res;
+    }
+
+    auto swap(flat_set& other) noexcept -> void {
+        using std::swap;
+        swap(c_, other.c_);
+        swap(compare_, other.compare_);
+    }
+
+    auto clear() noexcept -> void {
+        c_.clear();
+    }
+
+    [[nodiscard]] auto key_comp() const -> key_compare {
+        return compare_;
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return compare_;
+    }
+
+    [[nodiscard]] auto find(const key_type& key) const -> const_iterator {
+        const auto pos = lower_bound(key);
+        if (pos == end() || compare_(key, *pos)) {
+            return end();
+        }
+        return pos;
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const -> const_iterator {
+        const auto pos = lower_bound(x);
+        if (pos == end() || compare_(x, *pos)) {
+            return end();
+        }
+        return pos;
+    }
+
+    [[nodiscard]] auto count(const key_type& key) const -> size_type {
+        return contains(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const -> size_type {
+        const auto er = equal_range(x);
+        return er.second - er.first;
+    }
+
+    [[nodiscard]] auto contains(const key_type& key) const -> bool {
+        return find(key) != end();
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const -> bool {
+        return find(x) != end();
+    }
+
+    [[nodiscard]] auto lower_bound(const key_type& key) const -> const_iterator {
+        return ciel::lower_bound(begin(), end(), key, compare_);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const -> const_iterator {
+        return ciel::lower_bound(begin(), end(), x, compare_);
+    }
+
+    [[nodiscard]] auto upper_bound(const key_type& key) const -> const_iterator {
+        return ciel::upper_bound(begin(), end(), key, compare_);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const -> const_iterator {
+        return ciel::upper_bound(begin(), end(), x, compare_);
+    }
+
+    [[nodiscard]] auto equal_range(const key_type& key) const -> pair<const_iterator, const_iterator> {
+        const auto first = lower_bound(key);
+        if (first == end() || compare_(key, *first)) {
+            return {first, first};
+        }
+        return {first, first + 1};
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const -> pair<const_iterator, const_iterator> {
+        return {lower_bound(x), upper_bound(x)};
+    }
+
+};  // class flat_set
+
+template<class Key, class Compare, class KeyContainer>
+[[nodiscard]] auto operator==(const flat_set<Key, Compare, KeyContainer>& lhs,
+                              const flat_set<Key, Compare, KeyContainer>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class Key, class Compare, class KeyContainer, class Pred>
+auto erase_if(flat_set<Key, Compare, KeyContainer>& c, Pred pred)
+    -> typename flat_set<Key, Compare, KeyContainer>::size_type {
+    // Removing keeps the order, so the remaining elements can be put back without sorting
+    auto cont = std::move(c).extract();
+    const auto old_size = cont.size();
+    cont.erase(ciel::remove_if(cont.begin(), cont.end(), pred), cont.end());
+    const auto res = old_size - cont.size();
+    c.replace(std::move(cont));
+    return res;
+}
+
+template<class KeyContainer, class Compare = less<typename KeyContainer::value_type>>
+flat_set(KeyContainer, Compare = Compare()) -> flat_set<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+template<class KeyContainer, class Compare = less<typename KeyContainer::value_type>>
+flat_set(sorted_unique_t, KeyContainer, Compare = Compare())
+    -> flat_set<typename KeyContainer::value_type, Compare, KeyContainer>;
+
+template<class Iter, class Compare = less<typename iterator_traits<Iter>::value_type>>
+flat_set(Iter, Iter, Compare = Compare()) -> flat_set<typename iterator_traits<Iter>::value_type, Compare>;
+
+template<class Iter, class Compare = less<typename iterator_traits<Iter>::value_type>>
+flat_set(sorted_unique_t, Iter, Iter, Compare = Compare())
+    -> flat_set<typename iterator_traits<Iter>::value_type, Compare>;
+
+template<class Key, class Compare = less<Key>>
+flat_set(std::initializer_list<Key>, Compare = Compare()) -> flat_set<Key, Compare>;
+
+template<class Key, class Compare = less<Key>>
+flat_set(sorted_unique_t, std::initializer_list<Key>, Compare = Compare()) -> flat_set<Key, Compare>;
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class Key, class Compare, class KeyContainer>
+auto swap(ciel::flat_set<Key, Compare, KeyContainer>& lhs,
+          ciel::flat_set<Key, Compare, KeyContainer>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_FLAT_SET_HPP_
\ No newline at end of file
@@ -1,7 +1,10 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_FORWARD_LIST_HPP_
 #define CIELUTILS_INCLUDE_CIEL_FORWARD_LIST_HPP_
 
+#include <ciel/algorithm_impl/list_merge_sort.hpp>
 #include <ciel/config.hpp>
+#include <ciel/functional_impl/equal_to.hpp>
+#include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/iterator_traits.hpp>
 #include <ciel/iterator_impl/next.hpp>
 #include <ciel/memory_impl/allocator.hpp>
@@ -10,8 +13,6 @@
 
 NAMESPACE_CIEL_BEGIN
 
-// TODO: operations like merge and sort
-
 // To keep the struct lightweight, we don't have a size() in forward_list.
 // Different from list, forward_list is not a circle, which makes end() == iterator(nullptr)
 
@@ -209,6 +210,22 @@ private:
         }
     }
 
+    auto destroy_chain(base_node_type* node) noexcept -> void {
+        while (node != nullptr) {
+            auto* to_be_destroyed = static_cast<node_type*>(node);
+            node = node->next_;
+            node_alloc_traits::destroy(allocator_, to_be_destroyed);
+            node_alloc_traits::deallocate(allocator_, to_be_destroyed, 1);
+        }
+    }
+
+    template<class Compare>
+    [[nodiscard]] static auto node_less(Compare& comp) noexcept {
+        return [&comp](base_node_type* lhs, base_node_type* rhs) -> bool {
+            return comp(static_cast<node_type*>(lhs)->value_, static_cast<node_type*>(rhs)->value_);
+        };
+    }
+
 public:
     forward_list()
         : allocator_() {}
@@ -450,24 +467,146 @@ public:
 
     auto resize(const size_type count) -> void {
         if (const size_type s = size(); s >= count) {
-            iterator tmp = next(before_begin(), count);
+            iterator tmp = ciel::next(before_begin(), count);
             alloc_range_destroy_and_deallocate(tmp, end());
         } else {
-            iterator tmp = next(before_begin(), s);
+            iterator tmp = ciel::next(before_begin(), s);
             alloc_range_allocate_and_construct_n(tmp, count - s);
         }
     }
 
     auto resize(const size_type count, const value_type& value) -> void {
         if (const size_type s = size(); s >= count) {
-            iterator tmp = next(before_begin(), count);
+            iterator tmp = ciel::next(before_begin(), count);
             alloc_range_destroy_and_deallocate(tmp, end());
         } else {
-            iterator tmp = next(before_begin(), s);
+            iterator tmp = ciel::next(before_begin(), s);
             alloc_range_allocate_and_construct_n(tmp, count - s, value);
         }
     }
 
+    // Operations below relink nodes, no element is copied, moved or allocated.
+    // If a comparison throws, every element is still in the list, in unspecified order.
+
+    // Both lists are sorted, elements of other go after equivalent ones of *this.
+    // precondition: get_allocator() == other.get_allocator()
+    template<class Compare>
+    auto merge(forward_list& other, Compare comp) -> void {
+        CIEL_PRECONDITION(allocator_ == other.allocator_);
+
+        if (this == ciel::addressof(other)) {
+            return;
+        }
+
+        auto less = node_less(comp);
+        details::merge_chains(before_begin_.next_, other.before_begin_.next_, less);
+    }
+
+    template<class Compare>
+    auto merge(forward_list&& other, Compare comp) -> void {
+        merge(other, comp);
+    }
+
+    auto merge(forward_list& other) -> void {
+        merge(other, ciel::less<>());
+    }
+
+    auto merge(forward_list&& other) -> void {
+        merge(other, ciel::less<>());
+    }
+
+    // Stable bottom-up merge sort, O(N log N) comparisons.
+    template<class Compare>
+    auto sort(Compare comp) -> void {
+        details::merge_sort_chain(before_begin_.next_, node_less(comp));
+    }
+
+    auto sort() -> void {
+        sort(ciel::less<>());
+    }
+
+    // Removed nodes are destroyed at last, since the argument of remove() may refer to one of them.
+    template<class Pred>
+    auto remove_if(Pred pred) -> size_type {
+        base_node_type* removed = nullptr;
+        size_type count = 0;
+
+        CIEL_TRY {
+            base_node_type* prev = &before_begin_;
+            while (prev->next_ != nullptr) {
+                base_node_type* node = prev->next_;
+                if (pred(static_cast<node_type*>(node)->value_)) {
+                    prev->next_ = node->next_;
+                    node->next_ = removed;
+                    removed = node;
+                    ++count;
+                } else {
+                    prev = node;
+                }
+            }
+
+        } CIEL_CATCH (...) {
+            destroy_chain(removed);
+            CIEL_THROW;
+        }
+
+        destroy_chain(removed);
+        return count;
+    }
+
+    auto remove(const T& value) -> size_type {
+        return remove_if([&](const T& elem) { return elem == value; });
+    }
+
+    // Keeps the first element of every group of consecutive equivalent elements.
+    template<class BinaryPred>
+    auto unique(BinaryPred pred) -> size_type {
+        base_node_type* kept = before_begin_.next_;
+        if (kept == nullptr) {
+            return 0;
+        }
+
+        base_node_type* removed = nullptr;
+        size_type count = 0;
+
+        CIEL_TRY {
+            while (kept->next_ != nullptr) {
+                base_node_type* node = kept->next_;
+                if (pred(static_cast<node_type*>(kept)->value_, static_cast<node_type*>(node)->value_)) {
+                    kept->next_ = node->next_;
+                    node->next_ = removed;
+                    removed = node;
+                    ++count;
+                } else {
+                    kept = node;
+                }
+            }
+
+        } CIEL_CATCH (...) {
+            destroy_chain(removed);
+            CIEL_THROW;
+        }
+
+        destroy_chain(removed);
+        return count;
+    }
+
+    auto unique() -> size_type {
+        return unique(ciel::equal_to<>());
+    }
+
+    auto reverse() noexcept -> void {
+        base_node_type* res = nullptr;
+        base_node_type* node = before_begin_.next_;
+        while (node != nullptr) {
+            base_node_type* next = node->next_;
+            node->next_ = res;
+            res = node;
+            node = next;
+        }
+        before_begin_.next_ = res;
+    }
+
     auto swap(forward_list& other) noexcept(alloc_traits::is_always_equal::value) -> void {
         using std::swap;
         swap(before_begin_, other.before_begin_);
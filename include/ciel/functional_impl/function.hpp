@@ -170,7 +170,7 @@ public:
     function(F f) {
         using func_type = details::func<F, R(Args...)>;
         if (not_null(f)) {
-            if constexpr (is_small_object<F>::value) {
+            if constexpr (is_small_object<func_type>::value) {
                 f_ = ciel::construct_at(static_cast<func_type*>(static_cast<void*>(&buffer_)), std::move(f));
             } else {
                 allocator<func_type> a;
@@ -8,6 +8,7 @@
 #include <ciel/iterator_impl/distance.hpp>
 #include <ciel/memory_impl/addressof.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/memory_impl/prefetch.hpp>
 #include <ciel/memory_impl/to_address.hpp>
 #include <ciel/memory_impl/unique_ptr.hpp>
 #include <ciel/utility_impl/pair.hpp>
@@ -388,6 +389,29 @@ private:
         bucket_list_ = std::move(new_bucket_list);
     }
 
+    template<class Key>
+    [[nodiscard]] auto find_in_bucket(const size_type hash, const Key& key) const -> iterator {
+        if (bucket_count() == 0) {
+            return end();
+        }
+
+        const size_type bucket_index = hash % bucket_count();
+        for (auto it = begin(bucket_index); it != end(bucket_index); ++it) {
+            if (ke_(*it, key)) {
+                return {to_address(it), &bucket_list_, bucket_index};
+            }
+        }
+        return end();
+    }
+
+    // precondition: bucket_count() > 0, node->hash_ is up to date and there is no equivalent element
+    auto link_extracted_node(node_type* node) noexcept -> void {
+        const size_type bucket_index = node->hash_ % bucket_count();
+        node->next_ = bucket_list_[bucket_index];
+        bucket_list_[bucket_index] = node;
+        ++size_;
+    }
+
 public:
     hashtable(size_type bucket_count, const hasher& hash, const key_equal& equal, const allocator_type& alloc)
         : bucket_list_(nullptr, {0}), size_(0), mlf_(1.0F), allocator_(alloc), hasher_(hash), ke_(equal) {
@@ -672,21 +696,9 @@ public:
         iterator res(pos);
         ++res;
 
-        size_type bucket_index = pos.index();
-        // if pos is the first of current bucket
-        if (pos.base() == bucket_list_[bucket_index]) {
-            bucket_list_[bucket_index] = pos.base()->next_;
-            destroy_and_deallocate_node(to_address(pos));
-            return res;
-        }
-
-        // find the previous node of pos and change it's next
-        node_type* before_pos = bucket_list_[bucket_index];
-        for (; before_pos->next_ != pos.base(); before_pos = before_pos->next_) {}
-
-        before_pos->next_ = pos.base()->next_;
-        destroy_and_deallocate_node(to_address(pos));
-
+        node_type* node = extract(pos);
+        node_alloc_traits::destroy(allocator_, node);
+        node_alloc_traits::deallocate(allocator_, node, 1);
         return res;
     }
 
@@ -721,6 +733,69 @@ public:
         return res;
     }
 
+    // Node handle support, nodes are relinked without allocation or moving elements.
+    [[nodiscard]] auto extract(iterator pos) noexcept -> node_type* {
+        size_type bucket_index = pos.index();
+        --size_;
+
+        // if pos is the first of current bucket
+        if (pos.base() == bucket_list_[bucket_index]) {
+            bucket_list_[bucket_index] = pos.base()->next_;
+            return pos.base();
+        }
+
+        // find the previous node of pos and change it's next
+        node_type* before_pos = bucket_list_[bucket_index];
+        for (; before_pos->next_ != pos.base(); before_pos = before_pos->next_) {}
+
+        before_pos->next_ = pos.base()->next_;
+        return pos.base();
+    }
+
+    // The key may be modified after extraction, so hash_ is recalculated.
+    // When there is an equivalent element already, the node is not taken and its position is returned.
+    auto insert_node_unique(node_type* node) -> pair<iterator, bool> {
+        node->hash_ = hasher_(node->value_);
+
+        if (bucket_count() == 0 || load_factor() >= max_load_factor()) {
+            do_rehash(next_prime(bucket_count()));
+        }
+
+        if (iterator pos = find_in_bucket(node->hash_, node->value_); pos != end()) {
+            return {pos, false};
+        }
+
+        link_extracted_node(node);
+        return {{node, &bucket_list_, node->hash_ % bucket_count()}, true};
+    }
+
+    // Moves the nodes of source whose elements are not in *this.
+    // precondition: get_allocator() == source.get_allocator()
+    auto merge_unique(hashtable& source) -> void {
+        CIEL_PRECONDITION(allocator_ == source.allocator_);
+
+        if (this == ciel::addressof(source)) [[unlikely]] {
+            return;
+        }
+
+        for (iterator it = source.begin(); it != source.end();) {
+            const size_type hash = hasher_(*it);
+            if (find_in_bucket(hash, *it) != end()) {
+                ++it;
+                continue;
+            }
+
+            // grow before extraction, so that nothing is lost if it throws
+            if (bucket_count() == 0 || load_factor() >= max_load_factor()) {
+                do_rehash(next_prime(bucket_count()));
+            }
+
+            node_type* node = source.extract(it++);
+            node->hash_ = hash;
+            link_extracted_node(node);
+        }
+    }
+
     auto swap(hashtable& other) noexcept -> void {
         using std::swap;
         swap(bucket_list_, other.bucket_list_);
@@ -755,16 +830,57 @@ public:
             return end();
         }
 
-        const size_type hash = hasher_(key);
-        const size_type bucket_index = hash % bucket_count();
+        return find_in_bucket(hasher_(key), key);
+    }
 
-        for (auto it = begin(bucket_index); it != end(bucket_index); ++it) {
-            if (ke_(*it, key)) {
-                return {to_address(it), &bucket_list_, bucket_index};
+    // Writes find(key) of every key in [first, last) to out.
+    //
+    // A single find waits for the bucket, and then for every node on the chain, one cache miss after another.
+    // Keys are processed in groups instead, and every stage issues the loads of the whole group before
+    // using any of them: hash all the keys and prefetch their buckets, then prefetch the first nodes,
+    // then walk the chains. So the cache misses of independent keys overlap.
+    template<class KeyIt, class OutputIt>
+    auto find_batch(KeyIt first, KeyIt last, OutputIt out) const -> OutputIt {
+        constexpr size_t group_size = details::PrefetchGroupSize;
+
+        if (bucket_count() == 0) {
+            for (; first != last; ++first, ++out) {
+                *out = end();
             }
+            return out;
         }
 
-        return end();
+        KeyIt keys[group_size];
+        size_type bucket_indexes[group_size];
+
+        while (first != last) {
+            size_type n = 0;
+            for (; n < group_size && first != last; ++n, ++first) {
+                keys[n] = first;
+                bucket_indexes[n] = hasher_(*first) % bucket_count();
+                details::prefetch(&bucket_list_[bucket_indexes[n]]);
+            }
+
+            for (size_type i = 0; i < n; ++i) {
+                details::prefetch(bucket_list_[bucket_indexes[i]]);
+            }
+
+            for (size_type i = 0; i < n; ++i, ++out) {
+                node_type* node = bucket_list_[bucket_indexes[i]];
+                while (node != nullptr && !ke_(node->value_, *keys[i])) {
+                    node = node->next_;
+                }
+
+                if (node != nullptr) {
+                    *out = iterator(node, &bucket_list_, bucket_indexes[i]);
+
+                } else {
+                    *out = end();
+                }
+            }
+        }
+
+        return out;
     }
 
     template<class Key>
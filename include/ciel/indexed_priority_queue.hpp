@@ -0,0 +1,316 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_INDEXED_PRIORITY_QUEUE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_INDEXED_PRIORITY_QUEUE_HPP_
+
+#include <ciel/algorithm_impl/min.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/limits.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// An addressable priority queue: push returns a handle of the element,
+// which can be used to change its priority or to erase it until it's popped or erased.
+//
+// Like priority_queue, top() is the greatest element by Compare, so a min queue uses greater.
+// increase_key means that the element becomes greater by Compare, i.e. closer to the top,
+// and decrease_key means the opposite. (For Dijkstra on greater<>, a shorter distance is an increase_key.)
+//
+// It's a D-ary heap of {value, handle} entries in one vector, so no per-node allocation, and comparisons
+// read contiguous values without indirection. positions_[handle] is the index of the entry in the heap,
+// it's updated whenever an entry moves. Handles of popped or erased elements are reused.
+
+template<class T, class Compare = less<T>, size_t Arity = 4, class Allocator = allocator<T>>
+class indexed_priority_queue {
+
+    static_assert(Arity >= 2);
+
+public:
+    using value_type      = T;
+    using value_compare   = Compare;
+    using allocator_type  = Allocator;
+    using size_type       = size_t;
+    using handle_type     = size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+    static constexpr size_t arity = Arity;
+
+private:
+    struct entry {
+        value_type value_;
+        handle_type handle_;
+
+    };  // struct entry
+
+    using alloc_traits    = allocator_traits<allocator_type>;
+    using entry_allocator = typename alloc_traits::template rebind_alloc<entry>;
+    using size_allocator  = typename alloc_traits::template rebind_alloc<size_type>;
+
+    static constexpr size_type npos = numeric_limits<size_type>::max();
+
+    vector<entry, entry_allocator> heap_;
+    vector<size_type, size_allocator> positions_;      // npos for free handles
+    vector<handle_type, size_allocator> free_handles_;
+    [[no_unique_address]] value_compare comp_;
+
+    auto place(entry&& e, const size_type index) -> void {
+        positions_[e.handle_] = index;
+        heap_[index] = std::move(e);
+    }
+
+    // Move the entry at index towards the top until its parent is not less than it
+    auto sift_up(size_type index) -> void {
+        if (index == 0 || !comp_(heap_[(index - 1) / Arity].value_, heap_[index].value_)) {
+            return;
+        }
+
+        entry e = std::move(heap_[index]);
+        do {
+            const size_type parent = (index - 1) / Arity;
+            place(std::move(heap_[parent]), index);
+            index = parent;
+        } while (index > 0 && comp_(heap_[(index - 1) / Arity].value_, e.value_));
+
+        place(std::move(e), index);
+    }
+
+    [[nodiscard]] auto largest_child(const size_type first_child) const -> size_type {
+        const size_type last_child = ciel::min(first_child + Arity, heap_.size());
+        size_type res = first_child;
+        for (size_type i = first_child + 1; i < last_child; ++i) {
+            if (comp_(heap_[res].value_, heap_[i].value_)) {
+                res = i;
+            }
+        }
+        return res;
+    }
+
+    // Move the entry at index towards the bottom until its largest child is not greater than it
+    auto sift_down(size_type index) -> void {
+        const size_type len = heap_.size();
+        if (len < 2 || (len - 2) / Arity < index) {
+            return;
+        }
+
+        size_type child = largest_child(index * Arity + 1);
+        if (!comp_(heap_[index].value_, heap_[child].value_)) {
+            return;
+        }
+
+        entry e = std::move(heap_[index]);
+        do {
+            place(std::move(heap_[child]), index);
+            index = child;
+            if ((len - 2) / Arity < index) {
+                break;
+            }
+            child = largest_child(index * Arity + 1);
+        } while (comp_(e.value_, heap_[child].value_));
+
+        place(std::move(e), index);
+    }
+
+    [[nodiscard]] auto allocate_handle() -> handle_type {
+        if (free_handles_.empty()) {
+            positions_.emplace_back(npos);
+            return positions_.size() - 1;
+        }
+
+        const handle_type res = free_handles_.back();
+        free_handles_.pop_back();
+        return res;
+    }
+
+    // Remove the entry at index by moving the last one there
+    auto remove_at(const size_type index) -> void {
+        const handle_type handle = heap_[index].handle_;
+
+        if (index + 1 == heap_.size()) {
+            heap_.pop_back();
+
+        } else {
+            place(std::move(heap_.back()), index);
+            heap_.pop_back();
+
+            if (index > 0 && comp_(heap_[(index - 1) / Arity].value_, heap_[index].value_)) {
+                sift_up(index);
+
+            } else {
+                sift_down(index);
+            }
+        }
+
+        positions_[handle] = npos;
+        free_handles_.emplace_back(handle);
+    }
+
+public:
+    indexed_priority_queue() = default;
+
+    explicit indexed_priority_queue(const value_compare& comp, const allocator_type& alloc = allocator_type())
+        : heap_(entry_allocator(alloc)), positions_(size_allocator(alloc)), free_handles_(size_allocator(alloc)),
+          comp_(comp) {}
+
+    explicit indexed_priority_queue(const allocator_type& alloc)
+        : indexed_priority_queue(value_compare(), alloc) {}
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return allocator_type(heap_.get_allocator());
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return comp_;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return heap_.empty();
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return heap_.size();
+    }
+
+    auto reserve(const size_type new_cap) -> void {
+        heap_.reserve(new_cap);
+        positions_.reserve(new_cap);
+    }
+
+    // precondition: !empty()
+    [[nodiscard]] auto top() const -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        return heap_.front().value_;
+    }
+
+    // precondition: !empty()
+    [[nodiscard]] auto top_handle() const -> handle_type {
+        CIEL_PRECONDITION(!empty());
+
+        return heap_.front().handle_;
+    }
+
+    // Whether handle refers to an element in the queue
+    [[nodiscard]] auto contains(const handle_type handle) const noexcept -> bool {
+        return handle < positions_.size() && positions_[handle] != npos;
+    }
+
+    // precondition: contains(handle)
+    [[nodiscard]] auto operator[](const handle_type handle) const -> const_reference {
+        CIEL_PRECONDITION(contains(handle));
+
+        return heap_[positions_[handle]].value_;
+    }
+
+    auto push(const value_type& value) -> handle_type {
+        return emplace(value);
+    }
+
+    auto push(value_type&& value) -> handle_type {
+        return emplace(std::move(value));
+    }
+
+    // The entry is added before a handle is claimed, so a throwing constructor or reallocation doesn't lose one
+    template<class... Args>
+    auto emplace(Args&& ... args) -> handle_type {
+        heap_.emplace_back(entry{value_type(std::forward<Args>(args)...), npos});
+
+        handle_type handle = npos;
+        CIEL_TRY {
+            handle = allocate_handle();
+
+        } CIEL_CATCH (...) {
+            heap_.pop_back();
+            CIEL_THROW;
+        }
+
+        heap_.back().handle_ = handle;
+        positions_[handle] = heap_.size() - 1;
+        sift_up(heap_.size() - 1);
+        return handle;
+    }
+
+    // precondition: !empty()
+    auto pop() -> void {
+        CIEL_PRECONDITION(!empty());
+
+        remove_at(0);
+    }
+
+    // precondition: contains(handle)
+    auto erase(const handle_type handle) -> void {
+        CIEL_PRECONDITION(contains(handle));
+
+        remove_at(positions_[handle]);
+    }
+
+    // precondition: contains(handle), and value is not less than the current one
+    template<class U>
+    auto increase_key(const handle_type handle, U&& value) -> void {
+        CIEL_PRECONDITION(contains(handle));
+        CIEL_PRECONDITION(!comp_(value, heap_[positions_[handle]].value_));
+
+        const size_type index = positions_[handle];
+        heap_[index].value_ = std::forward<U>(value);
+        sift_up(index);
+    }
+
+    // precondition: contains(handle), and value is not greater than the current one
+    template<class U>
+    auto decrease_key(const handle_type handle, U&& value) -> void {
+        CIEL_PRECONDITION(contains(handle));
+        CIEL_PRECONDITION(!comp_(heap_[positions_[handle]].value_, value));
+
+        const size_type index = positions_[handle];
+        heap_[index].value_ = std::forward<U>(value);
+        sift_down(index);
+    }
+
+    // precondition: contains(handle)
+    template<class U>
+    auto update(const handle_type handle, U&& value) -> void {
+        CIEL_PRECONDITION(contains(handle));
+
+        const size_type index = positions_[handle];
+        if (comp_(heap_[index].value_, value)) {
+            heap_[index].value_ = std::forward<U>(value);
+            sift_up(index);
+
+        } else {
+            heap_[index].value_ = std::forward<U>(value);
+            sift_down(index);
+        }
+    }
+
+    // Invalidates all handles
+    auto clear() noexcept -> void {
+        heap_.clear();
+        positions_.clear();
+        free_handles_.clear();
+    }
+
+    auto swap(indexed_priority_queue& other) noexcept -> void {
+        heap_.swap(other.heap_);
+        positions_.swap(other.positions_);
+        free_handles_.swap(other.free_handles_);
+        std::swap(comp_, other.comp_);
+    }
+
+};  // class indexed_priority_queue
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, class Compare, size_t Arity, class Allocator>
+auto swap(ciel::indexed_priority_queue<T, Compare, Arity, Allocator>& lhs,
+          ciel::indexed_priority_queue<T, Compare, Arity, Allocator>& rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_INDEXED_PRIORITY_QUEUE_HPP_
\ No newline at end of file
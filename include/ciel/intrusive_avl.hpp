@@ -0,0 +1,734 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_INTRUSIVE_AVL_HPP_
+#define CIELUTILS_INCLUDE_CIEL_INTRUSIVE_AVL_HPP_
+
+#include <ciel/algorithm_impl/max.hpp>
+#include <ciel/avl.hpp>
+#include <ciel/config.hpp>
+#include <ciel/functional_impl/less.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/container_of.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <cstddef>
+#include <cstdint>
+
+NAMESPACE_CIEL_BEGIN
+
+// An intrusive avl tree links objects through an avl_hook member of theirs, so it never allocates,
+// and an object can be in several trees and lists at the same time, one hook for each:
+//
+//     struct connection {
+//         time_point deadline;
+//         avl_hook timeout_hook;
+//     };
+//     intrusive_avl<connection, &connection::timeout_hook, by_deadline> timeouts;
+//
+// Same as avl, the end node is an avl_node_base whose left_ is the root, avl_hook adds the rest of a node.
+// The tree doesn't own the objects, an object must be erased from the tree before it is destroyed,
+// and its key must not change while it's in the tree. A hook has no parent while it's not in any tree.
+// Erasing an object given only itself needs no search, only the O(log N) rebalance up to the root.
+
+struct avl_hook : avl_node_base {
+    avl_node_base* right_;
+    avl_node_base* parent_;
+    int8_t height_;
+
+    avl_hook() noexcept
+        : avl_node_base(nullptr), right_(nullptr), parent_(nullptr), height_(0) {}
+
+    // Being in a tree is not a property of the object, copies start unlinked.
+    avl_hook(const avl_hook&) noexcept
+        : avl_hook() {}
+
+    auto operator=(const avl_hook&) noexcept -> avl_hook& {
+        return *this;
+    }
+
+    [[nodiscard]] auto is_linked() const noexcept -> bool {
+        return parent_ != nullptr;
+    }
+
+    auto clear() noexcept -> void {
+        left_ = nullptr;
+        right_ = nullptr;
+        parent_ = nullptr;
+        height_ = 0;
+    }
+
+};  // struct avl_hook
+
+template<class T, avl_hook T::* Hook, class Pointer, class Reference>
+class intrusive_avl_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = Pointer;
+    using reference         = Reference;
+    using iterator_category = bidirectional_iterator_tag;
+    using iterator_concept  = bidirectional_iterator_tag;
+
+private:
+    using base_node_type    = avl_node_base;
+    using node_type         = avl_hook;
+
+    base_node_type* it_;
+
+    [[nodiscard]] auto is_left_child() const noexcept -> bool {
+        return parent()->left_ == it_;
+    }
+
+    [[nodiscard]] auto right() const noexcept -> base_node_type* {
+        return static_cast<node_type*>(it_)->right_;
+    }
+
+    [[nodiscard]] auto parent() const noexcept -> base_node_type* {
+        return static_cast<node_type*>(it_)->parent_;
+    }
+
+public:
+    intrusive_avl_iterator() noexcept : it_(nullptr) {}
+
+    explicit intrusive_avl_iterator(const base_node_type* p) noexcept : it_(const_cast<base_node_type*>(p)) {}
+
+    intrusive_avl_iterator(const intrusive_avl_iterator&) noexcept = default;
+    intrusive_avl_iterator(intrusive_avl_iterator&&) noexcept = default;
+
+    template<class P, class R>
+    intrusive_avl_iterator(const intrusive_avl_iterator<T, Hook, P, R>& other) noexcept
+        : it_(const_cast<base_node_type*>(other.base())) {}
+
+    ~intrusive_avl_iterator() = default;
+
+    auto operator=(const intrusive_avl_iterator&) noexcept -> intrusive_avl_iterator& = default;
+    auto operator=(intrusive_avl_iterator&&) noexcept -> intrusive_avl_iterator& = default;
+
+    [[nodiscard]] auto next() const noexcept -> intrusive_avl_iterator {
+        intrusive_avl_iterator res(it_);
+        ++res;
+        return res;
+    }
+
+    [[nodiscard]] auto prev() const noexcept -> intrusive_avl_iterator {
+        intrusive_avl_iterator res(it_);
+        --res;
+        return res;
+    }
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return *container_of(static_cast<node_type*>(it_), Hook);
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return container_of(static_cast<node_type*>(it_), Hook);
+    }
+
+    auto operator++() noexcept -> intrusive_avl_iterator& {
+        if (right()) {
+            it_ = right();
+            while (it_->left_ != nullptr) {
+                it_ = it_->left_;
+            }
+        } else {
+            while (!is_left_child()) {
+                it_ = parent();
+            }
+            it_ = parent();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> intrusive_avl_iterator {
+        intrusive_avl_iterator res(it_);
+        ++*this;
+        return res;
+    }
+
+    // end() has no parent but its left_ is the root, so --end() takes the first branch.
+    auto operator--() noexcept -> intrusive_avl_iterator& {
+        if (it_->left_) {
+            it_ = it_->left_;
+            while (right()) {
+                it_ = right();
+            }
+        } else {
+            while (is_left_child()) {
+                it_ = parent();
+            }
+            it_ = parent();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> intrusive_avl_iterator {
+        intrusive_avl_iterator res(it_);
+        --*this;
+        return res;
+    }
+
+    [[nodiscard]] auto base() const noexcept -> base_node_type* {
+        return it_;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return it_ != nullptr;
+    }
+
+};  // class intrusive_avl_iterator
+
+template<class T, avl_hook T::* Hook, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator==(const intrusive_avl_iterator<T, Hook, Pointer1, Reference1>& lhs,
+                              const intrusive_avl_iterator<T, Hook, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return lhs.base() == rhs.base();
+}
+
+template<class T, avl_hook T::* Hook, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator!=(const intrusive_avl_iterator<T, Hook, Pointer1, Reference1>& lhs,
+                              const intrusive_avl_iterator<T, Hook, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+template<class T, avl_hook T::* Hook, class Compare = less<T>>
+class intrusive_avl {
+public:
+    using value_type             = T;
+    using value_compare          = Compare;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = value_type*;
+    using const_pointer          = const value_type*;
+    using iterator               = intrusive_avl_iterator<value_type, Hook, pointer, reference>;
+    using const_iterator         = intrusive_avl_iterator<value_type, Hook, const_pointer, const_reference>;
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    using base_node_type         = avl_node_base;
+    using node_type              = avl_hook;
+
+    base_node_type* start_;
+    base_node_type end_node_;
+    size_type size_;
+    [[no_unique_address]] value_compare comp_;
+
+    [[nodiscard]] static auto hook(const_reference value) noexcept -> node_type* {
+        return const_cast<node_type*>(addressof(value.*Hook));
+    }
+
+    [[nodiscard]] static auto value_of(const base_node_type* node) noexcept -> const_reference {
+        return *container_of(static_cast<const node_type*>(node), Hook);
+    }
+
+    [[nodiscard]] static auto height(const base_node_type* node) noexcept -> int {
+        return node ? static_cast<const node_type*>(node)->height_ : 0;
+    }
+
+    static auto height_adjust(node_type* node) noexcept -> void {
+        node->height_ = static_cast<int8_t>(1 + ciel::max(height(node->left_), height(node->right_)));
+    }
+
+    [[nodiscard]] auto root() const noexcept -> node_type* {
+        return static_cast<node_type*>(end_node_.left_);
+    }
+
+    // Make node's parent point to replacement instead.
+    static auto replace_child(node_type* node, base_node_type* replacement) noexcept -> void {
+        if (node->parent_->left_ == node) {
+            node->parent_->left_ = replacement;
+        } else {
+            static_cast<node_type*>(node->parent_)->right_ = replacement;
+        }
+        if (replacement) {
+            static_cast<node_type*>(replacement)->parent_ = node->parent_;
+        }
+    }
+
+    static auto rotate_left(node_type* head) noexcept -> node_type* {
+        auto* new_head = static_cast<node_type*>(head->right_);
+        head->right_ = new_head->left_;
+        if (head->right_) {
+            static_cast<node_type*>(head->right_)->parent_ = head;
+        }
+        replace_child(head, new_head);
+        new_head->left_ = head;
+        head->parent_ = new_head;
+
+        height_adjust(head);
+        height_adjust(new_head);
+        return new_head;
+    }
+
+    static auto rotate_right(node_type* head) noexcept -> node_type* {
+        auto* new_head = static_cast<node_type*>(head->left_);
+        head->left_ = new_head->right_;
+        if (head->left_) {
+            static_cast<node_type*>(head->left_)->parent_ = head;
+        }
+        replace_child(head, new_head);
+        new_head->right_ = head;
+        head->parent_ = new_head;
+
+        height_adjust(head);
+        height_adjust(new_head);
+        return new_head;
+    }
+
+    // Returns the root of the rebalanced subtree.
+    static auto rebalance(node_type* node) noexcept -> node_type* {
+        const int balance = height(node->left_) - height(node->right_);
+
+        if (balance > 1) {
+            auto* left = static_cast<node_type*>(node->left_);
+            if (height(left->left_) < height(left->right_)) {
+                rotate_left(left);
+            }
+            return rotate_right(node);
+        }
+
+        if (balance < -1) {
+            auto* right = static_cast<node_type*>(node->right_);
+            if (height(right->right_) < height(right->left_)) {
+                rotate_right(right);
+            }
+            return rotate_left(node);
+        }
+
+        height_adjust(node);
+        return node;
+    }
+
+    // Fix heights and balance from node up to the root.
+    auto rebalance_up(base_node_type* node) noexcept -> void {
+        while (node != addressof(end_node_)) {
+            node = rebalance(static_cast<node_type*>(node))->parent_;
+        }
+    }
+
+    // Link node as a leaf under parent, then rebalance.
+    auto link_leaf(base_node_type* parent, const bool left, node_type* node) noexcept -> iterator {
+        node->left_ = nullptr;
+        node->right_ = nullptr;
+        node->parent_ = parent;
+        node->height_ = 1;
+
+        if (left) {
+            parent->left_ = node;
+            if (parent == start_) {
+                start_ = node;
+            }
+        } else {
+            static_cast<node_type*>(parent)->right_ = node;
+        }
+        ++size_;
+
+        if (parent != addressof(end_node_)) {
+            rebalance_up(parent);
+        }
+        return iterator(node);
+    }
+
+    template<class Key>
+    [[nodiscard]] auto lower_bound_node(const Key& key) const noexcept -> base_node_type* {
+        base_node_type* node = root();
+        base_node_type* res = const_cast<base_node_type*>(addressof(end_node_));
+
+        while (node) {
+            if (!comp_(value_of(node), key)) {
+                res = node;
+                node = node->left_;
+            } else {
+                node = static_cast<node_type*>(node)->right_;
+            }
+        }
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto upper_bound_node(const Key& key) const noexcept -> base_node_type* {
+        base_node_type* node = root();
+        base_node_type* res = const_cast<base_node_type*>(addressof(end_node_));
+
+        while (node) {
+            if (comp_(key, value_of(node))) {
+                res = node;
+                node = node->left_;
+            } else {
+                node = static_cast<node_type*>(node)->right_;
+            }
+        }
+        return res;
+    }
+
+    template<class Key>
+    [[nodiscard]] auto find_node(const Key& key) const noexcept -> base_node_type* {
+        base_node_type* lb = lower_bound_node(key);
+
+        if (lb != addressof(end_node_) && !comp_(key, value_of(lb))) {
+            return lb;
+        }
+        return const_cast<base_node_type*>(addressof(end_node_));
+    }
+
+    template<class Key>
+    [[nodiscard]] auto count_impl(const Key& key) const noexcept -> size_type {
+        size_type res = 0;
+        const_iterator last(upper_bound_node(key));
+        for (const_iterator it(lower_bound_node(key)); it != last; ++it) {
+            ++res;
+        }
+        return res;
+    }
+
+    auto steal(intrusive_avl& other) noexcept -> void {
+        end_node_.left_ = other.end_node_.left_;
+        if (root()) {
+            root()->parent_ = addressof(end_node_);
+            start_ = other.start_;
+        } else {
+            start_ = addressof(end_node_);
+        }
+        size_ = other.size_;
+
+        other.end_node_.left_ = nullptr;
+        other.start_ = addressof(other.end_node_);
+        other.size_ = 0;
+    }
+
+    static auto clear_subtree(base_node_type* node) noexcept -> void {
+        // depth: H
+        if (node) {
+            clear_subtree(node->left_);
+            clear_subtree(static_cast<node_type*>(node)->right_);
+            static_cast<node_type*>(node)->clear();
+        }
+    }
+
+public:
+    intrusive_avl() noexcept
+        : start_(addressof(end_node_)), end_node_(nullptr), size_(0), comp_() {}
+
+    explicit intrusive_avl(const value_compare& comp) noexcept
+        : start_(addressof(end_node_)), end_node_(nullptr), size_(0), comp_(comp) {}
+
+    intrusive_avl(const intrusive_avl&) = delete;
+    auto operator=(const intrusive_avl&) -> intrusive_avl& = delete;
+
+    intrusive_avl(intrusive_avl&& other) noexcept
+        : start_(addressof(end_node_)), end_node_(nullptr), size_(0), comp_(other.comp_) {
+        steal(other);
+    }
+
+    auto operator=(intrusive_avl&& other) noexcept -> intrusive_avl& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+        clear();
+        comp_ = other.comp_;
+        steal(other);
+        return *this;
+    }
+
+    // The objects are not destroyed, only unlinked.
+    ~intrusive_avl() {
+        clear();
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(start_);
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(start_);
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return iterator(addressof(end_node_));
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator(addressof(end_node_));
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    // The iterator to value, found through its hook.
+    // precondition: value is in *this
+    [[nodiscard]] static auto iterator_to(reference value) noexcept -> iterator {
+        return iterator(hook(value));
+    }
+
+    [[nodiscard]] static auto iterator_to(const_reference value) noexcept -> const_iterator {
+        return const_iterator(hook(value));
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    auto clear() noexcept -> void {
+        clear_subtree(root());
+        end_node_.left_ = nullptr;
+        start_ = addressof(end_node_);
+        size_ = 0;
+    }
+
+    // Inserts value unless an equivalent one is in the tree.
+    // precondition: value is not in any tree through Hook
+    auto insert_unique(reference value) noexcept -> pair<iterator, bool> {
+        CIEL_PRECONDITION(!hook(value)->is_linked());
+
+        base_node_type* parent = addressof(end_node_);
+        base_node_type* node = root();
+        bool left = true;
+
+        while (node) {
+            parent = node;
+            if (comp_(value, value_of(node))) {
+                left = true;
+                node = node->left_;
+            } else if (comp_(value_of(node), value)) {
+                left = false;
+                node = static_cast<node_type*>(node)->right_;
+            } else {
+                return {iterator(node), false};
+            }
+        }
+
+        return {link_leaf(parent, left, hook(value)), true};
+    }
+
+    // Inserts value after all equivalent ones, e.g. timers with the same deadline fire in insertion order.
+    // precondition: value is not in any tree through Hook
+    auto insert_multi(reference value) noexcept -> iterator {
+        CIEL_PRECONDITION(!hook(value)->is_linked());
+
+        base_node_type* parent = addressof(end_node_);
+        base_node_type* node = root();
+        bool left = true;
+
+        while (node) {
+            parent = node;
+            left = comp_(value, value_of(node));
+            node = left ? node->left_ : static_cast<node_type*>(node)->right_;
+        }
+
+        return link_leaf(parent, left, hook(value));
+    }
+
+    auto erase(const_iterator pos) noexcept -> iterator {
+        CIEL_PRECONDITION(pos != end());
+
+        auto* node = static_cast<node_type*>(pos.base());
+        iterator res(pos.next().base());
+        if (node == start_) {
+            start_ = res.base();
+        }
+
+        // upping is the lowest node whose subtree changed
+        base_node_type* upping = node->parent_;
+
+        if (node->left_ && node->right_) {
+            // replace node by its successor, which has no left child
+            auto* succ = static_cast<node_type*>(res.base());
+
+            if (succ == node->right_) {
+                upping = succ;
+
+            } else {
+                upping = succ->parent_;
+                replace_child(succ, succ->right_);
+                succ->right_ = node->right_;
+                static_cast<node_type*>(succ->right_)->parent_ = succ;
+            }
+
+            succ->left_ = node->left_;
+            static_cast<node_type*>(succ->left_)->parent_ = succ;
+            succ->height_ = node->height_;
+            replace_child(node, succ);
+
+        } else {
+            replace_child(node, node->left_ ? node->left_ : node->right_);
+        }
+
+        node->clear();
+        --size_;
+        rebalance_up(upping);
+        return res;
+    }
+
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator(last.base());
+    }
+
+    // No search is needed, the hook knows its place in the tree.
+    // precondition: value is in *this
+    auto erase(reference value) noexcept -> void {
+        erase(iterator_to(value));
+    }
+
+    auto swap(intrusive_avl& other) noexcept -> void {
+        using std::swap;
+
+        intrusive_avl tmp(std::move(other));
+        other.steal(*this);
+        steal(tmp);
+        swap(comp_, other.comp_);
+    }
+
+    [[nodiscard]] auto find(const value_type& key) noexcept -> iterator {
+        return iterator(find_node(key));
+    }
+
+    [[nodiscard]] auto find(const value_type& key) const noexcept -> const_iterator {
+        return const_iterator(find_node(key));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) noexcept -> iterator {
+        return iterator(find_node(x));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto find(const K& x) const noexcept -> const_iterator {
+        return const_iterator(find_node(x));
+    }
+
+    [[nodiscard]] auto count(const value_type& key) const noexcept -> size_type {
+        return count_impl(key);
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto count(const K& x) const noexcept -> size_type {
+        return count_impl(x);
+    }
+
+    [[nodiscard]] auto contains(const value_type& key) const noexcept -> bool {
+        return find(key) != end();
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto contains(const K& x) const noexcept -> bool {
+        return find(x) != end();
+    }
+
+    [[nodiscard]] auto equal_range(const value_type& key) noexcept -> pair<iterator, iterator> {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    [[nodiscard]] auto equal_range(const value_type& key) const noexcept -> pair<const_iterator, const_iterator> {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) noexcept -> pair<iterator, iterator> {
+        return {lower_bound(x), upper_bound(x)};
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto equal_range(const K& x) const noexcept -> pair<const_iterator, const_iterator> {
+        return {lower_bound(x), upper_bound(x)};
+    }
+
+    [[nodiscard]] auto lower_bound(const value_type& key) noexcept -> iterator {
+        return iterator(lower_bound_node(key));
+    }
+
+    [[nodiscard]] auto lower_bound(const value_type& key) const noexcept -> const_iterator {
+        return const_iterator(lower_bound_node(key));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) noexcept -> iterator {
+        return iterator(lower_bound_node(x));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto lower_bound(const K& x) const noexcept -> const_iterator {
+        return const_iterator(lower_bound_node(x));
+    }
+
+    [[nodiscard]] auto upper_bound(const value_type& key) noexcept -> iterator {
+        return iterator(upper_bound_node(key));
+    }
+
+    [[nodiscard]] auto upper_bound(const value_type& key) const noexcept -> const_iterator {
+        return const_iterator(upper_bound_node(key));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) noexcept -> iterator {
+        return iterator(upper_bound_node(x));
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; }
+    [[nodiscard]] auto upper_bound(const K& x) const noexcept -> const_iterator {
+        return const_iterator(upper_bound_node(x));
+    }
+
+    [[nodiscard]] auto value_comp() const -> value_compare {
+        return comp_;
+    }
+
+};  // class intrusive_avl
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, ciel::avl_hook T::* Hook, class Compare>
+auto swap(ciel::intrusive_avl<T, Hook, Compare>& lhs, ciel::intrusive_avl<T, Hook, Compare>& rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_INTRUSIVE_AVL_HPP_
\ No newline at end of file
@@ -0,0 +1,434 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_INTRUSIVE_LIST_HPP_
+#define CIELUTILS_INCLUDE_CIEL_INTRUSIVE_LIST_HPP_
+
+#include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/config.hpp>
+#include <ciel/iterator_impl/distance.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/list.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/container_of.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// An intrusive list links objects through a list_node_base member of theirs, the hook,
+// so it never allocates, and an object can be in as many lists at the same time as it has hooks:
+//
+//     struct connection {
+//         list_node_base lru_hook;
+//         list_node_base idle_hook;
+//     };
+//     intrusive_list<connection, &connection::lru_hook> lru;
+//
+// The list doesn't own the objects, they must outlive their membership, and an object must be erased
+// from the list before it is destroyed. A hook links to itself while it's not in any list, see is_linked().
+// Copying a hook copies its links, so a copy of a linked object must clear() its hook before being inserted.
+// Since every hook knows its neighbours, erasing an object given only itself is O(1).
+
+template<class T, list_node_base T::* Hook, class Pointer, class Reference>
+class intrusive_list_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = Pointer;
+    using reference         = Reference;
+    using iterator_category = bidirectional_iterator_tag;
+    using iterator_concept  = bidirectional_iterator_tag;
+
+private:
+    using base_node_type    = list_node_base;
+
+    base_node_type* it_;
+
+public:
+    intrusive_list_iterator() noexcept : it_(nullptr) {}
+
+    explicit intrusive_list_iterator(const base_node_type* p) noexcept : it_(const_cast<base_node_type*>(p)) {}
+
+    intrusive_list_iterator(const intrusive_list_iterator&) noexcept = default;
+    intrusive_list_iterator(intrusive_list_iterator&&) noexcept = default;
+
+    template<class P, class R>
+    intrusive_list_iterator(const intrusive_list_iterator<T, Hook, P, R>& other) noexcept
+        : it_(const_cast<base_node_type*>(other.base())) {}
+
+    ~intrusive_list_iterator() = default;
+
+    auto operator=(const intrusive_list_iterator&) noexcept -> intrusive_list_iterator& = default;
+    auto operator=(intrusive_list_iterator&&) noexcept -> intrusive_list_iterator& = default;
+
+    [[nodiscard]] auto next() const noexcept -> intrusive_list_iterator {
+        return intrusive_list_iterator(it_->next_);
+    }
+
+    [[nodiscard]] auto prev() const noexcept -> intrusive_list_iterator {
+        return intrusive_list_iterator(it_->prev_);
+    }
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return *container_of(it_, Hook);
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return container_of(it_, Hook);
+    }
+
+    auto operator++() noexcept -> intrusive_list_iterator& {
+        it_ = it_->next_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> intrusive_list_iterator {
+        intrusive_list_iterator res(it_);
+        ++(*this);
+        return res;
+    }
+
+    auto operator--() noexcept -> intrusive_list_iterator& {
+        it_ = it_->prev_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> intrusive_list_iterator {
+        intrusive_list_iterator res(it_);
+        --(*this);
+        return res;
+    }
+
+    [[nodiscard]] auto base() const noexcept -> base_node_type* {
+        return it_;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return it_ != nullptr;
+    }
+
+};    // class intrusive_list_iterator
+
+template<class T, list_node_base T::* Hook, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator==(const intrusive_list_iterator<T, Hook, Pointer1, Reference1>& lhs,
+                              const intrusive_list_iterator<T, Hook, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return lhs.base() == rhs.base();
+}
+
+template<class T, list_node_base T::* Hook, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator!=(const intrusive_list_iterator<T, Hook, Pointer1, Reference1>& lhs,
+                              const intrusive_list_iterator<T, Hook, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+template<class T, list_node_base T::* Hook>
+class intrusive_list {
+public:
+    using value_type             = T;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = value_type*;
+    using const_pointer          = const value_type*;
+
+    using iterator               = intrusive_list_iterator<value_type, Hook, pointer, reference>;
+    using const_iterator         = intrusive_list_iterator<value_type, Hook, const_pointer, const_reference>;
+
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    using base_node_type         = list_node_base;
+
+    base_node_type end_node_;
+    size_type size_;
+
+    // Take over other's nodes, end_node_ can't be copied as is since the nodes point to other's end_node_.
+    auto steal(intrusive_list& other) noexcept -> void {
+        if (other.empty()) {
+            end_node_.clear();
+
+        } else {
+            end_node_.next_ = other.end_node_.next_;
+            end_node_.prev_ = other.end_node_.prev_;
+            end_node_.next_->prev_ = &end_node_;
+            end_node_.prev_->next_ = &end_node_;
+            other.end_node_.clear();
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    static auto link_before(base_node_type* pos, base_node_type* node) noexcept -> void {
+        CIEL_PRECONDITION(!node->is_linked());
+
+        node->prev_ = pos->prev_;
+        node->next_ = pos;
+        pos->prev_->next_ = node;
+        pos->prev_ = node;
+    }
+
+    static auto unlink(base_node_type* node) noexcept -> void {
+        node->prev_->next_ = node->next_;
+        node->next_->prev_ = node->prev_;
+        node->clear();
+    }
+
+    // Relink [first, last) before pos.
+    // precondition: pos is not in [first, last)
+    static auto transfer(iterator pos, iterator first, iterator last) noexcept -> void {
+        base_node_type* f = first.base();
+        base_node_type* l = last.base()->prev_;
+
+        f->prev_->next_ = last.base();
+        last.base()->prev_ = f->prev_;
+
+        base_node_type* p = pos.base();
+        p->prev_->next_ = f;
+        f->prev_ = p->prev_;
+        l->next_ = p;
+        p->prev_ = l;
+    }
+
+public:
+    intrusive_list() noexcept
+        : size_(0) {}
+
+    intrusive_list(const intrusive_list&) = delete;
+    auto operator=(const intrusive_list&) -> intrusive_list& = delete;
+
+    intrusive_list(intrusive_list&& other) noexcept {
+        steal(other);
+    }
+
+    auto operator=(intrusive_list&& other) noexcept -> intrusive_list& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+        clear();
+        steal(other);
+        return *this;
+    }
+
+    // The objects are not destroyed, only unlinked.
+    ~intrusive_list() {
+        clear();
+    }
+
+    [[nodiscard]] auto front() noexcept -> reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *begin();
+    }
+
+    [[nodiscard]] auto front() const noexcept -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *begin();
+    }
+
+    [[nodiscard]] auto back() noexcept -> reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *--end();
+    }
+
+    [[nodiscard]] auto back() const noexcept -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *--end();
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(end_node_.next_);
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(end_node_.next_);
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return iterator(&end_node_);
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator(&end_node_);
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    // The iterator to value, found through its hook.
+    // precondition: value is in *this
+    [[nodiscard]] static auto iterator_to(reference value) noexcept -> iterator {
+        return iterator(addressof(value.*Hook));
+    }
+
+    [[nodiscard]] static auto iterator_to(const_reference value) noexcept -> const_iterator {
+        return const_iterator(addressof(value.*Hook));
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    auto clear() noexcept -> void {
+        base_node_type* node = end_node_.next_;
+        while (node != &end_node_) {
+            base_node_type* next = node->next_;
+            node->clear();
+            node = next;
+        }
+        end_node_.clear();
+        size_ = 0;
+    }
+
+    // precondition: value is not in any list through Hook
+    auto insert(const_iterator pos, reference value) noexcept -> iterator {
+        link_before(pos.base(), addressof(value.*Hook));
+        ++size_;
+        return iterator_to(value);
+    }
+
+    auto push_back(reference value) noexcept -> void {
+        insert(end(), value);
+    }
+
+    auto push_front(reference value) noexcept -> void {
+        insert(begin(), value);
+    }
+
+    auto pop_back() noexcept -> void {
+        CIEL_PRECONDITION(!empty());
+
+        erase(--end());
+    }
+
+    auto pop_front() noexcept -> void {
+        CIEL_PRECONDITION(!empty());
+
+        erase(begin());
+    }
+
+    auto erase(const_iterator pos) noexcept -> iterator {
+        CIEL_PRECONDITION(pos != end());
+
+        iterator res(pos.base()->next_);
+        unlink(pos.base());
+        --size_;
+        return res;
+    }
+
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+        while (first != last) {
+            first = erase(first);
+        }
+        return iterator(last.base());
+    }
+
+    // O(1), the object is enough to find its neighbours.
+    // precondition: value is in *this
+    auto erase(reference value) noexcept -> void {
+        erase(iterator_to(value));
+    }
+
+    // splice relinks nodes of other before pos, both lists are intrusive so nothing else is involved.
+    auto splice(const_iterator pos, intrusive_list& other) noexcept -> void {
+        CIEL_PRECONDITION(this != addressof(other));
+
+        if (other.empty()) {
+            return;
+        }
+
+        transfer(iterator(pos.base()), other.begin(), other.end());
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    // e.g. splice(begin(), *this, iterator_to(value)) moves value to the front of an LRU list.
+    auto splice(const_iterator pos, intrusive_list& other, const_iterator it) noexcept -> void {
+        if (pos == it || pos.base() == it.base()->next_) {
+            return;
+        }
+
+        transfer(iterator(pos.base()), iterator(it.base()), iterator(it.base()->next_));
+        --other.size_;
+        ++size_;
+    }
+
+    // Linear in distance(first, last) to keep sizes, unless other is *this.
+    // precondition: pos is not in [first, last)
+    auto splice(const_iterator pos, intrusive_list& other, const_iterator first, const_iterator last) noexcept
+        -> void {
+        if (first == last) {
+            return;
+        }
+
+        if (this != addressof(other)) {
+            const auto n = static_cast<size_type>(ciel::distance(first, last));
+            other.size_ -= n;
+            size_ += n;
+        }
+        transfer(iterator(pos.base()), iterator(first.base()), iterator(last.base()));
+    }
+
+    auto swap(intrusive_list& other) noexcept -> void {
+        intrusive_list tmp(std::move(other));
+        other.steal(*this);
+        steal(tmp);
+    }
+
+};    // class intrusive_list
+
+template<class T, list_node_base T::* Hook>
+[[nodiscard]] auto operator==(const intrusive_list<T, Hook>& lhs, const intrusive_list<T, Hook>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, ciel::list_node_base T::* Hook>
+auto swap(ciel::intrusive_list<T, Hook>& lhs, ciel::intrusive_list<T, Hook>& rhs) noexcept -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_INTRUSIVE_LIST_HPP_
\ No newline at end of file
@@ -4,7 +4,6 @@
 #include <ciel/concepts_impl/class_or_enum_or_union.hpp>
 #include <ciel/config.hpp>
 #include <ciel/type_traits_impl/is_lvalue_reference.hpp>
-#include <ciel/type_traits_impl/is_rvalue_reference.hpp>
 #include <ciel/type_traits_impl/remove_cvref.hpp>
 #include <ciel/utility_impl/declval.hpp>
 
@@ -32,7 +31,7 @@ concept can_deref = !unqualified_iter_move<T>
                     && !can_move<T>
                     && requires{
     *declval<T>();
-    requires is_rvalue_reference_v<decltype(*declval<T>())>;
+    requires !is_lvalue_reference_v<decltype(*declval<T>())>;
 };
 
 struct fn {
@@ -2,17 +2,20 @@
 #define CIELUTILS_INCLUDE_CIEL_LIST_HPP_
 
 #include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/list_merge_sort.hpp>
 #include <ciel/config.hpp>
+#include <ciel/functional_impl/equal_to.hpp>
+#include <ciel/functional_impl/less.hpp>
 #include <ciel/iterator_impl/distance.hpp>
 #include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/prev.hpp>
 #include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/memory_impl/addressof.hpp>
 #include <ciel/memory_impl/allocator.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
-// TODO: operations like merge and sort
-
 struct list_node_base {
     list_node_base* prev_;
     list_node_base* next_;
@@ -26,6 +29,11 @@ struct list_node_base {
         next_ = this;
     }
 
+    // A node not in any list links to itself, intrusive_list relies on it.
+    [[nodiscard]] auto is_linked() const noexcept -> bool {
+        return next_ != this;
+    }
+
 };    // struct list_node_base
 
 template<class T>
@@ -163,7 +171,7 @@ private:
 
     // Note that this range is [begin, end)
     auto alloc_range_destroy_and_deallocate(iterator begin, iterator end) noexcept -> iterator {
-        size_ -= distance(begin, end);
+        size_ -= static_cast<size_type>(ciel::distance(begin, end));
 
         iterator loop = begin;
         iterator before_begin = begin.prev();
@@ -240,6 +248,63 @@ private:
         }
     }
 
+    // Relink [first, last) before pos.
+    // precondition: pos is not in [first, last)
+    static auto transfer(iterator pos, iterator first, iterator last) noexcept -> void {
+        base_node_type* f = first.base();
+        base_node_type* l = last.base()->prev_;
+
+        f->prev_->next_ = last.base();
+        last.base()->prev_ = f->prev_;
+
+        base_node_type* p = pos.base();
+        p->prev_->next_ = f;
+        f->prev_ = p->prev_;
+        l->next_ = p;
+        p->prev_ = l;
+    }
+
+    // Unlink all nodes as a null-terminated chain through next_, size_ is left as is.
+    [[nodiscard]] auto detach_chain() noexcept -> base_node_type* {
+        if (end_node_.next_ == &end_node_) {
+            return nullptr;
+        }
+
+        base_node_type* head = end_node_.next_;
+        end_node_.prev_->next_ = nullptr;
+        end_node_.clear();
+        return head;
+    }
+
+    // Link a chain from detach_chain back, restoring prev_ on the way.
+    // precondition: *this has no nodes
+    auto attach_chain(base_node_type* head) noexcept -> void {
+        base_node_type* prev = &end_node_;
+        for (base_node_type* node = head; node != nullptr; node = node->next_) {
+            node->prev_ = prev;
+            prev->next_ = node;
+            prev = node;
+        }
+        prev->next_ = &end_node_;
+        end_node_.prev_ = prev;
+    }
+
+    auto destroy_chain(base_node_type* node) noexcept -> void {
+        while (node != nullptr) {
+            auto* to_be_destroyed = static_cast<node_type*>(node);
+            node = node->next_;
+            node_alloc_traits::destroy(allocator_, to_be_destroyed);
+            node_alloc_traits::deallocate(allocator_, to_be_destroyed, 1);
+        }
+    }
+
+    template<class Compare>
+    [[nodiscard]] static auto node_less(Compare& comp) noexcept {
+        return [&comp](base_node_type* lhs, base_node_type* rhs) -> bool {
+            return comp(static_cast<node_type*>(lhs)->value_, static_cast<node_type*>(rhs)->value_);
+        };
+    }
+
 public:
     list()
         : size_(0), allocator_() {}
@@ -528,7 +593,7 @@ public:
 
     auto resize(const size_type count) -> void {
         if (size() >= count) {
-            iterator tmp = prev(end(), size() - count);
+            iterator tmp = ciel::prev(end(), size() - count);
             alloc_range_destroy_and_deallocate(tmp, end());
         } else {
             alloc_range_allocate_and_construct_n(end(), count - size());
@@ -537,13 +602,220 @@ public:
 
     auto resize(const size_type count, const value_type& value) -> void {
         if (size() >= count) {
-            iterator tmp = prev(end(), size() - count);
+            iterator tmp = ciel::prev(end(), size() - count);
             alloc_range_destroy_and_deallocate(tmp, end());
         } else {
             alloc_range_allocate_and_construct_n(end(), count - size(), value);
         }
     }
 
+    // splice relinks nodes of other before pos, no element is copied or moved.
+    // precondition: get_allocator() == other.get_allocator()
+    auto splice(iterator pos, list& other) noexcept -> void {
+        CIEL_PRECONDITION(allocator_ == other.allocator_);
+        CIEL_PRECONDITION(this != ciel::addressof(other));
+
+        if (other.empty()) {
+            return;
+        }
+
+        transfer(pos, other.begin(), other.end());
+        size_ += other.size_;
+        other.size_ = 0;
+    }
+
+    auto splice(iterator pos, list&& other) noexcept -> void {
+        splice(pos, other);
+    }
+
+    auto splice(iterator pos, list& other, iterator it) noexcept -> void {
+        CIEL_PRECONDITION(allocator_ == other.allocator_);
+
+        if (pos == it || pos == it.next()) {
+            return;
+        }
+
+        transfer(pos, it, it.next());
+        --other.size_;
+        ++size_;
+    }
+
+    auto splice(iterator pos, list&& other, iterator it) noexcept -> void {
+        splice(pos, other, it);
+    }
+
+    // Linear in distance(first, last) to keep sizes, unless other is *this.
+    // precondition: pos is not in [first, last)
+    auto splice(iterator pos, list& other, iterator first, iterator last) noexcept -> void {
+        CIEL_PRECONDITION(allocator_ == other.allocator_);
+
+        if (first == last) {
+            return;
+        }
+
+        if (this != ciel::addressof(other)) {
+            const auto n = static_cast<size_type>(ciel::distance(first, last));
+            other.size_ -= n;
+            size_ += n;
+        }
+        transfer(pos, first, last);
+    }
+
+    auto splice(iterator pos, list&& other, iterator first, iterator last) noexcept -> void {
+        splice(pos, other, first, last);
+    }
+
+    // Operations below relink nodes, no element is copied, moved or allocated.
+    // If a comparison throws, every element is still in the list, in unspecified order.
+
+    // Both lists are sorted, elements of other go after equivalent ones of *this.
+    // precondition: get_allocator() == other.get_allocator()
+    template<class Compare>
+    auto merge(list& other, Compare comp) -> void {
+        CIEL_PRECONDITION(allocator_ == other.allocator_);
+
+        if (this == ciel::addressof(other) || other.empty()) {
+            return;
+        }
+
+        base_node_type* head = detach_chain();
+        base_node_type* other_head = other.detach_chain();
+        size_ += other.size_;
+        other.size_ = 0;
+
+        auto less = node_less(comp);
+        CIEL_TRY {
+            details::merge_chains(head, other_head, less);
+
+        } CIEL_CATCH (...) {
+            attach_chain(head);
+            CIEL_THROW;
+        }
+        attach_chain(head);
+    }
+
+    template<class Compare>
+    auto merge(list&& other, Compare comp) -> void {
+        merge(other, comp);
+    }
+
+    auto merge(list& other) -> void {
+        merge(other, ciel::less<>());
+    }
+
+    auto merge(list&& other) -> void {
+        merge(other, ciel::less<>());
+    }
+
+    // Stable bottom-up merge sort, O(N log N) comparisons.
+    template<class Compare>
+    auto sort(Compare comp) -> void {
+        if (size_ < 2) {
+            return;
+        }
+
+        base_node_type* head = detach_chain();
+        CIEL_TRY {
+            details::merge_sort_chain(head, node_less(comp));
+
+        } CIEL_CATCH (...) {
+            attach_chain(head);
+            CIEL_THROW;
+        }
+        attach_chain(head);
+    }
+
+    auto sort() -> void {
+        sort(ciel::less<>());
+    }
+
+    // Removed nodes are destroyed at last, since the argument of remove() may refer to one of them.
+    template<class Pred>
+    auto remove_if(Pred pred) -> size_type {
+        base_node_type* removed = nullptr;
+        size_type count = 0;
+
+        CIEL_TRY {
+            base_node_type* node = end_node_.next_;
+            while (node != &end_node_) {
+                base_node_type* next = node->next_;
+                if (pred(static_cast<node_type*>(node)->value_)) {
+                    node->prev_->next_ = next;
+                    next->prev_ = node->prev_;
+                    node->next_ = removed;
+                    removed = node;
+                    ++count;
+                }
+                node = next;
+            }
+
+        } CIEL_CATCH (...) {
+            size_ -= count;
+            destroy_chain(removed);
+            CIEL_THROW;
+        }
+
+        size_ -= count;
+        destroy_chain(removed);
+        return count;
+    }
+
+    auto remove(const T& value) -> size_type {
+        return remove_if([&](const T& elem) { return elem == value; });
+    }
+
+    // Keeps the first element of every group of consecutive equivalent elements.
+    template<class BinaryPred>
+    auto unique(BinaryPred pred) -> size_type {
+        if (size_ < 2) {
+            return 0;
+        }
+
+        base_node_type* removed = nullptr;
+        size_type count = 0;
+
+        CIEL_TRY {
+            base_node_type* kept = end_node_.next_;
+            base_node_type* node = kept->next_;
+            while (node != &end_node_) {
+                base_node_type* next = node->next_;
+                if (pred(static_cast<node_type*>(kept)->value_, static_cast<node_type*>(node)->value_)) {
+                    kept->next_ = next;
+                    next->prev_ = kept;
+                    node->next_ = removed;
+                    removed = node;
+                    ++count;
+                } else {
+                    kept = node;
+                }
+                node = next;
+            }
+
+        } CIEL_CATCH (...) {
+            size_ -= count;
+            destroy_chain(removed);
+            CIEL_THROW;
+        }
+
+        size_ -= count;
+        destroy_chain(removed);
+        return count;
+    }
+
+    auto unique() -> size_type {
+        return unique(ciel::equal_to<>());
+    }
+
+    auto reverse() noexcept -> void {
+        base_node_type* node = &end_node_;
+        do {
+            base_node_type* next = node->next_;
+            node->next_ = node->prev_;
+            node->prev_ = next;
+            node = next;
+        } while (node != &end_node_);
+    }
+
     auto swap(list& other) noexcept(alloc_traits::is_always_equal::value) -> void {
         using std::swap;
 
@@ -566,7 +838,7 @@ template<class T, class Alloc>
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 template<class T, class Alloc, class U>
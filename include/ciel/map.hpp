@@ -4,14 +4,16 @@
 #include <ciel/avl.hpp>
 #include <ciel/config.hpp>
 #include <ciel/memory_impl/allocator.hpp>
+#include <ciel/node_handle.hpp>
 #include <ciel/tuple.hpp>
 #include <stdexcept>
 
 NAMESPACE_CIEL_BEGIN
 
-// TODO: operator<=>, node_type, insert_return_type, extract, merge
+// TODO: operator<=>
 
-template<class Key, class T, class Compare = less<Key>, class Allocator = allocator<pair<const Key, T>>>
+template<class Key, class T, class Compare = less<Key>, class Allocator = allocator<pair<const Key, T>>,
+         class Augmentation = void>
 class map {
 public:
     using key_type        = Key;
@@ -48,7 +50,7 @@ private:
 
     };  // class value_compare
 
-    using tree_type              = avl<value_type, value_compare, allocator_type>;
+    using tree_type              = avl<value_type, value_compare, allocator_type, Augmentation>;
     using alloc_traits           = allocator_traits<allocator_type>;
 
 public:
@@ -58,6 +60,9 @@ public:
     using reverse_iterator       = ciel::reverse_iterator<iterator>;
     using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
 
+    using node_type              = map_node_handle<typename tree_type::node_type, allocator_type>;
+    using insert_return_type     = node_insert_return<iterator, node_type>;
+
 private:
     tree_type tree_;
 
@@ -344,11 +349,80 @@ public:
         return tree_.erase(x);
     }
 
+    auto extract(iterator pos) noexcept -> node_type {
+        return details::node_handle_access::make<node_type>(tree_.extract(pos), get_allocator());
+    }
+
+    auto extract(const key_type& key) -> node_type {
+        if (auto pos = find(key); pos != end()) {
+            return extract(pos);
+        }
+        return node_type();
+    }
+
+    auto insert(node_type&& nh) -> insert_return_type {
+        if (nh.empty()) {
+            return {end(), false, node_type()};
+        }
+
+        CIEL_PRECONDITION(nh.get_allocator() == get_allocator());
+
+        auto [pos, inserted] = tree_.insert_node_unique(details::node_handle_access::node(nh));
+        if (inserted) {
+            static_cast<void>(details::node_handle_access::release(nh));
+            return {pos, true, node_type()};
+        }
+        return {pos, false, std::move(nh)};
+    }
+
+    auto insert(iterator hint, node_type&& nh) -> iterator {
+        if (nh.empty()) {
+            return end();
+        }
+
+        CIEL_PRECONDITION(nh.get_allocator() == get_allocator());
+
+        auto [pos, inserted] = tree_.insert_node_unique_hint(hint, details::node_handle_access::node(nh));
+        if (inserted) {
+            static_cast<void>(details::node_handle_access::release(nh));
+        }
+        return pos;
+    }
+
+    // Moves the elements of source whose keys are not in *this, by relinking their nodes.
+    // precondition: get_allocator() == source.get_allocator()
+    auto merge(map& source) -> void {
+        tree_.merge_unique(source.tree_);
+    }
+
+    auto merge(map&& source) -> void {
+        merge(source);
+    }
+
     auto swap(map& other)
         noexcept(alloc_traits::is_always_equal::value && is_nothrow_swappable_v<value_compare>) -> void {
         tree_.swap(other.tree_);
     }
 
+    // Set algebra in M log(N / M + 1) for sizes M <= N, rather than M insertions or erasures.
+    // unite keeps the mapped values of *this for equivalent keys.
+    // precondition: Compare doesn't throw, a throwing comparison calls std::terminate
+    auto unite(map&& other) -> void {
+        tree_.unite(std::move(other.tree_));
+    }
+
+    auto unite(const map& other) -> void {
+        tree_.unite(other.tree_);
+    }
+
+    auto intersect(const map& other) -> void {
+        tree_.intersect(other.tree_);
+    }
+
+    auto subtract(const map& other) -> void {
+        tree_.subtract(other.tree_);
+    }
+
     [[nodiscard]] auto count(const Key& key) const -> size_type {
         return tree_.count_unique(key);
     }
@@ -449,6 +523,40 @@ public:
         return tree_.upper_bound(x);
     }
 
+    // Order statistics in O(log N), only with avl_subtree_size as Augmentation.
+
+    // Returns end() if k >= size().
+    [[nodiscard]] auto nth(const size_type k) -> iterator
+        requires tree_type::order_statistics
+    {
+        return tree_.nth(k);
+    }
+
+    [[nodiscard]] auto nth(const size_type k) const -> const_iterator
+        requires tree_type::order_statistics
+    {
+        return tree_.nth(k);
+    }
+
+    // The number of elements whose keys are less than key.
+    [[nodiscard]] auto rank(const Key& key) const -> size_type
+        requires tree_type::order_statistics
+    {
+        return tree_.rank(key);
+    }
+
+    template<class K>
+        requires requires { typename key_compare::is_transparent; } && tree_type::order_statistics
+    [[nodiscard]] auto rank(const K& x) const -> size_type {
+        return tree_.rank(x);
+    }
+
+    [[nodiscard]] auto distance(const_iterator first, const_iterator last) const -> difference_type
+        requires tree_type::order_statistics
+    {
+        return tree_.distance(first, last);
+    }
+
     [[nodiscard]] auto key_comp() const -> key_compare {
         return key_compare();
     }
@@ -459,16 +567,18 @@ public:
 
 };  // class map
 
-template<class Key, class T, class Compare, class Alloc>
-[[nodiscard]] auto operator==(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs) -> bool {
+template<class Key, class T, class Compare, class Alloc, class Augmentation>
+[[nodiscard]] auto operator==(const map<Key, T, Compare, Alloc, Augmentation>& lhs,
+                              const map<Key, T, Compare, Alloc, Augmentation>& rhs) -> bool {
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template<class Key, class T, class Compare, class Alloc, class Pred>
-auto erase_if(map<Key, T, Compare, Alloc>& c, Pred pred) -> typename map<Key, T, Compare, Alloc>::size_type {
+template<class Key, class T, class Compare, class Alloc, class Augmentation, class Pred>
+auto erase_if(map<Key, T, Compare, Alloc, Augmentation>& c, Pred pred)
+    -> typename map<Key, T, Compare, Alloc, Augmentation>::size_type {
     auto old_size = c.size();
     for (auto i = c.begin(), last = c.end(); i != last;) {
         if (pred(*i)) {
@@ -503,9 +613,9 @@ NAMESPACE_CIEL_END
 
 namespace std {
 
-template<class Key, class T, class Compare, class Alloc>
-auto swap(ciel::map<Key, T, Compare, Alloc>& lhs,
-          ciel::map<Key, T, Compare, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+template<class Key, class T, class Compare, class Alloc, class Augmentation>
+auto swap(ciel::map<Key, T, Compare, Alloc, Augmentation>& lhs,
+          ciel::map<Key, T, Compare, Alloc, Augmentation>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
     lhs.swap(rhs);
 }
 
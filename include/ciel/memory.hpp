@@ -6,10 +6,12 @@
 #include <ciel/memory_impl/allocator_arg.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
 #include <ciel/memory_impl/construct_at.hpp>
+#include <ciel/memory_impl/container_of.hpp>
 #include <ciel/memory_impl/default_delete.hpp>
 #include <ciel/memory_impl/destroy.hpp>
 #include <ciel/memory_impl/destroy_at.hpp>
 #include <ciel/memory_impl/destroy_n.hpp>
+#include <ciel/memory_impl/epoch_domain.hpp>
 #include <ciel/memory_impl/pointer_traits.hpp>
 #include <ciel/memory_impl/shared_ptr.hpp>
 #include <ciel/memory_impl/to_address.hpp>
@@ -0,0 +1,41 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_CONTAINER_OF_HPP_
+#define CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_CONTAINER_OF_HPP_
+
+#include <bit>  // for std::bit_cast
+#include <ciel/config.hpp>
+#include <cstddef>
+#include <cstdint>
+
+NAMESPACE_CIEL_BEGIN
+
+// Gets the object from a pointer to one of its data members, for intrusive containers that only see the hooks.
+//
+// offsetof only takes a member name, so the offset is read from the member pointer itself,
+// both the Itanium and the MSVC ABI represent a data member pointer by the member's offset.
+
+template<class T, class M>
+[[nodiscard]] auto member_offset(M T::* member) noexcept -> ptrdiff_t {
+    static_assert(sizeof(member) == sizeof(ptrdiff_t) || sizeof(member) == sizeof(int32_t),
+                  "Data member pointer is not a plain offset on this ABI");
+
+    if constexpr (sizeof(member) == sizeof(ptrdiff_t)) {
+        return std::bit_cast<ptrdiff_t>(member);
+
+    } else {
+        return std::bit_cast<int32_t>(member);
+    }
+}
+
+template<class T, class M>
+[[nodiscard]] auto container_of(M* p, M T::* member) noexcept -> T* {
+    return reinterpret_cast<T*>(reinterpret_cast<unsigned char*>(p) - member_offset(member));
+}
+
+template<class T, class M>
+[[nodiscard]] auto container_of(const M* p, M T::* member) noexcept -> const T* {
+    return reinterpret_cast<const T*>(reinterpret_cast<const unsigned char*>(p) - member_offset(member));
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_CONTAINER_OF_HPP_
\ No newline at end of file
@@ -0,0 +1,251 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_EPOCH_DOMAIN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_EPOCH_DOMAIN_HPP_
+
+#include <atomic>
+#include <ciel/config.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+NAMESPACE_CIEL_BEGIN
+
+// Epoch-based reclamation, for lock-free containers whose readers may still hold a node that is being removed.
+//
+// A thread pins the domain before touching shared nodes and unpins it after, a removed node is retired instead of
+// freed. The global epoch advances only when every pinned thread has seen the current one, so a node retired
+// in epoch e is unreachable by anyone once the global epoch reaches e + 2, and then its owner frees it.
+//
+// Every thread gets a record in the domain on first use, found again through a thread_local cache.
+// Records are only freed with the domain, and a record is reused by a later thread with the same id.
+// Pins nest, so a pinned thread may pin again, e.g. by holding two iterators.
+
+class epoch_domain {
+public:
+    using deleter_type = void (*)(void* context, void* p) noexcept;
+
+private:
+    static constexpr size_t collect_period = 64;
+
+    struct retired {
+        void* ptr;
+        void* context;
+        deleter_type deleter;
+    };
+
+    // Each record takes its own cache line, since the owner writes epoch_ on every pin.
+    struct alignas(64) record {
+        // (epoch << 1) | 1 while pinned, 0 while not
+        std::atomic<uint64_t> epoch_{0};
+        std::atomic<std::thread::id> owner_;
+        record* next_{nullptr};
+
+        // Following members are only touched by the owner
+        size_t nesting_{0};
+        size_t retired_count_{0};
+        vector<retired> limbo_[3];
+        uint64_t limbo_epoch_[3]{};
+
+        explicit record(const std::thread::id owner) noexcept
+            : owner_(owner) {}
+    };
+
+    struct cache {
+        uint64_t domain_id;
+        record* rec;
+    };
+
+    std::atomic<uint64_t> global_epoch_{1};
+    std::atomic<record*> records_{nullptr};
+    const uint64_t id_;
+
+    [[nodiscard]] static auto next_id() noexcept -> uint64_t {
+        static std::atomic<uint64_t> counter{1};
+        return counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] auto local_record() -> record* {
+        thread_local cache c{0, nullptr};
+        if (c.domain_id == id_) {
+            return c.rec;
+        }
+
+        const std::thread::id self = std::this_thread::get_id();
+        record* rec = records_.load(std::memory_order_acquire);
+        while (rec != nullptr && rec->owner_.load(std::memory_order_relaxed) != self) {
+            rec = rec->next_;
+        }
+
+        if (rec == nullptr) {
+            rec = new record(self);
+            rec->next_ = records_.load(std::memory_order_relaxed);
+            while (!records_.compare_exchange_weak(rec->next_, rec, std::memory_order_release,
+                                                   std::memory_order_relaxed)) {}
+        }
+
+        c = {id_, rec};
+        return rec;
+    }
+
+    static auto free_limbo(vector<retired>& limbo) noexcept -> void {
+        for (const retired& r : limbo) {
+            r.deleter(r.context, r.ptr);
+        }
+        limbo.clear();
+    }
+
+    // Free what was retired two epochs ago or earlier.
+    static auto collect(record* rec, const uint64_t epoch) noexcept -> void {
+        for (size_t i = 0; i < 3; ++i) {
+            if (!rec->limbo_[i].empty() && rec->limbo_epoch_[i] + 2 <= epoch) {
+                free_limbo(rec->limbo_[i]);
+            }
+        }
+    }
+
+    auto try_advance() noexcept -> void {
+        uint64_t epoch = global_epoch_.load();
+        for (record* rec = records_.load(std::memory_order_acquire); rec != nullptr; rec = rec->next_) {
+            const uint64_t e = rec->epoch_.load();
+            if ((e & 1) != 0 && (e >> 1) != epoch) {
+                return;
+            }
+        }
+        global_epoch_.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+public:
+    epoch_domain() noexcept
+        : id_(next_id()) {}
+
+    epoch_domain(const epoch_domain&) = delete;
+    auto operator=(const epoch_domain&) -> epoch_domain& = delete;
+
+    // precondition: no thread is pinned
+    ~epoch_domain() {
+        record* rec = records_.load(std::memory_order_acquire);
+        while (rec != nullptr) {
+            CIEL_PRECONDITION(rec->nesting_ == 0);
+
+            for (vector<retired>& limbo : rec->limbo_) {
+                free_limbo(limbo);
+            }
+            record* next = rec->next_;
+            delete rec;
+            rec = next;
+        }
+    }
+
+    auto pin() -> void {
+        record* rec = local_record();
+        if (rec->nesting_++ != 0) {
+            return;
+        }
+
+        // Publish the epoch and make sure it was still current after being published,
+        // otherwise an advance may have missed us.
+        uint64_t epoch = global_epoch_.load();
+        while (true) {
+            rec->epoch_.store((epoch << 1) | 1);
+            const uint64_t current = global_epoch_.load();
+            if (current == epoch) {
+                break;
+            }
+            epoch = current;
+        }
+        collect(rec, epoch);
+    }
+
+    // precondition: pinned by this thread
+    auto unpin() noexcept -> void {
+        record* rec = local_record();
+        CIEL_PRECONDITION(rec->nesting_ > 0);
+
+        if (--rec->nesting_ == 0) {
+            rec->epoch_.store(0, std::memory_order_release);
+        }
+    }
+
+    // p is unreachable for threads pinning from now on, deleter(context, p) is called once no one can hold it.
+    // precondition: pinned by this thread
+    auto retire(void* p, void* context, deleter_type deleter) -> void {
+        record* rec = local_record();
+        CIEL_PRECONDITION(rec->nesting_ > 0);
+
+        // The global epoch, not the one we pinned at: it may be one ahead already, and readers pinned at it
+        // could still reach p until it advances twice more.
+        const uint64_t epoch = global_epoch_.load();
+        const size_t index = epoch % 3;
+        if (rec->limbo_epoch_[index] != epoch) {
+            // it holds epoch - 3 or earlier
+            free_limbo(rec->limbo_[index]);
+            rec->limbo_epoch_[index] = epoch;
+        }
+        rec->limbo_[index].push_back({p, context, deleter});
+
+        if (++rec->retired_count_ % collect_period == 0) {
+            try_advance();
+        }
+    }
+
+};  // class epoch_domain
+
+// Pins the domain for its lifetime, copies pin again.
+class epoch_guard {
+private:
+    epoch_domain* domain_;
+
+public:
+    epoch_guard() noexcept
+        : domain_(nullptr) {}
+
+    explicit epoch_guard(epoch_domain& domain)
+        : domain_(&domain) {
+        domain_->pin();
+    }
+
+    epoch_guard(const epoch_guard& other)
+        : domain_(other.domain_) {
+        if (domain_ != nullptr) {
+            domain_->pin();
+        }
+    }
+
+    epoch_guard(epoch_guard&& other) noexcept
+        : domain_(other.domain_) {
+        other.domain_ = nullptr;
+    }
+
+    auto operator=(const epoch_guard& other) -> epoch_guard& {
+        if (other.domain_ != nullptr) {
+            other.domain_->pin();
+        }
+        if (domain_ != nullptr) {
+            domain_->unpin();
+        }
+        domain_ = other.domain_;
+        return *this;
+    }
+
+    auto operator=(epoch_guard&& other) noexcept -> epoch_guard& {
+        if (this != &other) {
+            if (domain_ != nullptr) {
+                domain_->unpin();
+            }
+            domain_ = other.domain_;
+            other.domain_ = nullptr;
+        }
+        return *this;
+    }
+
+    ~epoch_guard() {
+        if (domain_ != nullptr) {
+            domain_->unpin();
+        }
+    }
+
+};  // class epoch_guard
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_EPOCH_DOMAIN_HPP_
\ No newline at end of file
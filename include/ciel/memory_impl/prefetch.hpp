@@ -0,0 +1,27 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_PREFETCH_HPP_
+#define CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_PREFETCH_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+namespace details {
+
+// Batched lookups work on groups of this many independent keys, so that their cache misses are in flight together.
+// It's a bit more than the number of L1 miss buffers on common CPUs.
+constexpr size_t PrefetchGroupSize = 16;
+
+// Hint the CPU to load the cache line containing p for reading, it never faults even if p is invalid
+constexpr auto prefetch(const void* p) noexcept -> void {
+    if (!ciel::is_constant_evaluated()) {
+        __builtin_prefetch(p);
+    }
+}
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_MEMORY_IMPL_PREFETCH_HPP_
\ No newline at end of file
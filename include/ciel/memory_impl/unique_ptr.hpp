@@ -17,6 +17,7 @@
 #include <ciel/type_traits_impl/is_unbounded_array.hpp>
 #include <ciel/type_traits_impl/remove_cvref.hpp>
 #include <ciel/type_traits_impl/remove_pointer.hpp>
+#include <ostream>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -0,0 +1,279 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NODE_HANDLE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NODE_HANDLE_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/remove_cv.hpp>
+#include <new>
+
+NAMESPACE_CIEL_BEGIN
+
+// A node handle owns a node extracted from a node-based container, so the element can be moved to another
+// container, or put back after its key is modified, without reallocating or moving the element.
+//
+// It holds the container's allocator only when it's not empty, the node is destroyed with it when
+// the handle goes out of scope.
+
+namespace details {
+
+struct node_handle_access;
+
+template<class Node, class Allocator>
+class node_handle_base {
+public:
+    using allocator_type = Allocator;
+
+private:
+    using alloc_traits        = allocator_traits<allocator_type>;
+    using node_allocator      = typename alloc_traits::template rebind_alloc<Node>;
+    using node_alloc_traits   = typename alloc_traits::template rebind_traits<Node>;
+
+    Node* ptr_;
+
+    union {
+        allocator_type allocator_;
+    };
+
+    friend struct node_handle_access;
+
+    auto destroy_node() noexcept -> void {
+        if (ptr_ != nullptr) {
+            node_allocator node_alloc(allocator_);
+            node_alloc_traits::destroy(node_alloc, ptr_);
+            node_alloc_traits::deallocate(node_alloc, ptr_, 1);
+            ptr_ = nullptr;
+            allocator_.~allocator_type();
+        }
+    }
+
+    // precondition: !empty()
+    [[nodiscard]] auto release() noexcept -> Node* {
+        CIEL_PRECONDITION(!empty());
+
+        Node* res = ptr_;
+        ptr_ = nullptr;
+        allocator_.~allocator_type();
+        return res;
+    }
+
+protected:
+    node_handle_base(Node* p, const allocator_type& alloc) noexcept
+        : ptr_(p) {
+        ::new (ciel::addressof(allocator_)) allocator_type(alloc);
+    }
+
+    [[nodiscard]] auto node() const noexcept -> Node* {
+        return ptr_;
+    }
+
+public:
+    constexpr node_handle_base() noexcept
+        : ptr_(nullptr) {}
+
+    node_handle_base(node_handle_base&& other) noexcept
+        : ptr_(other.ptr_) {
+        if (ptr_ != nullptr) {
+            ::new (ciel::addressof(allocator_)) allocator_type(std::move(other.allocator_));
+            other.ptr_ = nullptr;
+            other.allocator_.~allocator_type();
+        }
+    }
+
+    ~node_handle_base() {
+        destroy_node();
+    }
+
+    auto operator=(node_handle_base&& other) noexcept -> node_handle_base& {
+        if (this == ciel::addressof(other)) [[unlikely]] {
+            return *this;
+        }
+
+        if (ptr_ == nullptr) {
+            if (other.ptr_ != nullptr) {
+                ::new (ciel::addressof(allocator_)) allocator_type(std::move(other.allocator_));
+            }
+
+        } else {
+            node_allocator node_alloc(allocator_);
+            node_alloc_traits::destroy(node_alloc, ptr_);
+            node_alloc_traits::deallocate(node_alloc, ptr_, 1);
+
+            if (other.ptr_ == nullptr) {
+                allocator_.~allocator_type();
+
+            } else if (alloc_traits::propagate_on_container_move_assignment::value) {
+                allocator_ = std::move(other.allocator_);
+            }
+        }
+
+        ptr_ = other.ptr_;
+        if (other.ptr_ != nullptr) {
+            other.ptr_ = nullptr;
+            other.allocator_.~allocator_type();
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return ptr_ == nullptr;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return !empty();
+    }
+
+    // precondition: !empty()
+    [[nodiscard]] auto get_allocator() const -> allocator_type {
+        CIEL_PRECONDITION(!empty());
+
+        return allocator_;
+    }
+
+    auto swap(node_handle_base& other) noexcept -> void {
+        using std::swap;
+
+        if (ptr_ != nullptr && other.ptr_ != nullptr) {
+            if (alloc_traits::propagate_on_container_swap::value) {
+                swap(allocator_, other.allocator_);
+            }
+
+        } else if (ptr_ != nullptr) {
+            ::new (ciel::addressof(other.allocator_)) allocator_type(std::move(allocator_));
+            allocator_.~allocator_type();
+
+        } else if (other.ptr_ != nullptr) {
+            ::new (ciel::addressof(allocator_)) allocator_type(std::move(other.allocator_));
+            other.allocator_.~allocator_type();
+        }
+
+        swap(ptr_, other.ptr_);
+    }
+
+};  // class node_handle_base
+
+// Containers create node handles and take nodes back through it.
+struct node_handle_access {
+    template<class Handle, class Node, class Allocator>
+    [[nodiscard]] static auto make(Node* p, const Allocator& alloc) noexcept -> Handle {
+        return Handle(p, alloc);
+    }
+
+    template<class Handle>
+    [[nodiscard]] static auto node(const Handle& handle) noexcept {
+        return handle.node();
+    }
+
+    template<class Handle>
+    [[nodiscard]] static auto release(Handle& handle) noexcept {
+        return handle.release();
+    }
+
+};  // struct node_handle_access
+
+}   // namespace details
+
+template<class Node, class Allocator>
+class set_node_handle : public details::node_handle_base<Node, Allocator> {
+private:
+    using base_type = details::node_handle_base<Node, Allocator>;
+
+    friend struct details::node_handle_access;
+
+    set_node_handle(Node* p, const Allocator& alloc) noexcept
+        : base_type(p, alloc) {}
+
+public:
+    using value_type     = decltype(Node::value_);
+    using allocator_type = Allocator;
+
+    constexpr set_node_handle() noexcept = default;
+
+    set_node_handle(set_node_handle&&) noexcept = default;
+    auto operator=(set_node_handle&&) noexcept -> set_node_handle& = default;
+
+    ~set_node_handle() = default;
+
+    // precondition: !empty()
+    [[nodiscard]] auto value() const -> value_type& {
+        CIEL_PRECONDITION(!this->empty());
+
+        return this->node()->value_;
+    }
+
+    auto swap(set_node_handle& other) noexcept -> void {
+        base_type::swap(other);
+    }
+
+};  // class set_node_handle
+
+template<class Node, class Allocator>
+class map_node_handle : public details::node_handle_base<Node, Allocator> {
+private:
+    using base_type = details::node_handle_base<Node, Allocator>;
+
+    friend struct details::node_handle_access;
+
+    map_node_handle(Node* p, const Allocator& alloc) noexcept
+        : base_type(p, alloc) {}
+
+public:
+    using key_type       = remove_const_t<typename decltype(Node::value_)::first_type>;
+    using mapped_type    = typename decltype(Node::value_)::second_type;
+    using allocator_type = Allocator;
+
+    constexpr map_node_handle() noexcept = default;
+
+    map_node_handle(map_node_handle&&) noexcept = default;
+    auto operator=(map_node_handle&&) noexcept -> map_node_handle& = default;
+
+    ~map_node_handle() = default;
+
+    // precondition: !empty()
+    // The key is stored as const in the container, it can be modified only while it's extracted.
+    [[nodiscard]] auto key() const -> key_type& {
+        CIEL_PRECONDITION(!this->empty());
+
+        return const_cast<key_type&>(this->node()->value_.first);
+    }
+
+    // precondition: !empty()
+    [[nodiscard]] auto mapped() const -> mapped_type& {
+        CIEL_PRECONDITION(!this->empty());
+
+        return this->node()->value_.second;
+    }
+
+    auto swap(map_node_handle& other) noexcept -> void {
+        base_type::swap(other);
+    }
+
+};  // class map_node_handle
+
+template<class Iter, class NodeType>
+struct node_insert_return {
+    Iter position;
+    bool inserted;
+    NodeType node;
+
+};  // struct node_insert_return
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class Node, class Allocator>
+auto swap(ciel::set_node_handle<Node, Allocator>& lhs, ciel::set_node_handle<Node, Allocator>& rhs) noexcept
+    -> void {
+    lhs.swap(rhs);
+}
+
+template<class Node, class Allocator>
+auto swap(ciel::map_node_handle<Node, Allocator>& lhs, ciel::map_node_handle<Node, Allocator>& rhs) noexcept
+    -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_NODE_HANDLE_HPP_
\ No newline at end of file
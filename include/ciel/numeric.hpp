@@ -2,9 +2,14 @@
 #define CIELUTILS_INCLUDE_CIEL_NUMERIC_HPP_
 
 #include <ciel/numeric_impl/accumulate.hpp>
+#include <ciel/numeric_impl/exclusive_scan.hpp>
 #include <ciel/numeric_impl/gcd.hpp>
+#include <ciel/numeric_impl/inclusive_scan.hpp>
 #include <ciel/numeric_impl/iota.hpp>
 #include <ciel/numeric_impl/lcm.hpp>
 #include <ciel/numeric_impl/reduce.hpp>
+#include <ciel/numeric_impl/transform_exclusive_scan.hpp>
+#include <ciel/numeric_impl/transform_inclusive_scan.hpp>
+#include <ciel/numeric_impl/transform_reduce.hpp>
 
 #endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_HPP_
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_EXCLUSIVE_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_EXCLUSIVE_SCAN_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/functional_impl/plus.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/numeric_impl/inclusive_scan.hpp>
+#include <ciel/numeric_impl/parallel_scan.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class InputIt, class OutputIt, class T, class BinaryOp>
+constexpr auto exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init, BinaryOp op) -> OutputIt {
+#ifdef __SSE2__
+    if constexpr (details::simd_prefix_summable<InputIt, OutputIt, BinaryOp, T>) {
+        if (!ciel::is_constant_evaluated()) {
+            const auto n = last - first;
+            const T* p = ciel::to_address(first);
+            details::simd_prefix_sum<true>(p, p + n, ciel::to_address(d_first), init);
+            return d_first + n;
+        }
+    }
+#endif
+
+    // *first is read before *d_first is written, they may be the same element
+    for (; first != last; ++first, ++d_first) {
+        T next = op(init, *first);
+        *d_first = std::move(init);
+        init = std::move(next);
+    }
+    return d_first;
+}
+
+template<class InputIt, class OutputIt, class T>
+constexpr auto exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init) -> OutputIt {
+    return ciel::exclusive_scan(first, last, d_first, std::move(init), ciel::plus<>());
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T, class BinaryOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto exclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, T init,
+                    BinaryOp op) -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        return details::parallel_scan(policy, first, last, d_first, std::move(init), op,
+            [](ForwardIt1 it) -> decltype(auto) {
+                return *it;
+            },
+            [&op](ForwardIt1 b, ForwardIt1 e, ForwardIt2 d, T carry) {
+                ciel::exclusive_scan(b, e, d, std::move(carry), op);
+            });
+
+    } else {
+        return ciel::exclusive_scan(first, last, d_first, std::move(init), op);
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto exclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, T init)
+    -> ForwardIt2 {
+    return ciel::exclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, d_first, std::move(init),
+                                ciel::plus<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_EXCLUSIVE_SCAN_HPP_
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_INCLUSIVE_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_INCLUSIVE_SCAN_HPP_
+
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/functional_impl/plus.hpp>
+#include <ciel/iterator_impl/iter_alias.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/memory_impl/to_address.hpp>
+#include <ciel/numeric_impl/parallel_scan.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <ciel/type_traits_impl/is_integral.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <utility>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+NAMESPACE_CIEL_BEGIN
+
+namespace details {
+
+// Prefix sums of 32-bit integers, whose additions wrap around like the SIMD ones.
+// 64-bit ones are left to the scalar loop, two lanes don't pay for the carry broadcast.
+template<class InputIt, class OutputIt, class BinaryOp, class T>
+concept simd_prefix_summable = plain_contiguous_iterator<InputIt> && plain_contiguous_iterator<OutputIt>
+    && is_same_v<iter_value_t<InputIt>, T> && is_same_v<iter_value_t<OutputIt>, T>
+    && is_integral_v<T> && sizeof(T) == 4
+    && (is_same_v<BinaryOp, plus<>> || is_same_v<BinaryOp, plus<T>>);
+
+#ifdef __SSE2__
+
+// A register of four elements is summed in place by two shifted additions,
+// then the carry, which is the last sum of the previous register broadcast to all lanes, is added.
+// Exclusive sums are the inclusive ones minus the elements themselves.
+// d_first may be equal to first. Returns init plus all the elements.
+template<bool Exclusive, class T>
+auto simd_prefix_sum(const T* first, const T* last, T* d_first, T init) noexcept -> T {
+    __m128i carry = _mm_set1_epi32(static_cast<int>(init));
+
+    for (; last - first >= 4; first += 4, d_first += 4) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        __m128i x = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, carry);
+        carry = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+        if constexpr (Exclusive) {
+            x = _mm_sub_epi32(x, v);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(d_first), x);
+    }
+
+    init = static_cast<T>(_mm_cvtsi128_si32(carry));
+    for (; first != last; ++first, ++d_first) {
+        const T v = *first;
+        if constexpr (Exclusive) {
+            *d_first = init;
+            init = static_cast<T>(init + v);
+        } else {
+            init = static_cast<T>(init + v);
+            *d_first = init;
+        }
+    }
+    return init;
+}
+
+#endif // __SSE2__
+
+}   // namespace details
+
+template<class InputIt, class OutputIt, class BinaryOp, class T>
+constexpr auto inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOp op, T init) -> OutputIt {
+#ifdef __SSE2__
+    if constexpr (details::simd_prefix_summable<InputIt, OutputIt, BinaryOp, T>) {
+        if (!ciel::is_constant_evaluated()) {
+            const auto n = last - first;
+            const T* p = ciel::to_address(first);
+            details::simd_prefix_sum<false>(p, p + n, ciel::to_address(d_first), init);
+            return d_first + n;
+        }
+    }
+#endif
+
+    for (; first != last; ++first, ++d_first) {
+        init = op(std::move(init), *first);
+        *d_first = init;
+    }
+    return d_first;
+}
+
+template<class InputIt, class OutputIt, class BinaryOp>
+constexpr auto inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOp op) -> OutputIt {
+    if (first == last) {
+        return d_first;
+    }
+
+    typename iterator_traits<InputIt>::value_type init = *first;
+    *d_first = init;
+    return ciel::inclusive_scan(++first, last, ++d_first, op, std::move(init));
+}
+
+template<class InputIt, class OutputIt>
+constexpr auto inclusive_scan(InputIt first, InputIt last, OutputIt d_first) -> OutputIt {
+    return ciel::inclusive_scan(first, last, d_first, ciel::plus<>());
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOp, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOp op,
+                    T init) -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        return details::parallel_scan(policy, first, last, d_first, std::move(init), op,
+            [](ForwardIt1 it) -> decltype(auto) {
+                return *it;
+            },
+            [&op](ForwardIt1 b, ForwardIt1 e, ForwardIt2 d, T carry) {
+                ciel::inclusive_scan(b, e, d, op, std::move(carry));
+            });
+
+    } else {
+        return ciel::inclusive_scan(first, last, d_first, op, std::move(init));
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, BinaryOp op)
+    -> ForwardIt2 {
+    if (first == last) {
+        return d_first;
+    }
+
+    typename iterator_traits<ForwardIt1>::value_type init = *first;
+    *d_first = init;
+    return ciel::inclusive_scan(std::forward<ExecutionPolicy>(policy), ++first, last, ++d_first, op, std::move(init));
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
+    requires details::execution_policy<ExecutionPolicy>
+auto inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first) -> ForwardIt2 {
+    return ciel::inclusive_scan(std::forward<ExecutionPolicy>(policy), first, last, d_first, ciel::plus<>());
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_INCLUSIVE_SCAN_HPP_
\ No newline at end of file
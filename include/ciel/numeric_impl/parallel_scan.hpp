@@ -0,0 +1,78 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_PARALLEL_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_PARALLEL_SCAN_HPP_
+
+#include <ciel/algorithm_impl/min.hpp>
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+namespace details {
+
+// Two-pass block scan of [first, last) to d_first, all the scans with execution policies share it:
+// 1. All pieces but the last one are reduced in parallel.
+// 2. A sequential exclusive scan of these reductions from init gives the carry of every piece,
+//    i.e. init followed by all the elements before the piece.
+// 3. All pieces are scanned in parallel from their carries, by the sequential scans with SIMD if they have.
+// So every element is read twice and written once, and the sequential step only touches one value per piece.
+//
+// element(it) is the element at it, transformed by transform scans,
+// scan_piece(piece_first, piece_last, piece_d_first, carry) is the sequential scan.
+template<class ExecutionPolicy, class RandomIt1, class RandomIt2, class T, class BinaryOp, class Element,
+         class ScanPiece>
+auto parallel_scan(const ExecutionPolicy& policy, RandomIt1 first, RandomIt1 last, RandomIt2 d_first, T init,
+                   BinaryOp& op, Element&& element, ScanPiece&& scan_piece) -> RandomIt2 {
+    thread_pool& pool = details::policy_pool(policy);
+    const size_t n = static_cast<size_t>(last - first);
+    const size_t grain = details::policy_grain(policy, pool, n);
+    const size_t piece_count = (n + grain - 1) / grain;
+
+    if (piece_count <= 1) {
+        scan_piece(first, last, d_first, std::move(init));
+        return d_first + n;
+    }
+
+    // Reductions start from the first elements, since op doesn't need to have an identity element
+    vector<T> carries;
+    carries.reserve(piece_count);
+    for (size_t piece = 0; piece < piece_count; ++piece) {
+        carries.emplace_back(element(first + piece * grain));
+    }
+
+    auto reduce_pieces = [&](const size_t b, const size_t e) {
+        for (size_t piece = b; piece != e; ++piece) {
+            const size_t piece_last = (piece + 1) * grain;
+            for (size_t i = piece * grain + 1; i != piece_last; ++i) {
+                carries[piece] = op(std::move(carries[piece]), element(first + i));
+            }
+        }
+    };
+    details::parallel_for(pool, size_t(0), piece_count - 1, size_t(1), reduce_pieces);
+
+    for (size_t piece = 0; piece + 1 < piece_count; ++piece) {
+        T sum = op(init, std::move(carries[piece]));
+        carries[piece] = std::move(init);
+        init = std::move(sum);
+    }
+    carries.back() = std::move(init);
+
+    auto scan_pieces = [&](const size_t b, const size_t e) {
+        for (size_t piece = b; piece != e; ++piece) {
+            const size_t piece_first = piece * grain;
+            const size_t piece_last = ciel::min(n, piece_first + grain);
+            scan_piece(first + piece_first, first + piece_last, d_first + piece_first, std::move(carries[piece]));
+        }
+    };
+    details::parallel_for(pool, size_t(0), piece_count, size_t(1), scan_pieces);
+
+    return d_first + n;
+}
+
+}   // namespace details
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_PARALLEL_SCAN_HPP_
\ No newline at end of file
@@ -2,8 +2,12 @@
 #define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_REDUCE_HPP_
 
 #include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
 #include <ciel/functional_impl/plus.hpp>
 #include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <cstddef>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -25,6 +29,63 @@ constexpr auto reduce(InputIt first, InputIt last) -> typename iterator_traits<I
     return ciel::reduce(first, last, typename iterator_traits<InputIt>::value_type{});
 }
 
+namespace details {
+
+// Reduces element(i) for i in [first, last) into init, element(i) is the i-th element, possibly transformed.
+// binary_op is associative and commutative for reduce, but we keep the order of elements anyway.
+// The right half starts from its first element instead of an identity element, which reduce doesn't have.
+template<class T, class BinaryOp, class Element>
+auto parallel_reduce(thread_pool& pool, size_t first, const size_t last, const size_t grain, T init,
+                     BinaryOp& binary_op, Element& element) -> T {
+    if (last - first <= grain) {
+        for (; first != last; ++first) {
+            init = binary_op(std::move(init), element(first));
+        }
+        return init;
+    }
+
+    const size_t mid = first + (last - first) / 2;
+    T left(std::move(init));
+    T right(element(mid));
+    details::parallel_invoke(pool,
+        [&] { left = details::parallel_reduce(pool, first, mid, grain, std::move(left), binary_op, element); },
+        [&] { right = details::parallel_reduce(pool, mid + 1, last, grain, std::move(right), binary_op, element); });
+    return binary_op(std::move(left), std::move(right));
+}
+
+}   // namespace details
+
+template<class ExecutionPolicy, class ForwardIt, class T, class BinaryOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryOp binary_op) -> T {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        thread_pool& pool = details::policy_pool(policy);
+        const size_t n = static_cast<size_t>(last - first);
+        auto element = [first](const size_t i) -> decltype(auto) {
+            return first[i];
+        };
+        return details::parallel_reduce(pool, size_t(0), n, details::policy_grain(policy, pool, n), std::move(init),
+                                        binary_op, element);
+
+    } else {
+        return ciel::reduce(first, last, std::move(init), binary_op);
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init) -> T {
+    return ciel::reduce(std::forward<ExecutionPolicy>(policy), first, last, std::move(init), ciel::plus<>());
+}
+
+template<class ExecutionPolicy, class ForwardIt>
+    requires details::execution_policy<ExecutionPolicy>
+auto reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last)
+    -> typename iterator_traits<ForwardIt>::value_type {
+    return ciel::reduce(std::forward<ExecutionPolicy>(policy), first, last,
+                        typename iterator_traits<ForwardIt>::value_type{});
+}
+
 NAMESPACE_CIEL_END
 
 #endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_REDUCE_HPP_
\ No newline at end of file
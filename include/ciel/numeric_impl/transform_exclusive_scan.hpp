@@ -0,0 +1,45 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_EXCLUSIVE_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_EXCLUSIVE_SCAN_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/numeric_impl/parallel_scan.hpp>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class InputIt, class OutputIt, class T, class BinaryOp, class UnaryOp>
+constexpr auto transform_exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init, BinaryOp binary_op,
+                                        UnaryOp unary_op) -> OutputIt {
+    // *first is read before *d_first is written, they may be the same element
+    for (; first != last; ++first, ++d_first) {
+        T next = binary_op(init, unary_op(*first));
+        *d_first = std::move(init);
+        init = std::move(next);
+    }
+    return d_first;
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T, class BinaryOp, class UnaryOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_exclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first, T init,
+                              BinaryOp binary_op, UnaryOp unary_op) -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        return details::parallel_scan(policy, first, last, d_first, std::move(init), binary_op,
+            [&unary_op](ForwardIt1 it) -> decltype(auto) {
+                return unary_op(*it);
+            },
+            [&binary_op, &unary_op](ForwardIt1 b, ForwardIt1 e, ForwardIt2 d, T carry) {
+                ciel::transform_exclusive_scan(b, e, d, std::move(carry), binary_op, unary_op);
+            });
+
+    } else {
+        return ciel::transform_exclusive_scan(first, last, d_first, std::move(init), binary_op, unary_op);
+    }
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_EXCLUSIVE_SCAN_HPP_
\ No newline at end of file
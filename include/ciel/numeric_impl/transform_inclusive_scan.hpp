@@ -0,0 +1,70 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_INCLUSIVE_SCAN_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_INCLUSIVE_SCAN_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/numeric_impl/parallel_scan.hpp>
+#include <ciel/type_traits_impl/decay.hpp>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class InputIt, class OutputIt, class BinaryOp, class UnaryOp, class T>
+constexpr auto transform_inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOp binary_op,
+                                        UnaryOp unary_op, T init) -> OutputIt {
+    for (; first != last; ++first, ++d_first) {
+        init = binary_op(std::move(init), unary_op(*first));
+        *d_first = init;
+    }
+    return d_first;
+}
+
+template<class InputIt, class OutputIt, class BinaryOp, class UnaryOp>
+constexpr auto transform_inclusive_scan(InputIt first, InputIt last, OutputIt d_first, BinaryOp binary_op,
+                                        UnaryOp unary_op) -> OutputIt {
+    if (first == last) {
+        return d_first;
+    }
+
+    decay_t<decltype(unary_op(*first))> init = unary_op(*first);
+    *d_first = init;
+    return ciel::transform_inclusive_scan(++first, last, ++d_first, binary_op, unary_op, std::move(init));
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOp, class UnaryOp, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                              BinaryOp binary_op, UnaryOp unary_op, T init) -> ForwardIt2 {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        return details::parallel_scan(policy, first, last, d_first, std::move(init), binary_op,
+            [&unary_op](ForwardIt1 it) -> decltype(auto) {
+                return unary_op(*it);
+            },
+            [&binary_op, &unary_op](ForwardIt1 b, ForwardIt1 e, ForwardIt2 d, T carry) {
+                ciel::transform_inclusive_scan(b, e, d, binary_op, unary_op, std::move(carry));
+            });
+
+    } else {
+        return ciel::transform_inclusive_scan(first, last, d_first, binary_op, unary_op, std::move(init));
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class BinaryOp, class UnaryOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_inclusive_scan(ExecutionPolicy&& policy, ForwardIt1 first, ForwardIt1 last, ForwardIt2 d_first,
+                              BinaryOp binary_op, UnaryOp unary_op) -> ForwardIt2 {
+    if (first == last) {
+        return d_first;
+    }
+
+    decay_t<decltype(unary_op(*first))> init = unary_op(*first);
+    *d_first = init;
+    return ciel::transform_inclusive_scan(std::forward<ExecutionPolicy>(policy), ++first, last, ++d_first, binary_op,
+                                          unary_op, std::move(init));
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_INCLUSIVE_SCAN_HPP_
\ No newline at end of file
@@ -0,0 +1,87 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_REDUCE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_REDUCE_HPP_
+
+#include <ciel/config.hpp>
+#include <ciel/execution_impl/execution_policy.hpp>
+#include <ciel/execution_impl/parallel_backend.hpp>
+#include <ciel/functional_impl/multiplies.hpp>
+#include <ciel/functional_impl/plus.hpp>
+#include <ciel/iterator_impl/random_access_iterator.hpp>
+#include <ciel/numeric_impl/reduce.hpp>
+#include <cstddef>
+#include <utility>
+
+NAMESPACE_CIEL_BEGIN
+
+template<class InputIt1, class InputIt2, class T, class BinaryReductionOp, class BinaryTransformOp>
+constexpr auto transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init, BinaryReductionOp reduce,
+                                BinaryTransformOp transform) -> T {
+    for (; first1 != last1; ++first1, ++first2) {
+        init = reduce(std::move(init), transform(*first1, *first2));
+    }
+    return init;
+}
+
+// Inner product
+template<class InputIt1, class InputIt2, class T>
+constexpr auto transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init) -> T {
+    return ciel::transform_reduce(first1, last1, first2, std::move(init), ciel::plus<>(), ciel::multiplies<>());
+}
+
+template<class InputIt, class T, class BinaryReductionOp, class UnaryTransformOp>
+constexpr auto transform_reduce(InputIt first, InputIt last, T init, BinaryReductionOp reduce,
+                                UnaryTransformOp transform) -> T {
+    for (; first != last; ++first) {
+        init = reduce(std::move(init), transform(*first));
+    }
+    return init;
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T, class BinaryReductionOp,
+         class BinaryTransformOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init,
+                      BinaryReductionOp reduce, BinaryTransformOp transform) -> T {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt1>
+                  && random_access_iterator<ForwardIt2>) {
+        thread_pool& pool = details::policy_pool(policy);
+        const size_t n = static_cast<size_t>(last1 - first1);
+        auto element = [first1, first2, &transform](const size_t i) -> decltype(auto) {
+            return transform(first1[i], first2[i]);
+        };
+        return details::parallel_reduce(pool, size_t(0), n, details::policy_grain(policy, pool, n), std::move(init),
+                                        reduce, element);
+
+    } else {
+        return ciel::transform_reduce(first1, last1, first2, std::move(init), reduce, transform);
+    }
+}
+
+template<class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_reduce(ExecutionPolicy&& policy, ForwardIt1 first1, ForwardIt1 last1, ForwardIt2 first2, T init) -> T {
+    return ciel::transform_reduce(std::forward<ExecutionPolicy>(policy), first1, last1, first2, std::move(init),
+                                  ciel::plus<>(), ciel::multiplies<>());
+}
+
+template<class ExecutionPolicy, class ForwardIt, class T, class BinaryReductionOp, class UnaryTransformOp>
+    requires details::execution_policy<ExecutionPolicy>
+auto transform_reduce(ExecutionPolicy&& policy, ForwardIt first, ForwardIt last, T init, BinaryReductionOp reduce,
+                      UnaryTransformOp transform) -> T {
+    if constexpr (details::parallel_execution_policy<ExecutionPolicy> && random_access_iterator<ForwardIt>) {
+        thread_pool& pool = details::policy_pool(policy);
+        const size_t n = static_cast<size_t>(last - first);
+        auto element = [first, &transform](const size_t i) -> decltype(auto) {
+            return transform(first[i]);
+        };
+        return details::parallel_reduce(pool, size_t(0), n, details::policy_grain(policy, pool, n), std::move(init),
+                                        reduce, element);
+
+    } else {
+        return ciel::transform_reduce(first, last, std::move(init), reduce, transform);
+    }
+}
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_NUMERIC_IMPL_TRANSFORM_REDUCE_HPP_
\ No newline at end of file
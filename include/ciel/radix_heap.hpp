@@ -0,0 +1,176 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_RADIX_HEAP_HPP_
+#define CIELUTILS_INCLUDE_CIEL_RADIX_HEAP_HPP_
+
+#include <bit>  // for std::bit_width
+#include <ciel/algorithm_impl/radix_sort.hpp>
+#include <ciel/array.hpp>
+#include <ciel/concepts_impl/floating_point.hpp>
+#include <ciel/config.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/utility_impl/pair.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+
+NAMESPACE_CIEL_BEGIN
+
+// A monotone min priority queue: every pushed key must be not less than the last key returned by top().
+// Dijkstra and event simulations satisfy it, since what they push is never earlier than what they just popped.
+//
+// Keys are transformed into unsigned integers as radix_sort does, and last_ is the (transformed) last top key.
+// An element is in bucket i if the highest bit where its key differs from last_ is bit i - 1,
+// and in bucket 0 if its key equals to last_. When bucket 0 is empty, the first non-empty bucket i
+// is redistributed: last_ becomes its minimum key, and all of its elements move to lower buckets,
+// since they share the higher bits with the new last_. Every element moves down at most (bits + 1) times,
+// so push and pop are amortized O(log C), and all the work is sequential scans of vectors.
+
+template<details::radix_sortable_key Key, class Value, class Allocator = allocator<pair<Key, Value>>>
+class radix_heap {
+public:
+    using key_type        = Key;
+    using mapped_type     = Value;
+    using value_type      = pair<key_type, mapped_type>;
+    using allocator_type  = Allocator;
+    using size_type       = size_t;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+
+private:
+    using encoded_type = decltype(details::radix_key(key_type()));
+    using bucket_type  = vector<value_type, allocator_type>;
+
+    static constexpr size_t bucket_count = sizeof(encoded_type) * 8 + 1;
+
+    array<bucket_type, bucket_count> buckets_;
+    encoded_type last_{0};
+    size_type size_{0};
+
+    [[nodiscard]] static auto encode(const key_type key) noexcept -> encoded_type {
+        if constexpr (floating_point<key_type>) {
+            // -0.0 and 0.0 must be the same key
+            return details::radix_key(key == key_type(0) ? key_type(0) : key);
+
+        } else {
+            return details::radix_key(key);
+        }
+    }
+
+    [[nodiscard]] auto bucket_index(const encoded_type e) const noexcept -> size_t {
+        return static_cast<size_t>(std::bit_width(static_cast<encoded_type>(e ^ last_)));
+    }
+
+    // Refill bucket 0 from the first non-empty bucket
+    // precondition: !empty() && buckets_[0].empty()
+    auto pull() -> void {
+        size_t i = 1;
+        while (buckets_[i].empty()) {
+            ++i;
+        }
+
+        bucket_type& bucket = buckets_[i];
+        encoded_type new_last = encode(bucket.front().first);
+        for (const value_type& v : bucket) {
+            const encoded_type e = encode(v.first);
+            new_last = e < new_last ? e : new_last;
+        }
+        last_ = new_last;
+
+        for (value_type& v : bucket) {
+            buckets_[bucket_index(encode(v.first))].emplace_back(std::move(v));
+        }
+        bucket.clear();
+    }
+
+public:
+    radix_heap() = default;
+
+    explicit radix_heap(const allocator_type& alloc) {
+        for (bucket_type& bucket : buckets_) {
+            bucket = bucket_type(alloc);
+        }
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return buckets_[0].get_allocator();
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    // The element with the minimum key, it may redistribute a bucket so it's not const.
+    // precondition: !empty()
+    [[nodiscard]] auto top() -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        if (buckets_[0].empty()) {
+            pull();
+        }
+        return buckets_[0].back();
+    }
+
+    // precondition: key is not less than the last key returned by top()
+    auto push(const key_type key, const mapped_type& value) -> void {
+        emplace(key, value);
+    }
+
+    auto push(const key_type key, mapped_type&& value) -> void {
+        emplace(key, std::move(value));
+    }
+
+    // precondition: key is not less than the last key returned by top()
+    template<class... Args>
+    auto emplace(const key_type key, Args&& ... args) -> void {
+        const encoded_type e = encode(key);
+        CIEL_PRECONDITION(last_ <= e);
+
+        buckets_[bucket_index(e)].emplace_back(key, mapped_type(std::forward<Args>(args)...));
+        ++size_;
+    }
+
+    // precondition: !empty()
+    auto pop() -> void {
+        CIEL_PRECONDITION(!empty());
+
+        if (buckets_[0].empty()) {
+            pull();
+        }
+        buckets_[0].pop_back();
+        --size_;
+    }
+
+    // Also resets the monotone lower bound of keys
+    auto clear() noexcept -> void {
+        for (bucket_type& bucket : buckets_) {
+            bucket.clear();
+        }
+        last_ = 0;
+        size_ = 0;
+    }
+
+    auto swap(radix_heap& other) noexcept -> void {
+        for (size_t i = 0; i < bucket_count; ++i) {
+            buckets_[i].swap(other.buckets_[i]);
+        }
+        std::swap(last_, other.last_);
+        std::swap(size_, other.size_);
+    }
+
+};  // class radix_heap
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class Key, class Value, class Allocator>
+auto swap(ciel::radix_heap<Key, Value, Allocator>& lhs, ciel::radix_heap<Key, Value, Allocator>& rhs) noexcept
+    -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_RADIX_HEAP_HPP_
\ No newline at end of file
@@ -4,12 +4,13 @@
 #include <ciel/avl.hpp>
 #include <ciel/config.hpp>
 #include <ciel/memory_impl/allocator.hpp>
+#include <ciel/node_handle.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
-// TODO: operator<=>, node_type, insert_return_type, extract, merge
+// TODO: operator<=>
 
-template<class Key, class Compare = less<Key>, class Allocator = allocator<Key>>
+template<class Key, class Compare = less<Key>, class Allocator = allocator<Key>, class Augmentation = void>
 class set {
 public:
     using key_type               = Key;
@@ -25,7 +26,7 @@ public:
     using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
 
 private:
-    using tree_type              = avl<value_type, value_compare, allocator_type>;
+    using tree_type              = avl<value_type, value_compare, allocator_type, Augmentation>;
     using alloc_traits           = allocator_traits<allocator_type>;
 
 public:
@@ -35,6 +36,9 @@ public:
     using reverse_iterator       = ciel::reverse_iterator<iterator>;
     using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
 
+    using node_type              = set_node_handle<typename tree_type::node_type, allocator_type>;
+    using insert_return_type     = node_insert_return<iterator, node_type>;
+
 private:
     tree_type tree_;
 
@@ -199,11 +203,80 @@ public:
         return tree_.erase(x);
     }
 
+    auto extract(iterator pos) noexcept -> node_type {
+        return details::node_handle_access::make<node_type>(tree_.extract(pos), get_allocator());
+    }
+
+    auto extract(const key_type& key) -> node_type {
+        if (auto pos = find(key); pos != end()) {
+            return extract(pos);
+        }
+        return node_type();
+    }
+
+    auto insert(node_type&& nh) -> insert_return_type {
+        if (nh.empty()) {
+            return {end(), false, node_type()};
+        }
+
+        CIEL_PRECONDITION(nh.get_allocator() == get_allocator());
+
+        auto [pos, inserted] = tree_.insert_node_unique(details::node_handle_access::node(nh));
+        if (inserted) {
+            static_cast<void>(details::node_handle_access::release(nh));
+            return {pos, true, node_type()};
+        }
+        return {pos, false, std::move(nh)};
+    }
+
+    auto insert(iterator hint, node_type&& nh) -> iterator {
+        if (nh.empty()) {
+            return end();
+        }
+
+        CIEL_PRECONDITION(nh.get_allocator() == get_allocator());
+
+        auto [pos, inserted] = tree_.insert_node_unique_hint(hint, details::node_handle_access::node(nh));
+        if (inserted) {
+            static_cast<void>(details::node_handle_access::release(nh));
+        }
+        return pos;
+    }
+
+    // Moves the elements of source whose keys are not in *this, by relinking their nodes.
+    // precondition: get_allocator() == source.get_allocator()
+    auto merge(set& source) -> void {
+        tree_.merge_unique(source.tree_);
+    }
+
+    auto merge(set&& source) -> void {
+        merge(source);
+    }
+
     auto swap(set& other)
         noexcept(alloc_traits::is_always_equal::value && is_nothrow_swappable_v<value_compare>) -> void {
         tree_.swap(other.tree_);
     }
 
+    // Set algebra in M log(N / M + 1) for sizes M <= N, rather than M insertions or erasures.
+    // unite keeps the elements of *this for equivalent keys.
+    // precondition: Compare doesn't throw, a throwing comparison calls std::terminate
+    auto unite(set&& other) -> void {
+        tree_.unite(std::move(other.tree_));
+    }
+
+    auto unite(const set& other) -> void {
+        tree_.unite(other.tree_);
+    }
+
+    auto intersect(const set& other) -> void {
+        tree_.intersect(other.tree_);
+    }
+
+    auto subtract(const set& other) -> void {
+        tree_.subtract(other.tree_);
+    }
+
     [[nodiscard]] auto count(const Key& key) const -> size_type {
         return tree_.count_unique(key);
     }
@@ -304,6 +377,40 @@ public:
         return tree_.upper_bound(x);
     }
 
+    // Order statistics in O(log N), only with avl_subtree_size as Augmentation.
+
+    // Returns end() if k >= size().
+    [[nodiscard]] auto nth(const size_type k) -> iterator
+        requires tree_type::order_statistics
+    {
+        return tree_.nth(k);
+    }
+
+    [[nodiscard]] auto nth(const size_type k) const -> const_iterator
+        requires tree_type::order_statistics
+    {
+        return tree_.nth(k);
+    }
+
+    // The number of elements whose keys are less than key.
+    [[nodiscard]] auto rank(const Key& key) const -> size_type
+        requires tree_type::order_statistics
+    {
+        return tree_.rank(key);
+    }
+
+    template<class K>
+        requires requires { typename value_compare::is_transparent; } && tree_type::order_statistics
+    [[nodiscard]] auto rank(const K& x) const -> size_type {
+        return tree_.rank(x);
+    }
+
+    [[nodiscard]] auto distance(const_iterator first, const_iterator last) const -> difference_type
+        requires tree_type::order_statistics
+    {
+        return tree_.distance(first, last);
+    }
+
     [[nodiscard]] auto key_comp() const -> key_compare {
         return value_comp();
     }
@@ -314,16 +421,18 @@ public:
 
 };  // class set
 
-template<class Key, class Compare, class Alloc>
-[[nodiscard]] auto operator==(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs) -> bool {
+template<class Key, class Compare, class Alloc, class Augmentation>
+[[nodiscard]] auto operator==(const set<Key, Compare, Alloc, Augmentation>& lhs,
+                              const set<Key, Compare, Alloc, Augmentation>& rhs) -> bool {
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template<class Key, class Compare, class Alloc, class Pred>
-auto erase_if(set<Key, Compare, Alloc>& c, Pred pred) -> typename set<Key, Compare, Alloc>::size_type {
+template<class Key, class Compare, class Alloc, class Augmentation, class Pred>
+auto erase_if(set<Key, Compare, Alloc, Augmentation>& c, Pred pred)
+    -> typename set<Key, Compare, Alloc, Augmentation>::size_type {
     auto old_size = c.size();
     for (auto i = c.begin(), last = c.end(); i != last;) {
         if (pred(*i)) {
@@ -353,9 +462,9 @@ NAMESPACE_CIEL_END
 
 namespace std {
 
-template<class Key, class Compare, class Alloc>
-auto swap(ciel::set<Key, Compare, Alloc>& lhs,
-          ciel::set<Key, Compare, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+template<class Key, class Compare, class Alloc, class Augmentation>
+auto swap(ciel::set<Key, Compare, Alloc, Augmentation>& lhs,
+          ciel::set<Key, Compare, Alloc, Augmentation>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
     lhs.swap(rhs);
 }
 
@@ -1,7 +1,10 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_SPLIT_BUFFER_HPP_
 #define CIELUTILS_INCLUDE_CIEL_SPLIT_BUFFER_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
+#include <ciel/algorithm_impl/copy.hpp>
 #include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/fill_n.hpp>
 #include <ciel/algorithm_impl/max.hpp>
 #include <ciel/algorithm_impl/move.hpp>
 #include <ciel/algorithm_impl/move_backward.hpp>
@@ -12,7 +15,11 @@
 #include <ciel/iterator_impl/wrap_iter.hpp>
 #include <ciel/memory_impl/allocator.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <ciel/type_traits_impl/is_constructible.hpp>
+#include <ciel/type_traits_impl/is_trivially_copyable.hpp>
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 
 NAMESPACE_CIEL_BEGIN
@@ -57,6 +64,12 @@ private:
     pointer end_cap_;
     [[no_unique_address]] allocator_type allocator_;
 
+    // Constructing value_type from Ref by the allocator is copying its bytes, so ranges can be memcpy-ed
+    template<class Ref>
+    static constexpr bool is_bitwise_constructible_from = is_trivially_copyable_v<value_type>
+        && is_trivially_constructible_v<value_type, Ref>
+        && !details::has_construct<allocator_type, value_type*, Ref>::value;
+
     constexpr auto alloc_range_destroy(pointer begin, pointer end) noexcept -> pointer {
         CIEL_PRECONDITION(begin <= end);
 
@@ -85,6 +98,17 @@ private:
 
     template<class Iter>
     constexpr auto alloc_range_construct(pointer begin, Iter first, Iter last) -> pointer {
+        if constexpr (details::plain_contiguous_iterator<Iter> && is_same_v<iter_value_t<Iter>, value_type>
+                      && is_bitwise_constructible_from<iter_reference_t<Iter>>) {
+            if (!ciel::is_constant_evaluated()) {
+                const size_type n = last - first;
+                if (n > 0) {
+                    std::memcpy(ciel::to_address(begin), ciel::to_address(first), n * sizeof(value_type));
+                }
+                return begin + n;
+            }
+        }
+
         pointer end = begin;
 
         CIEL_TRY {
@@ -102,25 +126,28 @@ private:
     }
 
     constexpr auto range_assign_n(pointer begin, const size_type n, const value_type& value) -> void {
-        for (size_type i = 0; i < n; ++i) {
-            *begin = value;
-            ++begin;
-        }
+        ciel::fill_n(ciel::to_address(begin), n, value);
     }
 
     template<class Iter>
     constexpr auto range_assign(pointer begin, Iter first, Iter last) -> void {
-        while (first != last) {
-            *begin = *first;
-            ++first;
-            ++begin;
-        }
+        ciel::copy(first, last, ciel::to_address(begin));
     }
 
     // Used in expansion
     constexpr auto alloc_range_move(pointer begin, pointer first, pointer last) noexcept -> pointer {
         CIEL_PRECONDITION(first <= last);
 
+        if constexpr (is_bitwise_constructible_from<value_type&&>) {
+            if (!ciel::is_constant_evaluated()) {
+                if (first != last) {
+                    std::memcpy(ciel::to_address(begin), ciel::to_address(first),
+                                static_cast<size_type>(last - first) * sizeof(value_type));
+                }
+                return begin + (last - first);
+            }
+        }
+
         pointer end = begin;
         while (first != last) {
             alloc_traits::construct(allocator_, end++, std::move(*first++));
@@ -1083,7 +1110,7 @@ template<class T, class Alloc>
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 // So that we can test more efficiently
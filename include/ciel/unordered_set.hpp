@@ -4,6 +4,7 @@
 #include <ciel/config.hpp>
 #include <ciel/hashtable.hpp>
 #include <ciel/memory_impl/allocator.hpp>
+#include <ciel/node_handle.hpp>
 
 NAMESPACE_CIEL_BEGIN
 
@@ -31,6 +32,8 @@ public:
     using const_iterator       = typename table_type::const_iterator;
     using local_iterator       = typename table_type::local_iterator;
     using const_local_iterator = typename table_type::const_local_iterator;
+    using node_type            = set_node_handle<hashtable_node<value_type>, allocator_type>;
+    using insert_return_type   = node_insert_return<iterator, node_type>;
 
 private:
     table_type table_;
@@ -221,6 +224,46 @@ public:
         return table_.erase_unique(x);
     }
 
+    auto extract(iterator pos) noexcept -> node_type {
+        return details::node_handle_access::make<node_type>(table_.extract(pos), get_allocator());
+    }
+
+    auto extract(const key_type& key) -> node_type {
+        if (auto pos = find(key); pos != end()) {
+            return extract(pos);
+        }
+        return node_type();
+    }
+
+    auto insert(node_type&& nh) -> insert_return_type {
+        if (nh.empty()) {
+            return {end(), false, node_type()};
+        }
+
+        CIEL_PRECONDITION(nh.get_allocator() == get_allocator());
+
+        auto [pos, inserted] = table_.insert_node_unique(details::node_handle_access::node(nh));
+        if (inserted) {
+            static_cast<void>(details::node_handle_access::release(nh));
+            return {pos, true, node_type()};
+        }
+        return {pos, false, std::move(nh)};
+    }
+
+    auto insert(iterator /*unused*/, node_type&& nh) -> iterator {
+        return insert(std::move(nh)).position;
+    }
+
+    // Moves the elements of source which are not in *this, by relinking their nodes.
+    // precondition: get_allocator() == source.get_allocator()
+    auto merge(unordered_set& source) -> void {
+        table_.merge_unique(source.table_);
+    }
+
+    auto merge(unordered_set&& source) -> void {
+        merge(source);
+    }
+
     auto swap(unordered_set& other)
         noexcept(alloc_traits::is_always_equal::value &&
                  is_nothrow_swappable_v<hasher> &&
@@ -258,6 +301,14 @@ public:
         return table_.find(x);
     }
 
+    // Writes find(key) of every key in keys to out as const_iterator, in the order of keys.
+    // Lookups of independent keys are interleaved, which is faster than calling find one by one
+    // when the table doesn't fit in cache.
+    template<class Keys, class OutputIt>
+    auto find_batch(const Keys& keys, OutputIt out) const -> OutputIt {
+        return table_.find_batch(keys.begin(), keys.end(), out);
+    }
+
     [[nodiscard]] auto contains(const Key& key) const -> bool {
         return table_.contains(key);
     }
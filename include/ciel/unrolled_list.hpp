@@ -0,0 +1,762 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_UNROLLED_LIST_HPP_
+#define CIELUTILS_INCLUDE_CIEL_UNROLLED_LIST_HPP_
+
+#include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/max.hpp>
+#include <ciel/algorithm_impl/move.hpp>
+#include <ciel/algorithm_impl/move_backward.hpp>
+#include <ciel/config.hpp>
+#include <ciel/iterator_impl/distance.hpp>
+#include <ciel/iterator_impl/iterator_tag.hpp>
+#include <ciel/iterator_impl/iterator_traits.hpp>
+#include <ciel/iterator_impl/legacy_input_iterator.hpp>
+#include <ciel/iterator_impl/next.hpp>
+#include <ciel/iterator_impl/prev.hpp>
+#include <ciel/iterator_impl/reverse_iterator.hpp>
+#include <ciel/list.hpp>
+#include <ciel/memory_impl/addressof.hpp>
+#include <ciel/memory_impl/allocator.hpp>
+#include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/is_move_assignable.hpp>
+#include <ciel/type_traits_impl/is_move_constructible.hpp>
+#include <ciel/type_traits_impl/is_same.hpp>
+#include <cstddef>
+#include <initializer_list>
+
+NAMESPACE_CIEL_BEGIN
+
+// An unrolled list is a doubly linked list of blocks, each block holds up to block_capacity elements
+// contiguously at its front. Iteration touches one cache miss per block instead of one per element,
+// and inserting or erasing in the middle moves at most one block of elements.
+//
+// A block that gets full on insertion is split in halves. After erasing, a block is merged with a neighbour
+// when both fit into 3/4 of a block, so that a split block doesn't merge back right away, and empty blocks are freed.
+//
+// Iterators are a block and an index in it. Insertion and erasure only invalidate iterators into the blocks
+// they touch: the block itself, the new block of a split, or the neighbour of a merge.
+// Iterators into other blocks and end() stay valid.
+//
+// Differences between std::list and this class:
+// T is not allowed to throw in move constructor/assignment, since blocks move elements around
+// Iterators are invalidated as above, and there is no splice
+
+template<class T, size_t BlockBytes>
+constexpr auto unrolled_list_block_capacity() noexcept -> size_t {
+    constexpr size_t header = sizeof(list_node_base) + sizeof(size_t);
+    return BlockBytes > header + 2 * sizeof(T) ? (BlockBytes - header) / sizeof(T) : 2;
+}
+
+template<class T, size_t Capacity>
+struct unrolled_list_node : list_node_base {
+    size_t size_;
+
+    union {
+        T values_[Capacity];
+    };
+
+    unrolled_list_node() noexcept
+        : size_(0) {}
+
+    // Elements are destroyed by the container
+    ~unrolled_list_node() {}
+
+    [[nodiscard]] auto full() const noexcept -> bool {
+        return size_ == Capacity;
+    }
+
+};  // struct unrolled_list_node
+
+template<class T, size_t Capacity, class Pointer, class Reference>
+class unrolled_list_iterator {
+public:
+    using difference_type   = ptrdiff_t;
+    using value_type        = T;
+    using pointer           = Pointer;
+    using reference         = Reference;
+    using iterator_category = bidirectional_iterator_tag;
+    using iterator_concept  = bidirectional_iterator_tag;
+
+private:
+    using base_node_type    = list_node_base;
+    using node_type         = unrolled_list_node<value_type, Capacity>;
+
+    base_node_type* node_;
+    size_t index_;
+
+public:
+    unrolled_list_iterator() noexcept : node_(nullptr), index_(0) {}
+
+    unrolled_list_iterator(const base_node_type* node, const size_t index) noexcept
+        : node_(const_cast<base_node_type*>(node)), index_(index) {}
+
+    unrolled_list_iterator(const unrolled_list_iterator&) noexcept = default;
+    unrolled_list_iterator(unrolled_list_iterator&&) noexcept = default;
+
+    template<class P, class R>
+    unrolled_list_iterator(const unrolled_list_iterator<T, Capacity, P, R>& other) noexcept
+        : node_(const_cast<base_node_type*>(other.node())), index_(other.index()) {}
+
+    ~unrolled_list_iterator() = default;
+
+    auto operator=(const unrolled_list_iterator&) noexcept -> unrolled_list_iterator& = default;
+    auto operator=(unrolled_list_iterator&&) noexcept -> unrolled_list_iterator& = default;
+
+    [[nodiscard]] auto operator*() const noexcept -> reference {
+        return static_cast<node_type*>(node_)->values_[index_];
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> pointer {
+        return static_cast<node_type*>(node_)->values_ + index_;
+    }
+
+    auto operator++() noexcept -> unrolled_list_iterator& {
+        if (++index_ == static_cast<node_type*>(node_)->size_) {
+            node_ = node_->next_;
+            index_ = 0;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] auto operator++(int) noexcept -> unrolled_list_iterator {
+        unrolled_list_iterator res(*this);
+        ++(*this);
+        return res;
+    }
+
+    auto operator--() noexcept -> unrolled_list_iterator& {
+        if (index_ == 0) {
+            node_ = node_->prev_;
+            index_ = static_cast<node_type*>(node_)->size_;
+        }
+        --index_;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator--(int) noexcept -> unrolled_list_iterator {
+        unrolled_list_iterator res(*this);
+        --(*this);
+        return res;
+    }
+
+    [[nodiscard]] auto node() const noexcept -> base_node_type* {
+        return node_;
+    }
+
+    [[nodiscard]] auto index() const noexcept -> size_t {
+        return index_;
+    }
+
+    [[nodiscard]] explicit operator bool() const noexcept {
+        return node_ != nullptr;
+    }
+
+};  // class unrolled_list_iterator
+
+template<class T, size_t Capacity, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator==(const unrolled_list_iterator<T, Capacity, Pointer1, Reference1>& lhs,
+                              const unrolled_list_iterator<T, Capacity, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return lhs.node() == rhs.node() && lhs.index() == rhs.index();
+}
+
+template<class T, size_t Capacity, class Pointer1, class Pointer2, class Reference1, class Reference2>
+[[nodiscard]] auto operator!=(const unrolled_list_iterator<T, Capacity, Pointer1, Reference1>& lhs,
+                              const unrolled_list_iterator<T, Capacity, Pointer2, Reference2>& rhs) noexcept -> bool {
+    return !(lhs == rhs);
+}
+
+template<class T, size_t BlockBytes = 512, class Allocator = allocator<T>>
+class unrolled_list {
+
+    static_assert(is_same_v<typename Allocator::value_type, T>);
+    static_assert(is_nothrow_move_constructible_v<T> && is_nothrow_move_assignable_v<T>,
+                        "T is not allowed to throw in move constructor/assignment");
+
+public:
+    static constexpr size_t block_capacity = unrolled_list_block_capacity<T, BlockBytes>();
+
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = size_t;
+    using difference_type        = ptrdiff_t;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+
+    using pointer                = typename allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename allocator_traits<allocator_type>::const_pointer;
+
+    using iterator               = unrolled_list_iterator<value_type, block_capacity, pointer, reference>;
+    using const_iterator         = unrolled_list_iterator<value_type, block_capacity, const_pointer, const_reference>;
+
+    using reverse_iterator       = ciel::reverse_iterator<iterator>;
+    using const_reverse_iterator = ciel::reverse_iterator<const_iterator>;
+
+private:
+    using base_node_type         = list_node_base;
+    using node_type              = unrolled_list_node<value_type, block_capacity>;
+
+    using alloc_traits           = allocator_traits<allocator_type>;
+    using node_allocator         = typename alloc_traits::template rebind_alloc<node_type>;
+    using node_alloc_traits      = typename alloc_traits::template rebind_traits<node_type>;
+
+    // Blocks of at most merge_limit elements in total get merged
+    static constexpr size_type merge_limit = ciel::max<size_type>(1, block_capacity * 3 / 4);
+
+    base_node_type end_node_;
+    size_type size_;
+    [[no_unique_address]] allocator_type allocator_;
+
+    [[nodiscard]] static auto node(base_node_type* base) noexcept -> node_type* {
+        return static_cast<node_type*>(base);
+    }
+
+    // Allocates an empty block and links it before pos.
+    [[nodiscard]] auto allocate_node_before(base_node_type* pos) -> node_type* {
+        node_allocator node_alloc(allocator_);
+        node_type* res = node_alloc_traits::allocate(node_alloc, 1);
+        node_alloc_traits::construct(node_alloc, res);
+
+        res->prev_ = pos->prev_;
+        res->next_ = pos;
+        pos->prev_->next_ = res;
+        pos->prev_ = res;
+        return res;
+    }
+
+    // precondition: n has no elements
+    auto unlink_and_deallocate_node(node_type* n) noexcept -> void {
+        n->prev_->next_ = n->next_;
+        n->next_->prev_ = n->prev_;
+
+        node_allocator node_alloc(allocator_);
+        node_alloc_traits::destroy(node_alloc, n);
+        node_alloc_traits::deallocate(node_alloc, n, 1);
+    }
+
+    // Moves [from, n->size_) of n to the front of the empty block dest.
+    auto relocate(node_type* n, const size_type from, node_type* dest) noexcept -> void {
+        for (size_type i = from; i < n->size_; ++i) {
+            alloc_traits::construct(allocator_, dest->values_ + dest->size_, std::move(n->values_[i]));
+            ++dest->size_;
+            alloc_traits::destroy(allocator_, n->values_ + i);
+        }
+        n->size_ = from;
+    }
+
+    // Moves the upper half of n to a new block after it, returns the new block.
+    [[nodiscard]] auto split(node_type* n) -> node_type* {
+        node_type* right = allocate_node_before(n->next_);
+        relocate(n, n->size_ / 2, right);
+        return right;
+    }
+
+    // Appends all elements of right to left, and frees right.
+    auto merge(node_type* left, node_type* right) noexcept -> void {
+        CIEL_PRECONDITION(left->size_ + right->size_ <= block_capacity);
+
+        for (size_type i = 0; i < right->size_; ++i) {
+            alloc_traits::construct(allocator_, left->values_ + left->size_, std::move(right->values_[i]));
+            ++left->size_;
+            alloc_traits::destroy(allocator_, right->values_ + i);
+        }
+        right->size_ = 0;
+        unlink_and_deallocate_node(right);
+    }
+
+    // Constructs the element at index i of n, shifting [i, n->size_) right.
+    // precondition: !n->full() && i <= n->size_
+    template<class... Args>
+    auto construct_at_index(node_type* n, const size_type i, Args&& ... args) -> void {
+        CIEL_PRECONDITION(!n->full());
+        CIEL_PRECONDITION(i <= n->size_);
+
+        if (i == n->size_) {
+            alloc_traits::construct(allocator_, n->values_ + i, std::forward<Args>(args)...);
+
+        } else {
+            // Constructed aside first, so that nothing is shifted if it throws
+            value_type tmp(std::forward<Args>(args)...);
+            alloc_traits::construct(allocator_, n->values_ + n->size_, std::move(n->values_[n->size_ - 1]));
+            ciel::move_backward(n->values_ + i, n->values_ + n->size_ - 1, n->values_ + n->size_);
+            n->values_[i] = std::move(tmp);
+        }
+        ++n->size_;
+        ++size_;
+    }
+
+    auto destroy_all() noexcept -> void {
+        base_node_type* base = end_node_.next_;
+        while (base != &end_node_) {
+            node_type* n = node(base);
+            base = base->next_;
+            for (size_type i = 0; i < n->size_; ++i) {
+                alloc_traits::destroy(allocator_, n->values_ + i);
+            }
+            n->size_ = 0;
+            unlink_and_deallocate_node(n);
+        }
+        size_ = 0;
+    }
+
+    template<class... Args>
+    auto append_n(const size_type count, Args&& ... args) -> void {
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back(std::forward<Args>(args)...);
+        }
+    }
+
+    template<class Iter>
+    auto append(Iter first, Iter last) -> void {
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+    }
+
+    // Take over other's blocks, see list for why end_node_ can't be simply copied.
+    auto steal(unrolled_list& other) noexcept -> void {
+        if (other.end_node_.next_ == &other.end_node_) {
+            end_node_.clear();
+
+        } else {
+            end_node_.next_ = other.end_node_.next_;
+            end_node_.prev_ = other.end_node_.prev_;
+            end_node_.next_->prev_ = &end_node_;
+            end_node_.prev_->next_ = &end_node_;
+            other.end_node_.clear();
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+public:
+    unrolled_list()
+        : size_(0), allocator_() {}
+
+    explicit unrolled_list(const allocator_type& alloc)
+        : size_(0), allocator_(alloc) {}
+
+    unrolled_list(const size_type count, const T& value, const allocator_type& alloc = allocator_type())
+        : unrolled_list(alloc) {
+        CIEL_TRY {
+            append_n(count, value);
+
+        } CIEL_CATCH (...) {
+            destroy_all();
+            CIEL_THROW;
+        }
+    }
+
+    explicit unrolled_list(const size_type count, const allocator_type& alloc = allocator_type())
+        : unrolled_list(alloc) {
+        CIEL_TRY {
+            append_n(count);
+
+        } CIEL_CATCH (...) {
+            destroy_all();
+            CIEL_THROW;
+        }
+    }
+
+    template<legacy_input_iterator Iter>
+    unrolled_list(Iter first, Iter last, const allocator_type& alloc = allocator_type())
+        : unrolled_list(alloc) {
+        CIEL_TRY {
+            append(first, last);
+
+        } CIEL_CATCH (...) {
+            destroy_all();
+            CIEL_THROW;
+        }
+    }
+
+    unrolled_list(const unrolled_list& other)
+        : unrolled_list(other.begin(), other.end(),
+                        alloc_traits::select_on_container_copy_construction(other.get_allocator())) {}
+
+    unrolled_list(const unrolled_list& other, const allocator_type& alloc)
+        : unrolled_list(other.begin(), other.end(), alloc) {}
+
+    unrolled_list(unrolled_list&& other) noexcept
+        : allocator_(std::move(other.allocator_)) {
+        steal(other);
+    }
+
+    unrolled_list(std::initializer_list<T> init, const allocator_type& alloc = allocator_type())
+        : unrolled_list(init.begin(), init.end(), alloc) {}
+
+    ~unrolled_list() {
+        destroy_all();
+    }
+
+    auto operator=(const unrolled_list& other) -> unrolled_list& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+        destroy_all();
+        if (alloc_traits::propagate_on_container_copy_assignment::value) {
+            allocator_ = other.allocator_;
+        }
+        append(other.begin(), other.end());
+        return *this;
+    }
+
+    auto operator=(unrolled_list&& other) noexcept(alloc_traits::is_always_equal::value) -> unrolled_list& {
+        if (this == addressof(other)) {
+            return *this;
+        }
+        destroy_all();
+        if (!alloc_traits::propagate_on_container_move_assignment::value && allocator_ != other.allocator_) {
+            for (value_type& value : other) {
+                emplace_back(std::move(value));
+            }
+            other.clear();
+            return *this;
+        }
+        if (alloc_traits::propagate_on_container_move_assignment::value) {
+            allocator_ = std::move(other.allocator_);
+        }
+        steal(other);
+        return *this;
+    }
+
+    auto operator=(std::initializer_list<T> ilist) -> unrolled_list& {
+        assign(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    auto assign(const size_type count, const T& value) -> void {
+        destroy_all();
+        append_n(count, value);
+    }
+
+    template<legacy_input_iterator Iter>
+    auto assign(Iter first, Iter last) -> void {
+        destroy_all();
+        append(first, last);
+    }
+
+    auto assign(std::initializer_list<T> ilist) -> void {
+        assign(ilist.begin(), ilist.end());
+    }
+
+    [[nodiscard]] auto get_allocator() const noexcept -> allocator_type {
+        return allocator_;
+    }
+
+    [[nodiscard]] auto front() -> reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *begin();
+    }
+
+    [[nodiscard]] auto front() const -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *begin();
+    }
+
+    [[nodiscard]] auto back() -> reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *--end();
+    }
+
+    [[nodiscard]] auto back() const -> const_reference {
+        CIEL_PRECONDITION(!empty());
+
+        return *--end();
+    }
+
+    [[nodiscard]] auto begin() noexcept -> iterator {
+        return iterator(end_node_.next_, 0);
+    }
+
+    [[nodiscard]] auto begin() const noexcept -> const_iterator {
+        return const_iterator(end_node_.next_, 0);
+    }
+
+    [[nodiscard]] auto cbegin() const noexcept -> const_iterator {
+        return begin();
+    }
+
+    [[nodiscard]] auto end() noexcept -> iterator {
+        return iterator(&end_node_, 0);
+    }
+
+    [[nodiscard]] auto end() const noexcept -> const_iterator {
+        return const_iterator(&end_node_, 0);
+    }
+
+    [[nodiscard]] auto cend() const noexcept -> const_iterator {
+        return end();
+    }
+
+    [[nodiscard]] auto rbegin() noexcept -> reverse_iterator {
+        return reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto rbegin() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(end());
+    }
+
+    [[nodiscard]] auto crbegin() const noexcept -> const_reverse_iterator {
+        return rbegin();
+    }
+
+    [[nodiscard]] auto rend() noexcept -> reverse_iterator {
+        return reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto rend() const noexcept -> const_reverse_iterator {
+        return const_reverse_iterator(begin());
+    }
+
+    [[nodiscard]] auto crend() const noexcept -> const_reverse_iterator {
+        return rend();
+    }
+
+    // The iterator to the n-th element, skipping whole blocks, so O(n / block_capacity).
+    // Returns end() if n >= size().
+    [[nodiscard]] auto nth(size_type n) noexcept -> iterator {
+        base_node_type* base = end_node_.next_;
+        while (base != &end_node_ && n >= node(base)->size_) {
+            n -= node(base)->size_;
+            base = base->next_;
+        }
+        return base == &end_node_ ? end() : iterator(base, n);
+    }
+
+    [[nodiscard]] auto nth(const size_type n) const noexcept -> const_iterator {
+        return const_cast<unrolled_list&>(*this).nth(n);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] auto size() const noexcept -> size_type {
+        return size_;
+    }
+
+    [[nodiscard]] auto max_size() const noexcept -> size_type {
+        return alloc_traits::max_size(allocator_);
+    }
+
+    auto clear() noexcept -> void {
+        destroy_all();
+    }
+
+    template<class... Args>
+    auto emplace(const_iterator pos, Args&& ... args) -> iterator {
+        base_node_type* base = pos.node();
+        size_type i = pos.index();
+
+        // At the front of a block, appending to the previous one shifts nothing
+        if (i == 0 && base->prev_ != &end_node_ && !node(base->prev_)->full()) {
+            base = base->prev_;
+            i = node(base)->size_;
+        }
+
+        if (base == &end_node_) {
+            // The last block is full or there is none
+            node_type* n = allocate_node_before(&end_node_);
+            CIEL_TRY {
+                construct_at_index(n, 0, std::forward<Args>(args)...);
+
+            } CIEL_CATCH (...) {
+                unlink_and_deallocate_node(n);
+                CIEL_THROW;
+            }
+            return iterator(n, 0);
+        }
+
+        node_type* n = node(base);
+        if (n->full()) {
+            // l.insert(pos, l.back()) may refer to an element the split moves, it's built before relocations
+            value_type value(std::forward<Args>(args)...);
+            node_type* right = split(n);
+            if (i > n->size_) {
+                i -= n->size_;
+                n = right;
+            }
+
+            construct_at_index(n, i, std::move(value));
+            return iterator(n, i);
+        }
+
+        construct_at_index(n, i, std::forward<Args>(args)...);
+        return iterator(n, i);
+    }
+
+    auto insert(const_iterator pos, const T& value) -> iterator {
+        return emplace(pos, value);
+    }
+
+    auto insert(const_iterator pos, T&& value) -> iterator {
+        return emplace(pos, std::move(value));
+    }
+
+    // Later insertions may split the block of the first inserted element,
+    // so the result is found backwards from the last one.
+    auto insert(const_iterator pos, const size_type count, const T& value) -> iterator {
+        if (count == 0) {
+            return iterator(pos.node(), pos.index());
+        }
+
+        // value may be an element that the first insertion moved, the copies are made from the last inserted one
+        iterator it = emplace(pos, value);
+        for (size_type i = 1; i < count; ++i) {
+            const iterator next = ciel::next(it);
+            it = emplace(next, *it);
+        }
+        return ciel::prev(it, static_cast<difference_type>(count - 1));
+    }
+
+    template<legacy_input_iterator Iter>
+    auto insert(const_iterator pos, Iter first, Iter last) -> iterator {
+        if (first == last) {
+            return iterator(pos.node(), pos.index());
+        }
+
+        iterator it = emplace(pos, *first);
+        size_type count = 1;
+        while (++first != last) {
+            it = emplace(++it, *first);
+            ++count;
+        }
+        return ciel::prev(it, static_cast<difference_type>(count - 1));
+    }
+
+    auto insert(const_iterator pos, std::initializer_list<T> ilist) -> iterator {
+        return insert(pos, ilist.begin(), ilist.end());
+    }
+
+    auto erase(const_iterator pos) noexcept -> iterator {
+        CIEL_PRECONDITION(pos != end());
+
+        node_type* n = node(pos.node());
+        size_type i = pos.index();
+
+        ciel::move(n->values_ + i + 1, n->values_ + n->size_, n->values_ + i);
+        alloc_traits::destroy(allocator_, n->values_ + n->size_ - 1);
+        --n->size_;
+        --size_;
+
+        if (n->size_ == 0) {
+            base_node_type* next = n->next_;
+            unlink_and_deallocate_node(n);
+            return iterator(next, 0);
+        }
+
+        if (n->next_ != &end_node_ && n->size_ + node(n->next_)->size_ <= merge_limit) {
+            merge(n, node(n->next_));
+
+        } else if (n->prev_ != &end_node_ && node(n->prev_)->size_ + n->size_ <= merge_limit) {
+            node_type* prev = node(n->prev_);
+            i += prev->size_;
+            merge(prev, n);
+            n = prev;
+        }
+
+        return i < n->size_ ? iterator(n, i) : iterator(n->next_, 0);
+    }
+
+    // Erasing may move the elements after pos, so [first, last) is counted first.
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator {
+        size_type count = static_cast<size_type>(ciel::distance(first, last));
+        iterator res(first.node(), first.index());
+        while (count-- > 0) {
+            res = erase(res);
+        }
+        return res;
+    }
+
+    auto push_back(const T& value) -> void {
+        emplace_back(value);
+    }
+
+    auto push_back(T&& value) -> void {
+        emplace_back(std::move(value));
+    }
+
+    template<class... Args>
+    auto emplace_back(Args&& ... args) -> reference {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    auto pop_back() noexcept -> void {
+        CIEL_PRECONDITION(!empty());
+
+        erase(--end());
+    }
+
+    auto push_front(const T& value) -> void {
+        emplace_front(value);
+    }
+
+    auto push_front(T&& value) -> void {
+        emplace_front(std::move(value));
+    }
+
+    template<class... Args>
+    auto emplace_front(Args&& ... args) -> reference {
+        return *emplace(begin(), std::forward<Args>(args)...);
+    }
+
+    auto pop_front() noexcept -> void {
+        CIEL_PRECONDITION(!empty());
+
+        erase(begin());
+    }
+
+    auto resize(const size_type count) -> void {
+        while (size_ > count) {
+            pop_back();
+        }
+        append_n(count - size_);
+    }
+
+    auto resize(const size_type count, const value_type& value) -> void {
+        while (size_ > count) {
+            pop_back();
+        }
+        append_n(count - size_, value);
+    }
+
+    auto swap(unrolled_list& other) noexcept(alloc_traits::is_always_equal::value) -> void {
+        using std::swap;
+
+        unrolled_list tmp(allocator_);
+        tmp.steal(other);
+        other.steal(*this);
+        steal(tmp);
+        swap(allocator_, other.allocator_);
+    }
+
+};  // class unrolled_list
+
+template<class T, size_t BlockBytes, class Alloc>
+[[nodiscard]] auto operator==(const unrolled_list<T, BlockBytes, Alloc>& lhs,
+                              const unrolled_list<T, BlockBytes, Alloc>& rhs) -> bool {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class Iter, class Alloc = allocator<typename iterator_traits<Iter>::value_type>>
+unrolled_list(Iter, Iter, Alloc = Alloc())
+    -> unrolled_list<typename iterator_traits<Iter>::value_type, 512, Alloc>;
+
+NAMESPACE_CIEL_END
+
+namespace std {
+
+template<class T, size_t BlockBytes, class Alloc>
+auto swap(ciel::unrolled_list<T, BlockBytes, Alloc>& lhs,
+          ciel::unrolled_list<T, BlockBytes, Alloc>& rhs) noexcept(noexcept(lhs.swap(rhs))) -> void {
+    lhs.swap(rhs);
+}
+
+}   // namespace std
+
+#endif // CIELUTILS_INCLUDE_CIEL_UNROLLED_LIST_HPP_
\ No newline at end of file
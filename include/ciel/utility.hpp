@@ -8,5 +8,6 @@
 #include <ciel/utility_impl/integer_sequence.hpp>
 #include <ciel/utility_impl/pair.hpp>
 #include <ciel/utility_impl/piecewise_construct.hpp>
+#include <ciel/utility_impl/sorted_unique.hpp>
 
 #endif // CIELUTILS_INCLUDE_CIEL_UTILITY_HPP_
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <ciel/config.hpp>
 #include <ciel/synth_three_way.hpp>
+#include <ciel/type_traits_impl/common_reference.hpp>
 #include <ciel/type_traits_impl/decay.hpp>
 #include <ciel/type_traits_impl/is_copy_assignable.hpp>
 #include <ciel/type_traits_impl/is_copy_constructible.hpp>
@@ -193,6 +194,15 @@ template<class T1, class T2, class U1, class U2>
 template<class T1, class T2>
 pair(T1, T2) -> pair<T1, T2>;
 
+// As in C++23, so that iterators whose reference is a pair of references, like flat_map's, are indirectly_readable
+template<class T1, class T2, class U1, class U2, template<class> class TQual, template<class> class UQual>
+    requires requires {
+        typename pair<common_reference_t<TQual<T1>, UQual<U1>>, common_reference_t<TQual<T2>, UQual<U2>>>;
+    }
+struct basic_common_reference<pair<T1, T2>, pair<U1, U2>, TQual, UQual> {
+    using type = pair<common_reference_t<TQual<T1>, UQual<U1>>, common_reference_t<TQual<T2>, UQual<U2>>>;
+};
+
 NAMESPACE_CIEL_END
 
 namespace std {
@@ -228,9 +238,9 @@ template<size_t I, class T1, class T2>
 [[nodiscard]] constexpr auto get(ciel::pair<T1,T2>&& p) noexcept
     -> tuple_element_t<I, ciel::pair<T1,T2>>&& {
     if constexpr (I == 0) {
-        return std::move(p.first);
+        return std::forward<T1>(p.first);
     } else {
-        return std::move(p.second);
+        return std::forward<T2>(p.second);
     }
 }
 
@@ -238,9 +248,9 @@ template<size_t I, class T1, class T2>
 [[nodiscard]] constexpr auto get(const ciel::pair<T1,T2>&& p) noexcept
     -> tuple_element_t<I, ciel::pair<T1,T2>> const&& {
     if constexpr (I == 0) {
-        return std::move(p.first);
+        return std::forward<const T1>(p.first);
     } else {
-        return std::move(p.second);
+        return std::forward<const T2>(p.second);
     }
 }
 
@@ -256,12 +266,12 @@ template<class T, class U>
 
 template<class T, class U>
 [[nodiscard]] constexpr auto get(ciel::pair<T, U>&& p) noexcept -> T&& {
-    return std::move(p.first);
+    return std::forward<T>(p.first);
 }
 
 template<class T, class U>
 [[nodiscard]] constexpr auto get(const ciel::pair<T, U>&& p) noexcept -> const T&& {
-    return std::move(p.first);
+    return std::forward<const T>(p.first);
 }
 
 template<class T, class U>
@@ -276,12 +286,12 @@ template<class T, class U>
 
 template<class T, class U>
 [[nodiscard]] constexpr auto get(ciel::pair<U, T>&& p) noexcept -> T&& {
-    return std::move(p.second);
+    return std::forward<T>(p.second);
 }
 
 template<class T, class U>
 [[nodiscard]] constexpr auto get(const ciel::pair<U, T>&& p) noexcept -> const T&& {
-    return std::move(p.second);
+    return std::forward<const T>(p.second);
 }
 
 template<class T1, class T2>
@@ -0,0 +1,15 @@
+#ifndef CIELUTILS_INCLUDE_CIEL_UTILITY_IMPL_SORTED_UNIQUE_HPP_
+#define CIELUTILS_INCLUDE_CIEL_UTILITY_IMPL_SORTED_UNIQUE_HPP_
+
+#include <ciel/config.hpp>
+
+NAMESPACE_CIEL_BEGIN
+
+// Tells flat_set and flat_map that the input is already sorted and has no duplicates, so the sort is skipped.
+struct sorted_unique_t { explicit sorted_unique_t() = default; };
+
+inline constexpr sorted_unique_t sorted_unique{};
+
+NAMESPACE_CIEL_END
+
+#endif // CIELUTILS_INCLUDE_CIEL_UTILITY_IMPL_SORTED_UNIQUE_HPP_
\ No newline at end of file
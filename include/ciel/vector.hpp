@@ -1,7 +1,10 @@
 #ifndef CIELUTILS_INCLUDE_CIEL_VECTOR_HPP_
 #define CIELUTILS_INCLUDE_CIEL_VECTOR_HPP_
 
+#include <ciel/algorithm_impl/bitwise_dispatch.hpp>
+#include <ciel/algorithm_impl/copy.hpp>
 #include <ciel/algorithm_impl/equal.hpp>
+#include <ciel/algorithm_impl/fill_n.hpp>
 #include <ciel/algorithm_impl/move.hpp>
 #include <ciel/algorithm_impl/remove.hpp>
 #include <ciel/algorithm_impl/remove_if.hpp>
@@ -12,7 +15,11 @@
 #include <ciel/iterator_impl/wrap_iter.hpp>
 #include <ciel/memory_impl/allocator.hpp>
 #include <ciel/memory_impl/allocator_traits.hpp>
+#include <ciel/type_traits_impl/is_constant_evaluated.hpp>
+#include <ciel/type_traits_impl/is_constructible.hpp>
+#include <ciel/type_traits_impl/is_trivially_copyable.hpp>
 #include <cstddef>
+#include <cstring>
 #include <stdexcept>
 
 NAMESPACE_CIEL_BEGIN
@@ -53,6 +60,12 @@ private:
     pointer end_cap_;
     [[no_unique_address]] allocator_type allocator_;
 
+    // Constructing value_type from Ref by the allocator is copying its bytes, so ranges can be memcpy-ed
+    template<class Ref>
+    static constexpr bool is_bitwise_constructible_from = is_trivially_copyable_v<value_type>
+        && is_trivially_constructible_v<value_type, Ref>
+        && !details::has_construct<allocator_type, value_type*, Ref>::value;
+
     constexpr auto alloc_range_destroy(pointer begin, pointer end) noexcept -> pointer {
         CIEL_PRECONDITION(begin <= end);
 
@@ -81,6 +94,17 @@ private:
 
     template<class Iter>
     constexpr auto alloc_range_construct(pointer begin, Iter first, Iter last) -> pointer {
+        if constexpr (details::plain_contiguous_iterator<Iter> && is_same_v<iter_value_t<Iter>, value_type>
+                      && is_bitwise_constructible_from<iter_reference_t<Iter>>) {
+            if (!ciel::is_constant_evaluated()) {
+                const size_type n = last - first;
+                if (n > 0) {
+                    std::memcpy(ciel::to_address(begin), ciel::to_address(first), n * sizeof(value_type));
+                }
+                return begin + n;
+            }
+        }
+
         pointer end = begin;
 
         CIEL_TRY {
@@ -98,25 +122,28 @@ private:
     }
 
     constexpr auto range_assign_n(pointer begin, const size_type n, const value_type& value) -> void {
-        for (size_type i = 0; i < n; ++i) {
-            *begin = value;
-            ++begin;
-        }
+        ciel::fill_n(ciel::to_address(begin), n, value);
     }
 
     template<class Iter>
     constexpr auto range_assign(pointer begin, Iter first, Iter last) -> void {
-        while (first != last) {
-            *begin = *first;
-            ++first;
-            ++begin;
-        }
+        ciel::copy(first, last, ciel::to_address(begin));
     }
 
     // Used in expansion
     constexpr auto alloc_range_move(pointer begin, pointer first, pointer last) noexcept -> pointer {
         CIEL_PRECONDITION(first <= last);
 
+        if constexpr (is_bitwise_constructible_from<value_type&&>) {
+            if (!ciel::is_constant_evaluated()) {
+                if (first != last) {
+                    std::memcpy(ciel::to_address(begin), ciel::to_address(first),
+                                static_cast<size_type>(last - first) * sizeof(value_type));
+                }
+                return begin + (last - first);
+            }
+        }
+
         pointer end = begin;
         while (first != last) {
             alloc_traits::construct(allocator_, end++, std::move(*first++));
@@ -181,8 +208,8 @@ private:
             }
 
             if (begin_) {
-                alloc_range_move(new_start, begin_, to_address(pos));
-                alloc_range_move(new_pos + count, to_address(pos), end_);
+                alloc_range_move(new_start, begin_, ciel::to_address(pos));
+                alloc_range_move(new_pos + count, ciel::to_address(pos), end_);
 
                 clear();
                 alloc_traits::deallocate(allocator_, begin_, capacity());
@@ -198,7 +225,7 @@ private:
 
             iterator old_end = end();
             end_ = alloc_range_construct_n(end_, count, std::forward<Args>(args)...);
-            rotate(pos, old_end, end());
+            ciel::rotate(pos, old_end, end());
             return pos;
         }
     }
@@ -328,7 +355,7 @@ public:
     }
 
     constexpr auto operator=(const vector& other) -> vector& {
-        if (this == addressof(other)) [[unlikely]] {
+        if (this == ciel::addressof(other)) [[unlikely]] {
             return *this;
         }
 
@@ -350,7 +377,7 @@ public:
     constexpr auto operator=(vector&& other)
         noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
                  alloc_traits::is_always_equal::value) -> vector& {
-        if (this == addressof(other)) [[unlikely]] {
+        if (this == ciel::addressof(other)) [[unlikely]] {
             return *this;
         }
 
@@ -629,7 +656,7 @@ public:
             CIEL_THROW;
         }
 
-        rotate(begin() + pos_index, begin() + old_size, end());
+        ciel::rotate(begin() + pos_index, begin() + old_size, end());
         return begin() += pos_index;
     }
 
@@ -659,8 +686,8 @@ public:
             }
 
             if (begin_) {
-                alloc_range_move(new_start, begin_, to_address(pos));
-                alloc_range_move(new_pos + count, to_address(pos), end_);
+                alloc_range_move(new_start, begin_, ciel::to_address(pos));
+                alloc_range_move(new_pos + count, ciel::to_address(pos), end_);
 
                 clear();
                 alloc_traits::deallocate(allocator_, begin_, capacity());
@@ -674,7 +701,7 @@ public:
         } else {
             iterator old_end = end();
             end_ = alloc_range_construct(end_, first, last);
-            rotate(pos, old_end, end());
+            ciel::rotate(pos, old_end, end());
             return pos;
         }
     }
@@ -706,8 +733,8 @@ public:
 
         auto index = first - begin();
 
-        iterator new_end = move(last, end(), first);
-        end_ = alloc_range_destroy(to_address(new_end), end_);
+        iterator new_end = ciel::move(last, end(), first);
+        end_ = alloc_range_destroy(ciel::to_address(new_end), end_);
 
         return begin() + index;
     }
@@ -789,7 +816,7 @@ template<class T, class Alloc>
     if (lhs.size() != rhs.size()) {
         return false;
     }
-    return equal(lhs.begin(), lhs.end(), rhs.begin());
+    return ciel::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 // So that we can test more efficiently
@@ -804,7 +831,7 @@ template<class T, class Alloc>
 template<class T, class Alloc, class U>
 constexpr auto erase(vector<T, Alloc>& c, const U& value) -> typename vector<T, Alloc>::size_type {
     auto it = ciel::remove(c.begin(), c.end(), value);
-    auto r = distance(it, c.end());
+    auto r = ciel::distance(it, c.end());
     c.erase(it, c.end());
     return r;
 }
@@ -812,7 +839,7 @@ constexpr auto erase(vector<T, Alloc>& c, const U& value) -> typename vector<T,
 template<class T, class Alloc, class Pred>
 constexpr auto erase_if(vector<T, Alloc>& c, Pred pred) -> typename vector<T, Alloc>::size_type {
     auto it = ciel::remove_if(c.begin(), c.end(), pred);
-    auto r = distance(it, c.end());
+    auto r = ciel::distance(it, c.end());
     c.erase(it, c.end());
     return r;
 }
@@ -1,10 +1,231 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <bit>
 #include <ciel/algorithm.hpp>
+#include <ciel/array.hpp>
+#include <ciel/execution.hpp>
 #include <ciel/map.hpp>
 #include <ciel/vector.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
 #include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Small alphabets so that there are many duplicates, every size crosses the register boundaries
+template<class T>
+void simd_scan_test(std::mt19937& g) {
+    for (size_t n = 0; n < 200; ++n) {
+        ciel::vector<T> v(n);
+        for (T& x : v) {
+            x = static_cast<T>(g() % 7);
+        }
+        ciel::vector<T> w = v;
+        if (n > 0) {
+            w[g() % n] = static_cast<T>(5);
+        }
+
+        for (int i = 0; i < 8; ++i) {
+            const T value = static_cast<T>(i);
+            ASSERT_EQ(ciel::find(v.begin(), v.end(), value) - v.begin(),
+                      std::find(v.begin(), v.end(), value) - v.begin());
+            ASSERT_EQ(ciel::count(v.begin(), v.end(), value), std::count(v.begin(), v.end(), value));
+        }
+
+        ASSERT_EQ(ciel::mismatch(v.begin(), v.end(), w.begin()).first - v.begin(),
+                  std::mismatch(v.begin(), v.end(), w.begin()).first - v.begin());
+
+        if constexpr (std::is_arithmetic_v<T>) {
+            ASSERT_EQ(ciel::min_element(v.begin(), v.end()) - v.begin(),
+                      std::min_element(v.begin(), v.end()) - v.begin());
+            ASSERT_EQ(ciel::max_element(v.begin(), v.end()) - v.begin(),
+                      std::max_element(v.begin(), v.end()) - v.begin());
+            const auto res = ciel::minmax_element(v.begin(), v.end());
+            const auto expected = std::minmax_element(v.begin(), v.end());
+            ASSERT_EQ(res.first - v.begin(), expected.first - v.begin());
+            ASSERT_EQ(res.second - v.begin(), expected.second - v.begin());
+        }
+    }
+}
+
+}   // namespace
+
+TEST(algorithm_tests, simd_scan) {
+    std::mt19937 g(std::random_device{}());
+
+    simd_scan_test<int8_t>(g);
+    simd_scan_test<uint8_t>(g);
+    simd_scan_test<char>(g);
+    simd_scan_test<int16_t>(g);
+    simd_scan_test<uint16_t>(g);
+    simd_scan_test<int32_t>(g);
+    simd_scan_test<uint32_t>(g);
+    simd_scan_test<int64_t>(g);
+    simd_scan_test<uint64_t>(g);
+    simd_scan_test<float>(g);
+    simd_scan_test<double>(g);
+    simd_scan_test<std::byte>(g);
+}
+
+TEST(algorithm_tests, simd_scan_extremes) {
+    // The values of the most significant bits, whose order differs between signed and unsigned comparisons
+    ciel::vector<uint32_t> u(100, 1);
+    u[37] = 0x80000000u;
+    u[61] = 0;
+    u[62] = 0x80000000u;
+    ASSERT_EQ(ciel::min_element(u.begin(), u.end()) - u.begin(), 61);
+    ASSERT_EQ(ciel::max_element(u.begin(), u.end()) - u.begin(), 37);
+    ASSERT_EQ(ciel::minmax_element(u.begin(), u.end()).second - u.begin(), 62);
+
+    ciel::vector<int8_t> s(100, 1);
+    s[10] = -128;
+    s[90] = 127;
+    ASSERT_EQ(ciel::min_element(s.begin(), s.end()) - s.begin(), 10);
+    ASSERT_EQ(ciel::max_element(s.begin(), s.end()) - s.begin(), 90);
+
+    // Values of other types, compared after the usual arithmetic conversions
+    ciel::vector<uint8_t> bytes(100, 44);
+    ASSERT_EQ(ciel::find(bytes.begin(), bytes.end(), 300), bytes.end());
+    ASSERT_EQ(ciel::count(bytes.begin(), bytes.end(), 300), 0);
+    ASSERT_EQ(ciel::count(bytes.begin(), bytes.end(), 44LL), 100);
+
+    ciel::vector<int> ints(100, 0);
+    ints[70] = -1;
+    ASSERT_EQ(ciel::find(ints.begin(), ints.end(), -1LL) - ints.begin(), 70);
+    ASSERT_EQ(ciel::find(ints.begin(), ints.end(), 0xFFFFFFFFLL), ints.end());
+
+    // IEEE equality: NaN is never found, -0.0 equals to 0.0
+    ciel::vector<float> f(100, 1.0f);
+    f[20] = std::nanf("");
+    f[50] = -0.0f;
+    ASSERT_EQ(ciel::find(f.begin(), f.end(), std::nanf("")), f.end());
+    ASSERT_EQ(ciel::find(f.begin(), f.end(), 0.0f) - f.begin(), 50);
+    ASSERT_EQ(ciel::count(f.begin(), f.end(), 1.0f), 98);
+
+    // Constant evaluation takes the loops
+    static_assert([] {
+        ciel::array<int, 40> a{};
+        a[33] = 5;
+        return ciel::find(a.begin(), a.end(), 5) - a.begin() == 33 && ciel::count(a.begin(), a.end(), 0) == 39
+            && *ciel::max_element(a.begin(), a.end()) == 5;
+    }());
+}
+
+TEST(algorithm_tests, bitwise_copy_and_move) {
+    ciel::vector<int> v{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    ciel::vector<int> dst(10);
+
+    ASSERT_EQ(ciel::copy(v.begin(), v.end(), dst.begin()), dst.end());
+    ASSERT_EQ(dst, v);
+
+    // Overlapping ranges in the allowed directions
+    ASSERT_EQ(ciel::move(v.begin() + 2, v.end(), v.begin()), v.begin() + 8);
+    ASSERT_EQ(v, ciel::vector<int>({2, 3, 4, 5, 6, 7, 8, 9, 8, 9}));
+
+    ASSERT_EQ(ciel::move_backward(v.begin(), v.begin() + 8, v.end()), v.begin() + 2);
+    ASSERT_EQ(v, ciel::vector<int>({2, 3, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    ASSERT_EQ(ciel::copy_backward(v.begin(), v.begin(), v.end()), v.end());
+
+    // const source, raw pointer destination
+    const ciel::vector<int>& cv = dst;
+    int arr[10]{};
+    ASSERT_EQ(ciel::copy(cv.begin(), cv.end(), arr), arr + 10);
+    ASSERT_TRUE(ciel::equal(cv.begin(), cv.end(), arr));
+
+    // Not trivially copyable, element loops
+    ciel::vector<std::string> s{"a", "b", "c"};
+    ciel::vector<std::string> s2(3);
+    ciel::copy(s.begin(), s.end(), s2.begin());
+    ASSERT_EQ(s, s2);
+    ciel::move(s.begin(), s.end(), s2.begin());
+    ASSERT_EQ(s2, ciel::vector<std::string>({"a", "b", "c"}));
+}
+
+TEST(algorithm_tests, bitwise_fill_equal_compare) {
+    ciel::vector<char> c(100);
+    ciel::fill(c.begin(), c.end(), 'x');
+    ASSERT_TRUE(std::all_of(c.begin(), c.end(), [](char x) { return x == 'x'; }));
+    ASSERT_EQ(ciel::fill_n(c.begin(), 10, 300), c.begin() + 10);    // converted to char like the element loop
+    ASSERT_EQ(c[9], static_cast<char>(300));
+    ASSERT_EQ(c[10], 'x');
+
+    ciel::vector<int> a{1, 2, 3};
+    ciel::vector<int> b{1, 2, 4};
+    ASSERT_TRUE(ciel::equal(a.begin(), a.end(), a.begin()));
+    ASSERT_FALSE(ciel::equal(a.begin(), a.end(), b.begin()));
+    ASSERT_TRUE(ciel::equal(a.begin(), a.begin(), b.begin()));
+
+    const auto lex = [](const ciel::vector<unsigned char>& l, const ciel::vector<unsigned char>& r) {
+        return ciel::lexicographical_compare(l.begin(), l.end(), r.begin(), r.end());
+    };
+    using bytes = ciel::vector<unsigned char>;
+    ASSERT_TRUE(lex(bytes{1, 2}, bytes{1, 3}));
+    ASSERT_FALSE(lex(bytes{1, 3}, bytes{1, 2}));
+    ASSERT_TRUE(lex(bytes{1, 2}, bytes{1, 2, 0}));
+    ASSERT_FALSE(lex(bytes{1, 2, 0}, bytes{1, 2}));
+    ASSERT_FALSE(lex(bytes{}, bytes{}));
+    ASSERT_TRUE(lex(bytes{}, bytes{0}));
+    ASSERT_TRUE(lex(bytes{127}, bytes{200}));
+
+    // Constant evaluation takes the element loops
+    static_assert([] {
+        ciel::array<unsigned char, 4> x{1, 2, 3, 4};
+        ciel::array<unsigned char, 4> y{};
+        ciel::copy(x.begin(), x.end(), y.begin());
+        ciel::fill(x.begin(), x.begin() + 2, 0);
+        return ciel::equal(y.begin(), y.end(), ciel::array<unsigned char, 4>{1, 2, 3, 4}.begin())
+            && ciel::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+    }());
+}
+
+TEST(algorithm_tests, lower_bound_batch) {
+    std::mt19937_64 g;
+
+    for (const size_t n : {0, 1, 2, 15, 16, 17, 1000}) {
+        ciel::vector<size_t> v(n);
+        for (size_t i = 0; i < n; ++i) {
+            v[i] = i * 2;
+        }
+
+        ciel::vector<size_t> keys(std::uniform_int_distribution<size_t>(0, 100)(g));
+        for (size_t& key : keys) {
+            key = std::uniform_int_distribution<size_t>(0, n * 2 + 1)(g);
+        }
+
+        ciel::vector<ciel::vector<size_t>::iterator> res;
+        ciel::lower_bound_batch(v.begin(), v.end(), keys, std::back_inserter(res));
+        ASSERT_EQ(res.size(), keys.size());
+
+        for (size_t i = 0; i < keys.size(); ++i) {
+            ASSERT_EQ(res[i], std::lower_bound(v.begin(), v.end(), keys[i]));
+        }
+    }
+}
+
+TEST(algorithm_tests, unique) {
+    std::mt19937 g(std::random_device{}());
+
+    for (size_t n = 0; n < 100; ++n) {
+        ciel::vector<std::string> v(n);
+        for (std::string& s : v) {
+            s = std::to_string(g() % 4);
+        }
+        std::vector<std::string> expected(v.begin(), v.end());
+
+        v.erase(ciel::unique(v.begin(), v.end()), v.end());
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        ASSERT_TRUE(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+    }
+}
 
 TEST(algorithm_tests, partial_sort) {
     std::random_device rd;
@@ -40,6 +261,147 @@ TEST(algorithm_tests, partial_sort) {
     }
 }
 
+TEST(algorithm_tests, partial_sort_small_middle) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (size_t loop = 0; loop < 20; ++loop) {
+        std::ranges::shuffle(v, g);
+
+        ciel::partial_sort(v.begin(), v.begin() + 7, v.end());
+        for (size_t i = 0; i < 7; ++i) {
+            ASSERT_EQ(v[i], i);
+        }
+
+        ciel::partial_sort(v.begin(), v.begin() + 1000, v.end(), ciel::greater<>());
+        for (size_t i = 0; i < 1000; ++i) {
+            ASSERT_EQ(v[i], 4999 - i);
+        }
+    }
+
+    ciel::partial_sort(v.begin(), v.begin(), v.end());
+}
+
+TEST(algorithm_tests, partial_sort_copy) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i % 1000);
+    }
+    std::ranges::shuffle(v, g);
+
+    ciel::vector<size_t> out(100);
+    ASSERT_EQ(ciel::partial_sort_copy(v.begin(), v.end(), out.begin(), out.end()), out.end());
+    for (size_t i = 0; i < out.size(); ++i) {
+        ASSERT_EQ(out[i], i / 5);
+    }
+
+    // Output range longer than input
+    ciel::vector<size_t> long_out(6000);
+    ASSERT_EQ(ciel::partial_sort_copy(v.begin(), v.end(), long_out.begin(), long_out.end(), ciel::greater<>()),
+              long_out.begin() + 5000);
+    for (size_t i = 0; i < 5000; ++i) {
+        ASSERT_EQ(long_out[i], 999 - i / 5);
+    }
+
+    ASSERT_EQ(ciel::partial_sort_copy(v.begin(), v.end(), out.begin(), out.begin()), out.begin());
+}
+
+TEST(algorithm_tests, nth_element) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (size_t loop = 0; loop < 20; ++loop) {
+        std::ranges::shuffle(v, g);
+
+        const size_t nth = g() % v.size();
+        ciel::nth_element(v.begin(), v.begin() + nth, v.end());
+        ASSERT_EQ(v[nth], nth);
+        for (size_t i = 0; i < v.size(); ++i) {
+            ASSERT_TRUE(i < nth ? v[i] < nth : v[i] >= nth);
+        }
+    }
+
+    // Many duplicates, sorted and reversed ranges with a non-branchless comparator
+    for (size_t loop = 0; loop < 20; ++loop) {
+        ciel::vector<size_t> u;
+        for (size_t i = 0; i < 10000; ++i) {
+            u.emplace_back(loop % 3 == 0 ? g() % 4 : loop % 3 == 1 ? i : 10000 - i);
+        }
+        ciel::vector<size_t> sorted = u;
+        ciel::sort(sorted.begin(), sorted.end());
+
+        const size_t nth = g() % u.size();
+        ciel::nth_element(u.begin(), u.begin() + nth, u.end(), [](size_t a, size_t b) {
+            return a < b;
+        });
+        ASSERT_EQ(u[nth], sorted[nth]);
+        for (size_t i = 0; i < u.size(); ++i) {
+            ASSERT_TRUE(i < nth ? u[i] <= u[nth] : u[i] >= u[nth]);
+        }
+    }
+
+    ciel::nth_element(v.begin(), v.end(), v.end());
+}
+
+TEST(algorithm_tests, nth_element_adversary) {
+    // McIlroy's adversary: all elements start as "gas", greater than everything, and one is frozen to the next
+    // smallest value when two gas elements are compared. It builds a killer sequence for whatever pivots
+    // introselect picks, so quickselect alone would be quadratic and the median of medians fallback must kick in.
+    constexpr size_t n = 5000;
+    constexpr size_t nth = n / 2;
+
+    ciel::vector<size_t> killer(n, n);
+    {
+        size_t solid = 0;
+        size_t candidate = 0;
+        ciel::vector<size_t> indices;
+        for (size_t i = 0; i < n; ++i) {
+            indices.emplace_back(i);
+        }
+        ciel::nth_element(indices.begin(), indices.begin() + nth, indices.end(), [&](size_t x, size_t y) {
+            if (killer[x] == n && killer[y] == n) {
+                killer[x == candidate ? x : y] = solid++;
+            }
+            if (killer[x] == n) {
+                candidate = x;
+
+            } else if (killer[y] == n) {
+                candidate = y;
+            }
+            return killer[x] < killer[y];
+        });
+    }
+
+    // Replaying it takes the same path
+    ciel::vector<size_t> v = killer;
+    size_t comparisons = 0;
+    ciel::nth_element(v.begin(), v.begin() + nth, v.end(), [&](size_t a, size_t b) {
+        ++comparisons;
+        return a < b;
+    });
+
+    ciel::sort(killer.begin(), killer.end());
+    ASSERT_EQ(v[nth], killer[nth]);
+    for (size_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(i < nth ? v[i] <= v[nth] : v[i] >= v[nth]);
+    }
+    // Quickselect alone takes hundreds of comparisons per element here
+    ASSERT_LT(comparisons, 32 * n);
+}
+
 TEST(algorithm_tests, sort) {
     std::random_device rd;
     std::mt19937 g(rd());
@@ -68,6 +430,261 @@ TEST(algorithm_tests, sort) {
     }
 }
 
+TEST(algorithm_tests, sort_patterns) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    // Compared with std::sort, so that a partition dropping or duplicating elements doesn't go unnoticed
+    const auto sort_and_check = [](auto& v, auto comp) {
+        auto expected = v;
+        std::sort(expected.begin(), expected.end(), comp);
+        ciel::sort(v.begin(), v.end(), comp);
+        ASSERT_EQ(v, expected);
+    };
+
+    // Equal keys carry distinct ids, every id must survive the partitions exactly once
+    const auto sort_keyed_and_check = [](ciel::vector<std::pair<size_t, size_t>>& v) {
+        ciel::vector<size_t> keys;
+        for (const auto& p : v) {
+            keys.emplace_back(p.first);
+        }
+        std::sort(keys.begin(), keys.end());
+
+        ciel::sort(v.begin(), v.end(), [](const auto& a, const auto& b) {
+            return a.first < b.first;
+        });
+
+        ciel::vector<size_t> ids;
+        for (size_t i = 0; i < v.size(); ++i) {
+            ASSERT_EQ(v[i].first, keys[i]);
+            ids.emplace_back(v[i].second);
+        }
+        std::sort(ids.begin(), ids.end());
+        for (size_t i = 0; i < ids.size(); ++i) {
+            ASSERT_EQ(ids[i], i);
+        }
+    };
+
+    ciel::vector<size_t> v(10000);
+
+    // sorted
+    std::iota(v.begin(), v.end(), 0);
+    sort_and_check(v, ciel::less<>());
+
+    // reversed
+    std::iota(v.rbegin(), v.rend(), 0);
+    sort_and_check(v, ciel::less<>());
+
+    // organ pipe
+    std::iota(v.begin(), v.begin() + 5000, 0);
+    std::iota(v.rbegin(), v.rbegin() + 5000, 0);
+    sort_and_check(v, ciel::less<>());
+
+    // many duplicates
+    for (size_t loop = 0; loop < 20; ++loop) {
+        for (auto& i : v) {
+            i = g() % 16;
+        }
+        sort_and_check(v, ciel::less<>());
+
+        ciel::vector<std::pair<size_t, size_t>> keyed;
+        for (size_t i = 0; i < v.size(); ++i) {
+            keyed.emplace_back(g() % 16, i);
+        }
+        sort_keyed_and_check(keyed);
+    }
+
+    // all equal
+    std::ranges::fill(v, 42);
+    sort_and_check(v, ciel::less<>());
+
+    ciel::vector<std::pair<size_t, size_t>> keyed;
+    for (size_t i = 0; i < v.size(); ++i) {
+        keyed.emplace_back(42, i);
+    }
+    sort_keyed_and_check(keyed);
+
+    // non-default comparator goes to branchy partition
+    std::iota(v.begin(), v.end(), 0);
+    std::ranges::shuffle(v, g);
+    sort_and_check(v, [](size_t a, size_t b) { return a > b; });
+
+    ciel::vector<double> d(10000);
+    for (auto& i : d) {
+        i = std::uniform_real_distribution<double>(-1000.0, 1000.0)(g);
+    }
+    sort_and_check(d, ciel::greater<>());
+}
+
+namespace {
+
+template<size_t N, class T, class Compare>
+void sort_small_test(std::mt19937& g, Compare comp) {
+    for (size_t loop = 0; loop < 100; ++loop) {
+        ciel::vector<T> v(N);
+        for (auto& i : v) {
+            i = static_cast<T>(static_cast<int>(g() % 100) - 50);
+        }
+        ciel::vector<T> expected = v;
+        std::sort(expected.begin(), expected.end(), comp);
+
+        ciel::sort_small<N>(v.begin(), comp);
+        ASSERT_EQ(v, expected);
+    }
+}
+
+template<class T, class Compare, size_t... N>
+void sort_small_tests(std::mt19937& g, Compare comp, std::index_sequence<N...>) {
+    (sort_small_test<N, T>(g, comp), ...);
+}
+
+}   // namespace
+
+TEST(algorithm_tests, sort_small) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    sort_small_tests<int>(g, ciel::less<>(), std::make_index_sequence<33>());
+    sort_small_tests<unsigned int>(g, ciel::greater<>(), std::make_index_sequence<33>());
+    sort_small_tests<float>(g, ciel::less<>(), std::make_index_sequence<33>());
+    sort_small_tests<double>(g, ciel::greater<double>(), std::make_index_sequence<33>());
+    sort_small_tests<int64_t>(g, ciel::less<>(), std::make_index_sequence<33>());
+    sort_small_tests<int>(g, [](int a, int b) { return a < b; }, std::make_index_sequence<33>());
+
+    // 0-1 principle: a network sorts everything if it sorts all the sequences of 0 and 1
+    for (uint32_t bits = 0; bits < (1 << 16); ++bits) {
+        int arr[16];
+        for (size_t i = 0; i < 16; ++i) {
+            arr[i] = (bits >> i) & 1;
+        }
+        ciel::sort_small<16>(arr);
+        ASSERT_TRUE(ciel::is_sorted(arr, arr + 16));
+        ASSERT_EQ(std::accumulate(arr, arr + 16, 0), std::popcount(bits));
+    }
+
+    // -0.0 and 0.0 are equivalent but both of them must survive
+    float arr[] = {0.0f, 1.0f, -0.0f, -1.0f, 0.0f, -0.0f};
+    ciel::sort_small<6>(arr);
+    ASSERT_EQ(std::count_if(arr, arr + 6, [](float f) { return f == 0.0f && std::signbit(f); }), 2);
+    ASSERT_EQ(std::count_if(arr, arr + 6, [](float f) { return f == 0.0f && !std::signbit(f); }), 2);
+}
+
+TEST(algorithm_tests, sort_small_ranges) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    // Lengths around the padded network sizes, they all go to sort_small_n
+    for (size_t len = 0; len <= 40; ++len) {
+        ciel::vector<uint32_t> v(len);
+        for (auto& i : v) {
+            i = g();
+        }
+        ciel::vector<uint32_t> expected = v;
+        std::sort(expected.begin(), expected.end());
+        ciel::sort(v.begin(), v.end());
+        ASSERT_EQ(v, expected);
+
+        ciel::vector<double> d(len);
+        for (auto& i : d) {
+            i = static_cast<double>(g() % 10) - 5.0;
+        }
+        ciel::vector<double> expected_d = d;
+        std::sort(expected_d.begin(), expected_d.end(), std::greater<>());
+        ciel::sort(d.begin(), d.end(), ciel::greater<>());
+        ASSERT_EQ(d, expected_d);
+    }
+}
+
+TEST(algorithm_tests, radix_sort) {
+    std::random_device rd;
+    std::mt19937_64 g(rd());
+
+    ciel::vector<uint64_t> u(10000);
+    ciel::vector<int32_t> i(10000);
+    ciel::vector<double> d(10000);
+
+    for (size_t loop = 0; loop < 10; ++loop) {
+        for (auto& e : u) {
+            e = g() >> (g() % 64);
+        }
+        for (auto& e : i) {
+            e = static_cast<int32_t>(g());
+        }
+        for (auto& e : d) {
+            e = std::uniform_real_distribution<double>(-1000.0, 1000.0)(g);
+        }
+
+        ciel::vector<uint64_t> u2(u);
+        ciel::vector<int32_t> i2(i);
+        ciel::vector<double> d2(d);
+
+        ciel::radix_sort(u.begin(), u.end());
+        ciel::radix_sort(i.begin(), i.end());
+        ciel::radix_sort(d.begin(), d.end());
+        ASSERT_TRUE(ciel::is_sorted(u.begin(), u.end()));
+        ASSERT_TRUE(ciel::is_sorted(i.begin(), i.end()));
+        ASSERT_TRUE(ciel::is_sorted(d.begin(), d.end()));
+
+        ciel::in_place_radix_sort(u2.begin(), u2.end());
+        ciel::in_place_radix_sort(i2.begin(), i2.end());
+        ciel::in_place_radix_sort(d2.begin(), d2.end());
+        ASSERT_EQ(u, u2);
+        ASSERT_EQ(i, i2);
+        ASSERT_EQ(d, d2);
+    }
+}
+
+TEST(algorithm_tests, radix_sort_stability) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<ciel::pair<int, size_t>> vp;
+    for (size_t i = 0; i < 5000; ++i) {
+        vp.emplace_back(static_cast<int>(g() % 100) - 50, i);
+    }
+
+    ciel::radix_sort(vp.begin(), vp.end(), &ciel::pair<int, size_t>::first, ciel::allocator<int>());
+
+    for (size_t i = 1; i < vp.size(); ++i) {
+        ASSERT_TRUE(vp[i - 1].first < vp[i].first
+                    || (vp[i - 1].first == vp[i].first && vp[i - 1].second < vp[i].second));
+    }
+}
+
+TEST(algorithm_tests, parallel_sort) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::thread_pool pool(3);
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 200000; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (size_t loop = 0; loop < 5; ++loop) {
+        std::ranges::shuffle(v, g);
+
+        ciel::sort(ciel::execution::par.on(pool), v.begin(), v.end());
+        ASSERT_TRUE(ciel::is_sorted(v.begin(), v.end()));
+    }
+
+    // many duplicates
+    for (auto& i : v) {
+        i = g() % 16;
+    }
+    ciel::sort(ciel::execution::par, v.begin(), v.end(), [](size_t a, size_t b) { return a > b; });
+    ASSERT_TRUE(ciel::is_sorted(v.begin(), v.end(), ciel::greater<>()));
+
+    ciel::sort(ciel::execution::seq, v.begin(), v.end());
+    ASSERT_TRUE(ciel::is_sorted(v.begin(), v.end()));
+
+    // Small grain forks much deeper
+    std::ranges::shuffle(v, g);
+    ciel::sort(ciel::execution::par.on(pool).with_grain(64), v.begin(), v.end());
+    ASSERT_TRUE(ciel::is_sorted(v.begin(), v.end()));
+}
+
 TEST(algorithm_tests, stable_sort) {
     std::random_device rd;
     std::mt19937 g(rd());
@@ -141,4 +758,81 @@ TEST(algorithm_tests, stable_sort_stability) {
             }
         }
     }
+}
+
+TEST(algorithm_tests, stable_sort_partially_sorted) {
+    // Long sorted runs with a few random elements in between, so that merges go into galloping mode,
+    // pairs are (key, index) to check stability
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    const auto comp = [](const ciel::pair<size_t, size_t>& a, const ciel::pair<size_t, size_t>& b) {
+        return a.first < b.first;
+    };
+
+    ciel::vector<ciel::pair<size_t, size_t>> buffer;
+
+    for (size_t loop = 0; loop < 10; ++loop) {
+        ciel::vector<ciel::pair<size_t, size_t>> vp;
+        for (size_t run = 0; run < 20; ++run) {
+            const size_t run_len = g() % 2000;
+            const size_t base = g() % 1000;
+            for (size_t i = 0; i < run_len; ++i) {
+                vp.emplace_back(run % 2 == 0 ? base + i / 3 : g() % 3000, vp.size());
+            }
+        }
+
+        if (loop % 2 == 0) {
+            ciel::stable_sort(vp.begin(), vp.end(), comp, buffer);
+            ASSERT_TRUE(buffer.empty());
+
+        } else {
+            ciel::stable_sort(vp.begin(), vp.end(), comp, ciel::allocator<int>());
+        }
+
+        for (size_t i = 1; i < vp.size(); ++i) {
+            ASSERT_TRUE(vp[i - 1].first < vp[i].first
+                        || (vp[i - 1].first == vp[i].first && vp[i - 1].second < vp[i].second));
+        }
+    }
+
+    // Descending runs are reversed, equal elements are never in a descending run
+    ciel::vector<ciel::pair<size_t, size_t>> vp;
+    for (size_t i = 0; i < 10000; ++i) {
+        vp.emplace_back((10000 - i) / 2, i);
+    }
+    ciel::stable_sort(vp.begin(), vp.end(), comp, buffer);
+    for (size_t i = 1; i < vp.size(); ++i) {
+        ASSERT_TRUE(vp[i - 1].first < vp[i].first
+                    || (vp[i - 1].first == vp[i].first && vp[i - 1].second < vp[i].second));
+    }
+}
+
+TEST(algorithm_tests, parallel_stable_sort_stability) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::thread_pool pool(3);
+
+    ciel::vector<ciel::pair<size_t, size_t>> vp;
+    for (size_t i = 0; i < 200000; ++i) {
+        vp.emplace_back(g() % 1000, i);
+    }
+
+    ciel::stable_sort(ciel::execution::par.on(pool), vp.begin(), vp.end(),
+                      [](const ciel::pair<size_t, size_t>& a, const ciel::pair<size_t, size_t>& b) {
+        return a.first < b.first;
+    });
+
+    for (size_t i = 1; i < vp.size(); ++i) {
+        ASSERT_TRUE(vp[i - 1].first < vp[i].first
+                    || (vp[i - 1].first == vp[i].first && vp[i - 1].second < vp[i].second));
+    }
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 100000; ++i) {
+        v.emplace_back(g());
+    }
+    ciel::stable_sort(ciel::execution::par, v.begin(), v.end());
+    ASSERT_TRUE(ciel::is_sorted(v.begin(), v.end()));
 }
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/btree_map.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+
+TEST(btree_map_tests, constructors_and_assignments) {
+    const ciel::btree_map<int, int> s0;
+    ASSERT_TRUE(s0.empty());
+
+    const ciel::btree_map<int, int> s1{{0, 6}, {1, 7}, {2, 3}, {3, 5}, {4, 1}, {5, 0}};
+    const ciel::btree_map<int, int> s2{{5, 0}, {3, 5}, {1, 7}, {4, 1}, {0, 6}, {2, 3}, {1, 2}};
+    ASSERT_EQ(s1, s2);
+
+    const ciel::vector<ciel::pair<int, int>> v1{{5, 0}, {1, 7}, {4, 1}, {0, 6}, {2, 3}, {3, 5}};
+    const ciel::btree_map<int, int> s3(v1.begin(), v1.end());
+    ASSERT_EQ(s1, s3);
+
+    ciel::btree_map s4(s3);
+    ASSERT_EQ(s4, s3);
+
+    ciel::btree_map s5(std::move(s4));
+    ASSERT_EQ(s5, s3);
+    ASSERT_TRUE(s4.empty());
+
+    s4 = s5;
+    ASSERT_EQ(s4, s5);
+
+    s5 = {{7, 7}, {8, 8}};
+    ASSERT_EQ(s5.size(), 2);
+
+    s4.swap(s5);
+    ASSERT_EQ(s4.size(), 2);
+    ASSERT_EQ(s5, s3);
+}
+
+TEST(btree_map_tests, insert_and_delete) {
+    ciel::btree_map<int, int> s1;
+
+    s1.insert({{0, 2}, {1, 3}, {4, 0}, {3, 4}, {5, 0}, {2, 1}, {3, 5}, {4, 0}, {6, 2}, {3, 5}, {2, 1}, {0, 2}, {1, 3},
+               {3, 0}, {6, 4}, {1, 2}});
+    s1.emplace_hint(s1.end(), 7, 8);
+    s1.emplace_hint(s1.begin(), 8, 0);
+    s1.emplace(1, 2);
+    s1.emplace(10, 10);
+    s1.emplace_hint(s1.end(), 9, 3);
+    s1.insert_or_assign(6, 3);
+    s1.insert_or_assign(11, 2);
+    s1[3] = 6;
+    s1[12] = 1;
+
+    const ciel::btree_map<int, int> tmp1
+        {{0, 2}, {1, 3}, {2, 1}, {3, 6}, {4, 0}, {5, 0}, {6, 3}, {7, 8}, {8, 0}, {9, 3}, {10, 10}, {11, 2}, {12, 1}};
+    ASSERT_EQ(s1, tmp1);
+
+    s1.erase(5);
+    s1.erase(0);
+    s1.erase(8);
+
+    const ciel::btree_map<int, int> tmp2
+        {{1, 3}, {2, 1}, {3, 6}, {4, 0}, {6, 3}, {7, 8}, {9, 3}, {10, 10}, {11, 2}, {12, 1}};
+    ASSERT_EQ(s1, tmp2);
+
+    ciel::vector<ciel::pair<int, int>> v1{{8, 0}, {5, 5}};
+    s1.insert(v1.begin(), v1.end());
+    s1.try_emplace(13, 1);
+    s1.try_emplace(11, 11);
+
+    const ciel::btree_map<int, int> tmp3
+        {{1, 3}, {2, 1}, {3, 6}, {4, 0}, {5, 5}, {6, 3}, {7, 8}, {8, 0}, {9, 3}, {10, 10}, {11, 2}, {12, 1}, {13, 1}};
+    ASSERT_EQ(s1, tmp3);
+
+    ASSERT_EQ(ciel::erase_if(s1, [](const auto& p) {
+        return p.first % 2 == 0;
+    }), 6);
+    ASSERT_EQ(s1.size(), 7);
+
+    s1.clear();
+    ASSERT_TRUE(s1.empty());
+}
+
+TEST(btree_map_tests, find) {
+    ciel::btree_map<int, int>
+        s1 = {{3, 1}, {0, 4}, {5, 7}, {0, 3}, {1, 2}, {4, 0}, {1, 0}, {3, 8}, {4, 6}, {9, 5}, {2, 9}, {4, 1}};
+
+    ASSERT_EQ(s1.find(3)->second, 1);
+    ASSERT_TRUE(s1.contains(9));
+    ASSERT_EQ(s1.count(0), 1);
+    ASSERT_EQ(s1.lower_bound(4)->second, 0);
+    ASSERT_EQ(s1.upper_bound(7)->second, 5);
+    ASSERT_EQ(s1[5], 7);
+    ASSERT_EQ(s1[2], 9);
+    ASSERT_EQ(s1.begin()->second, 4);
+    ASSERT_EQ(s1.at(9), 5);
+
+    s1.find(9)->second = 10;
+    ASSERT_EQ(s1.at(9), 10);
+
+    const auto er = s1.equal_range(5);
+    ASSERT_EQ(std::distance(er.first, er.second), 1);
+}
+
+TEST(btree_map_tests, multimap) {
+    ciel::btree_multimap<int, int> s1{{3, 1}, {0, 4}, {3, 2}, {1, 5}, {3, 3}};
+    s1.emplace(3, 4);
+    s1.emplace_hint(s1.begin(), 0, 5);
+
+    ASSERT_EQ(s1.size(), 7);
+    ASSERT_EQ(s1.count(3), 4);
+
+    // Equal keys keep insertion order.
+    int expected = 1;
+    for (auto [first, last] = s1.equal_range(3); first != last; ++first) {
+        ASSERT_EQ(first->second, expected++);
+    }
+
+    ASSERT_EQ(s1.erase(3), 4);
+    ASSERT_EQ(s1.size(), 3);
+}
+
+TEST(btree_map_tests, string_values) {
+    std::mt19937_64 g(42);
+    ciel::btree_map<std::string, std::string> s;
+    std::map<std::string, std::string> expected;
+
+    for (size_t i = 0; i < 20000; ++i) {
+        std::string key = std::to_string(g() % 3000);
+        if (g() % 4 != 0) {
+            const std::string value(g() % 40, 'x');
+            s.insert_or_assign(key, value);
+            expected.insert_or_assign(key, value);
+
+        } else {
+            ASSERT_EQ(s.erase(key), expected.erase(key));
+        }
+    }
+
+    ASSERT_EQ(s.size(), expected.size());
+    ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end(), [](const auto& l, const auto& r) {
+        return l.first == r.first && l.second == r.second;
+    }));
+}
\ No newline at end of file
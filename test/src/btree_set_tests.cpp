@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/btree_set.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+
+namespace {
+
+// Large enough that a node only holds 3 values, so small trees are already several levels deep.
+struct wide_key {
+    size_t key;
+    char padding[120]{};
+
+    wide_key(const size_t k) noexcept
+        : key(k) {}
+
+    friend auto operator<(const wide_key& lhs, const wide_key& rhs) noexcept -> bool {
+        return lhs.key < rhs.key;
+    }
+
+    friend auto operator==(const wide_key& lhs, const wide_key& rhs) noexcept -> bool {
+        return lhs.key == rhs.key;
+    }
+
+};  // struct wide_key
+
+template<class Set, class Expected>
+auto same_elements(const Set& s, const Expected& expected) -> bool {
+    return s.size() == expected.size() && std::equal(s.begin(), s.end(), expected.begin(), expected.end())
+        && std::equal(s.rbegin(), s.rend(), expected.rbegin(), expected.rend());
+}
+
+template<class T>
+auto random_operations(const size_t count, const size_t key_range) -> void {
+    std::mt19937_64 g(count);
+    std::uniform_int_distribution<size_t> key(0, key_range);
+
+    ciel::btree_set<T> s;
+    ciel::btree_multiset<T> ms;
+    std::set<T> expected;
+    std::multiset<T> expected_multi;
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t k = key(g);
+        if (g() % 3 != 0) {
+            ASSERT_EQ(s.insert(k).second, expected.insert(k).second);
+            ASSERT_EQ(*ms.insert(k), T(k));
+            expected_multi.insert(k);
+
+        } else {
+            ASSERT_EQ(s.erase(k), expected.erase(k));
+            ASSERT_EQ(ms.erase(k), expected_multi.erase(k));
+        }
+    }
+    ASSERT_TRUE(same_elements(s, expected));
+    ASSERT_TRUE(same_elements(ms, expected_multi));
+
+    for (size_t i = 0; i < key_range; ++i) {
+        ASSERT_EQ(s.contains(i), expected.contains(i));
+        ASSERT_EQ(ms.count(i), expected_multi.count(i));
+
+        const auto lb = ms.lower_bound(i);
+        const auto expected_lb = expected_multi.lower_bound(i);
+        ASSERT_EQ(lb == ms.end(), expected_lb == expected_multi.end());
+        if (lb != ms.end()) {
+            ASSERT_EQ(*lb, *expected_lb);
+        }
+    }
+
+    // Every erase must hand back the element after the erased one.
+    while (!ms.empty()) {
+        const size_t index = g() % ms.size();
+        auto it = std::next(ms.begin(), static_cast<ptrdiff_t>(index));
+        auto expected_it = std::next(expected_multi.begin(), static_cast<ptrdiff_t>(index));
+
+        it = ms.erase(it);
+        expected_it = expected_multi.erase(expected_it);
+
+        ASSERT_EQ(it == ms.end(), expected_it == expected_multi.end());
+        if (it != ms.end()) {
+            ASSERT_EQ(*it, *expected_it);
+        }
+        ASSERT_EQ(ms.size(), expected_multi.size());
+    }
+}
+
+}   // namespace
+
+TEST(btree_set_tests, constructors_and_assignments) {
+    const ciel::btree_set<int> s0;
+    ASSERT_TRUE(s0.empty());
+    ASSERT_EQ(s0.begin(), s0.end());
+
+    const ciel::btree_set s1{0, 1, 2, 3, 4, 5};
+    const ciel::btree_set s2{5, 3, 1, 4, 0, 2};
+    ASSERT_EQ(s1, s2);
+
+    const ciel::vector v1{5, 1, 4, 0, 2, 3, 1, 4, 0, 5};
+    const ciel::btree_set s3(v1.begin(), v1.end());
+    ASSERT_EQ(s1, s3);
+
+    const ciel::btree_multiset ms1(v1.begin(), v1.end());
+    ASSERT_EQ(ms1, ciel::btree_multiset({0, 0, 1, 1, 2, 3, 4, 4, 5, 5}));
+
+    ciel::btree_set s4(s3);
+    ASSERT_EQ(s4, s3);
+
+    ciel::btree_set s5(std::move(s4));
+    ASSERT_EQ(s5, s3);
+    ASSERT_TRUE(s4.empty());
+
+    s4 = s5;
+    ASSERT_EQ(s4, s5);
+
+    s5 = {7, 8, 9};
+    ASSERT_EQ(s5, ciel::btree_set({9, 8, 7}));
+
+    s4 = std::move(s5);
+    ASSERT_EQ(s4, ciel::btree_set({7, 8, 9}));
+
+    s4.swap(s5);
+    ASSERT_TRUE(s4.empty());
+    ASSERT_EQ(s5, ciel::btree_set({7, 8, 9}));
+}
+
+TEST(btree_set_tests, insert_and_delete) {
+    ciel::btree_set<int> s1;
+
+    s1.insert({0, 1, 4, 3, 5, 2, 3, 4, 6, 3, 2, 0, 1, 3, 6, 1});
+    s1.emplace_hint(s1.end(), 7);
+    s1.emplace_hint(s1.begin(), 8);
+    s1.emplace(1);
+    s1.emplace(10);
+    s1.emplace_hint(s1.end(), 9);
+
+    ASSERT_EQ(s1, ciel::btree_set({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    s1.erase(5);
+    s1.erase(0);
+    s1.erase(8);
+
+    ASSERT_EQ(s1, ciel::btree_set({1, 2, 3, 4, 6, 7, 9, 10}));
+
+    ASSERT_EQ(*s1.erase(s1.find(4)), 6);
+    const auto last = s1.erase(s1.find(10));
+    ASSERT_EQ(last, s1.end());
+    ASSERT_EQ(*s1.erase(s1.find(2), s1.find(7)), 7);
+    ASSERT_EQ(s1, ciel::btree_set({1, 7, 9}));
+
+    ASSERT_EQ(ciel::erase_if(s1, [](const int i) {
+        return i > 5;
+    }), 2);
+    ASSERT_EQ(s1, ciel::btree_set({1}));
+
+    s1.clear();
+    ASSERT_TRUE(s1.empty());
+}
+
+TEST(btree_set_tests, find) {
+    ciel::btree_multiset s1{3, 1, 0, 4, 5, 7, 0, 3, 1, 2, 4, 0, 1, 0, 3, 8, 4, 6, 5, 3, 4, 7, 0, 3, 1, 4, 0, 7, 4, 1, 9,
+                            5, 9, 1, 5, 1, 2, 9, 4, 1, 4};
+    ASSERT_EQ(*s1.find(3), 3);
+    ASSERT_TRUE(s1.contains(9));
+    ASSERT_EQ(s1.count(0), 6);
+    ASSERT_EQ(s1.count(4), 8);
+    ASSERT_EQ(*s1.lower_bound(4), 4);
+    ASSERT_EQ(*s1.upper_bound(7), 8);
+    ASSERT_EQ(s1.find(10), s1.end());
+
+    const auto er = s1.equal_range(5);
+    ASSERT_EQ(std::distance(er.first, er.second), 4);
+}
+
+TEST(btree_set_tests, insert_element_of_itself) {
+    ciel::btree_multiset<wide_key> s;
+    for (size_t i = 0; i < 100; ++i) {
+        s.insert(i);
+    }
+    for (size_t i = 0; i < 100; ++i) {
+        s.insert(*s.find(i));
+    }
+    ASSERT_EQ(s.size(), 200);
+    for (size_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(s.count(i), 2);
+    }
+}
+
+TEST(btree_set_tests, sorted_each_insert) {
+    ciel::btree_set<size_t> s;
+    for (size_t i = 0; i < 2500; ++i) {
+        s.emplace(i);
+    }
+    for (size_t i = 7500; i > 2499; --i) {
+        s.emplace(i);
+    }
+    for (size_t i = 7501; i < 10000; ++i) {
+        s.emplace_hint(s.end(), i);
+    }
+
+    ASSERT_EQ(s.size(), 10000);
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end()));
+    ASSERT_LE(s.height(), 4);
+}
+
+TEST(btree_set_tests, large_amount_random_deletion) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (size_t loop = 0; loop < 5; ++loop) {
+        ciel::btree_set<wide_key> s(v.begin(), v.end());
+
+        std::ranges::shuffle(v, g);
+        for (const size_t i : v) {
+            ASSERT_EQ(s.erase(i), 1);
+        }
+
+        ASSERT_TRUE(s.empty());
+        ASSERT_EQ(s.height(), 0);
+    }
+}
+
+TEST(btree_set_tests, random_operations) {
+    random_operations<wide_key>(20000, 2000);
+    random_operations<size_t>(100000, 10000);
+    random_operations<size_t>(100000, 100);
+}
+
+TEST(btree_set_tests, greater) {
+    ciel::btree_set<int, ciel::greater<int>> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    ASSERT_EQ(*s.begin(), 999);
+    ASSERT_EQ(*s.lower_bound(500), 500);
+    ASSERT_EQ(*s.upper_bound(500), 499);
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end(), std::greater<int>()));
+}
\ No newline at end of file
@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/compact_set.hpp>
+#include <ciel/vector.hpp>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+
+namespace {
+
+template<class Set, class Expected>
+auto same_elements(const Set& s, const Expected& expected) -> bool {
+    return s.size() == expected.size() && std::equal(s.begin(), s.end(), expected.begin(), expected.end())
+        && std::equal(s.rbegin(), s.rend(), expected.rbegin(), expected.rend());
+}
+
+// An avl tree of n nodes is lower than 1.44 log2(n + 2).
+template<class Set>
+auto balanced(const Set& s) -> bool {
+    return static_cast<double>(s.height()) < 1.45 * std::log2(static_cast<double>(s.size() + 2));
+}
+
+auto random_operations(const size_t count, const size_t key_range) -> void {
+    std::mt19937_64 g(count);
+    std::uniform_int_distribution<size_t> key(0, key_range);
+
+    ciel::compact_set<size_t> s;
+    std::set<size_t> expected;
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t k = key(g);
+        if (g() % 3 != 0) {
+            const auto res = s.insert(k);
+            ASSERT_EQ(res.second, expected.insert(k).second);
+            ASSERT_EQ(*res.first, k);
+
+        } else {
+            ASSERT_EQ(s.erase(k), expected.erase(k));
+        }
+    }
+    ASSERT_TRUE(same_elements(s, expected));
+    ASSERT_TRUE(balanced(s));
+
+    for (size_t i = 0; i < key_range; ++i) {
+        ASSERT_EQ(s.contains(i), expected.contains(i));
+
+        const auto lb = s.lower_bound(i);
+        const auto expected_lb = expected.lower_bound(i);
+        ASSERT_EQ(lb == s.end(), expected_lb == expected.end());
+        if (lb != s.end()) {
+            ASSERT_EQ(*lb, *expected_lb);
+            ASSERT_EQ(std::distance(lb, s.end()), std::distance(expected_lb, expected.end()));
+        }
+
+        const auto ub = s.upper_bound(i);
+        const auto expected_ub = expected.upper_bound(i);
+        ASSERT_EQ(ub == s.end(), expected_ub == expected.end());
+        if (ub != s.begin()) {
+            ASSERT_EQ(*std::prev(ub), *std::prev(expected_ub));
+        }
+    }
+
+    // Every erase must hand back the element after the erased one.
+    while (!s.empty()) {
+        const size_t index = g() % s.size();
+        auto it = std::next(s.begin(), static_cast<ptrdiff_t>(index));
+        auto expected_it = std::next(expected.begin(), static_cast<ptrdiff_t>(index));
+
+        it = s.erase(it);
+        expected_it = expected.erase(expected_it);
+
+        ASSERT_EQ(it == s.end(), expected_it == expected.end());
+        if (it != s.end()) {
+            ASSERT_EQ(*it, *expected_it);
+        }
+        ASSERT_EQ(s.size(), expected.size());
+    }
+}
+
+}   // namespace
+
+TEST(compact_set_tests, constructors_and_assignments) {
+    const ciel::compact_set<int> s0;
+    ASSERT_TRUE(s0.empty());
+    ASSERT_EQ(s0.begin(), s0.end());
+
+    const ciel::compact_set s1{0, 1, 2, 3, 4, 5};
+    const ciel::compact_set s2{5, 3, 1, 4, 0, 2};
+    ASSERT_EQ(s1, s2);
+
+    const ciel::vector v1{5, 1, 4, 0, 2, 3, 1, 4, 0, 5};
+    const ciel::compact_set s3(v1.begin(), v1.end());
+    ASSERT_EQ(s1, s3);
+
+    ciel::compact_set s4(s3);
+    ASSERT_EQ(s4, s3);
+
+    ciel::compact_set s5(std::move(s4));
+    ASSERT_EQ(s5, s3);
+    ASSERT_TRUE(s4.empty());
+
+    s4 = s5;
+    ASSERT_EQ(s4, s5);
+
+    s5 = {7, 8, 9};
+    ASSERT_EQ(s5, ciel::compact_set({9, 8, 7}));
+
+    s4 = std::move(s5);
+    ASSERT_EQ(s4, ciel::compact_set({7, 8, 9}));
+
+    s4.swap(s5);
+    ASSERT_TRUE(s4.empty());
+    ASSERT_EQ(s5, ciel::compact_set({7, 8, 9}));
+}
+
+TEST(compact_set_tests, insert_and_delete) {
+    ciel::compact_set<int> s1;
+
+    s1.insert({0, 1, 4, 3, 5, 2, 3, 4, 6, 3, 2, 0, 1, 3, 6, 1});
+    s1.emplace_hint(s1.end(), 7);
+    s1.emplace_hint(s1.begin(), 8);
+    s1.emplace(1);
+    s1.emplace(10);
+    s1.emplace_hint(s1.end(), 9);
+
+    ASSERT_EQ(s1, ciel::compact_set({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    s1.erase(5);
+    s1.erase(0);
+    s1.erase(8);
+
+    ASSERT_EQ(s1, ciel::compact_set({1, 2, 3, 4, 6, 7, 9, 10}));
+
+    ASSERT_EQ(*s1.erase(s1.find(4)), 6);
+    const auto last = s1.erase(s1.find(10));
+    ASSERT_EQ(last, s1.end());
+    ASSERT_EQ(*s1.erase(s1.find(2), s1.find(7)), 7);
+    ASSERT_EQ(s1, ciel::compact_set({1, 7, 9}));
+
+    ASSERT_EQ(ciel::erase_if(s1, [](const int i) {
+        return i > 5;
+    }), 2);
+    ASSERT_EQ(s1, ciel::compact_set({1}));
+
+    s1.clear();
+    ASSERT_TRUE(s1.empty());
+}
+
+TEST(compact_set_tests, find) {
+    const ciel::compact_set s1{3, 1, 0, 4, 5, 7, 0, 3, 1, 2, 4, 0, 1, 0, 3, 8, 4, 6, 5, 3, 4, 7, 0, 3, 1, 4, 0, 7, 4,
+                               1, 9, 5, 9, 1, 5, 1, 2, 9, 4, 1, 4};
+    ASSERT_EQ(s1.size(), 10);
+    ASSERT_EQ(*s1.find(3), 3);
+    ASSERT_TRUE(s1.contains(9));
+    ASSERT_EQ(s1.count(0), 1);
+    ASSERT_EQ(*s1.lower_bound(4), 4);
+    ASSERT_EQ(*s1.upper_bound(7), 8);
+    ASSERT_EQ(s1.upper_bound(9), s1.end());
+    ASSERT_EQ(s1.find(10), s1.end());
+
+    const auto er = s1.equal_range(5);
+    ASSERT_EQ(std::distance(er.first, er.second), 1);
+}
+
+TEST(compact_set_tests, iterate_both_ways) {
+    ciel::compact_set<size_t> s;
+    for (size_t i = 0; i < 1000; ++i) {
+        s.emplace(i * 7 % 1000);
+    }
+
+    size_t expected = 0;
+    for (auto it = s.begin(); it != s.end(); ++it, ++expected) {
+        ASSERT_EQ(*it, expected);
+    }
+    for (auto it = s.end(); it != s.begin();) {
+        ASSERT_EQ(*--it, --expected);
+    }
+
+    // iterators keep their own paths, so copies move independently
+    auto it = s.find(500);
+    auto copy = it;
+    ++it;
+    --copy;
+    ASSERT_EQ(*it, 501);
+    ASSERT_EQ(*copy, 499);
+    ASSERT_EQ(*std::prev(s.end()), 999);
+}
+
+TEST(compact_set_tests, sorted_each_insert) {
+    ciel::compact_set<size_t> s;
+    for (size_t i = 0; i < 2500; ++i) {
+        s.emplace(i);
+    }
+    for (size_t i = 7500; i > 2499; --i) {
+        s.emplace(i);
+    }
+    for (size_t i = 7501; i < 10000; ++i) {
+        s.emplace_hint(s.end(), i);
+    }
+
+    ASSERT_EQ(s.size(), 10000);
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end()));
+    ASSERT_TRUE(balanced(s));
+}
+
+TEST(compact_set_tests, sorted_range_build) {
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 10000; ++i) {
+        v.emplace_back(i / 2);
+    }
+
+    const ciel::compact_set<size_t> s(v.begin(), v.end());
+    ASSERT_EQ(s.size(), 5000);
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end()));
+    ASSERT_EQ(s.height(), 13);
+}
+
+TEST(compact_set_tests, large_amount_random_deletion) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i);
+    }
+
+    for (size_t loop = 0; loop < 5; ++loop) {
+        ciel::compact_set<size_t> s(v.begin(), v.end());
+
+        std::ranges::shuffle(v, g);
+        for (const size_t i : v) {
+            ASSERT_EQ(s.erase(i), 1);
+        }
+
+        ASSERT_TRUE(s.empty());
+        ASSERT_EQ(s.height(), 0);
+    }
+}
+
+TEST(compact_set_tests, random_operations) {
+    random_operations(100000, 10000);
+    random_operations(100000, 100);
+}
+
+TEST(compact_set_tests, greater) {
+    ciel::compact_set<int, ciel::greater<int>> s;
+    for (int i = 0; i < 1000; ++i) {
+        s.insert(i);
+    }
+    ASSERT_EQ(*s.begin(), 999);
+    ASSERT_EQ(*s.lower_bound(500), 500);
+    ASSERT_EQ(*s.upper_bound(500), 499);
+    ASSERT_TRUE(std::is_sorted(s.begin(), s.end(), std::greater<int>()));
+}
\ No newline at end of file
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ciel/concurrent_skiplist_map.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+
+namespace {
+
+// Counts live objects, so that leaks and double frees of retired nodes show up.
+struct counted {
+    inline static std::atomic<int> live{0};
+
+    size_t value;
+
+    counted(const size_t v) noexcept
+        : value(v) {
+        ++live;
+    }
+
+    counted(const counted& other) noexcept
+        : value(other.value) {
+        ++live;
+    }
+
+    ~counted() {
+        --live;
+    }
+
+};  // struct counted
+
+template<class F>
+auto run_threads(const size_t count, F f) -> void {
+    ciel::vector<std::thread> threads;
+    for (size_t i = 0; i < count; ++i) {
+        threads.emplace_back(f, i);
+    }
+    for (std::thread& t : threads) {
+        t.join();
+    }
+}
+
+}   // namespace
+
+TEST(concurrent_skiplist_map_tests, single_thread) {
+    ciel::concurrent_skiplist_map<int, int> m;
+    std::map<int, int> expected;
+    std::mt19937 g(7);
+
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(m.begin(), m.end());
+
+    for (int i = 0; i < 20000; ++i) {
+        const int key = static_cast<int>(g() % 2000);
+        if (g() % 3 != 0) {
+            const auto res = m.emplace(key, i);
+            ASSERT_EQ(res.second, expected.emplace(key, i).second);
+            ASSERT_EQ(res.first->first, key);
+
+        } else {
+            ASSERT_EQ(m.erase(key), expected.erase(key));
+        }
+    }
+
+    ASSERT_EQ(m.size(), expected.size());
+    ASSERT_TRUE(std::equal(m.begin(), m.end(), expected.begin(), expected.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }));
+
+    for (int key = -1; key < 2001; ++key) {
+        ASSERT_EQ(m.contains(key), expected.contains(key));
+        ASSERT_EQ(m.count(key), expected.count(key));
+
+        const auto lb = m.lower_bound(key);
+        const auto expected_lb = expected.lower_bound(key);
+        ASSERT_EQ(lb == m.end(), expected_lb == expected.end());
+        if (lb != m.end()) {
+            ASSERT_EQ(lb->first, expected_lb->first);
+        }
+
+        const auto ub = m.upper_bound(key);
+        const auto expected_ub = expected.upper_bound(key);
+        ASSERT_EQ(ub == m.end(), expected_ub == expected.end());
+        if (ub != m.end()) {
+            ASSERT_EQ(ub->first, expected_ub->first);
+        }
+    }
+
+    ASSERT_FALSE(m.try_emplace(expected.begin()->first, -1).second);
+    ASSERT_TRUE(m.try_emplace(5000, -1).second);
+    ASSERT_EQ(m.find(5000)->second, -1);
+    m.find(5000)->second = 1;
+    ASSERT_EQ(m.find(5000)->second, 1);
+
+    m.clear();
+    ASSERT_TRUE(m.empty());
+    ASSERT_EQ(m.find(5000), m.end());
+}
+
+TEST(concurrent_skiplist_map_tests, transparent_lookups) {
+    ciel::concurrent_skiplist_map<std::string, int, ciel::less<>> m;
+    for (int i = 0; i < 10; ++i) {
+        m.emplace(std::string(1, static_cast<char>('a' + i * 2)), i);
+    }
+
+    const std::string_view c = "c";
+    const std::string_view d = "d";
+    ASSERT_EQ(m.find(c)->second, 1);
+    ASSERT_EQ(m.find(d), m.end());
+    ASSERT_TRUE(m.contains(c));
+    ASSERT_EQ(m.count(d), 0);
+    ASSERT_EQ(m.lower_bound(d)->first, "e");
+    ASSERT_EQ(m.upper_bound(c)->first, "e");
+    ASSERT_EQ(m.upper_bound(d)->first, "e");
+
+    const auto [first, last] = m.equal_range(c);
+    ASSERT_EQ(first->first, "c");
+    ASSERT_EQ(last->first, "e");
+
+    const auto& cm = m;
+    const auto [cfirst, clast] = cm.equal_range(d);
+    ASSERT_EQ(cfirst, clast);
+    ASSERT_EQ(cm.upper_bound(std::string_view("s")), cm.end());
+}
+
+TEST(concurrent_skiplist_map_tests, concurrent_insert) {
+    constexpr size_t thread_count = 4;
+    constexpr size_t per_thread = 5000;
+
+    ciel::concurrent_skiplist_map<size_t, size_t> m;
+    std::atomic<size_t> inserted{0};
+
+    // every key is raced by two threads
+    run_threads(thread_count, [&](const size_t t) {
+        for (size_t i = 0; i < per_thread; ++i) {
+            const size_t key = i * thread_count / 2 + t / 2;
+            if (m.emplace(key, t).second) {
+                ++inserted;
+            }
+        }
+    });
+
+    ASSERT_EQ(inserted.load(), thread_count / 2 * per_thread);
+    ASSERT_EQ(m.size(), inserted.load());
+
+    size_t expected = 0;
+    for (const auto& p : m) {
+        ASSERT_EQ(p.first, expected++);
+    }
+    ASSERT_EQ(expected, m.size());
+}
+
+TEST(concurrent_skiplist_map_tests, concurrent_insert_erase_find) {
+    constexpr size_t thread_count = 4;
+    constexpr size_t key_range = 512;
+
+    {
+        ciel::concurrent_skiplist_map<size_t, counted> m;
+        std::atomic<size_t> balance{0};
+
+        run_threads(thread_count, [&](const size_t t) {
+            std::mt19937_64 g(t);
+            for (size_t i = 0; i < 30000; ++i) {
+                const size_t key = g() % key_range;
+                switch (g() % 4) {
+                    case 0 :
+                    case 1 :
+                        if (m.emplace(key, key).second) {
+                            ++balance;
+                        }
+                        break;
+                    case 2 :
+                        balance -= m.erase(key);
+                        break;
+                    default :
+                        if (auto it = m.find(key); it != m.end()) {
+                            ASSERT_EQ(it->second.value, key);
+                        }
+                }
+            }
+        });
+
+        ASSERT_EQ(m.size(), balance.load());
+        size_t count = 0;
+        size_t last = 0;
+        for (const auto& p : m) {
+            ASSERT_TRUE(count == 0 || last < p.first);
+            last = p.first;
+            ++count;
+        }
+        ASSERT_EQ(count, m.size());
+    }
+    ASSERT_EQ(counted::live.load(), 0);
+}
+
+TEST(concurrent_skiplist_map_tests, iterate_while_modifying) {
+    ciel::concurrent_skiplist_map<size_t, size_t> m;
+    for (size_t i = 0; i < 1000; i += 2) {
+        m.emplace(i, i);
+    }
+
+    std::atomic<bool> stop{false};
+    std::thread writer([&] {
+        std::mt19937_64 g(1);
+        while (!stop.load()) {
+            const size_t key = g() % 1000;
+            if (key % 2 == 0) {
+                continue;   // even keys stay
+            }
+            if (g() % 2 == 0) {
+                m.emplace(key, key);
+            } else {
+                m.erase(key);
+            }
+        }
+    });
+
+    // Stops the writer before a failed ASSERT returns, a joinable thread would terminate on destruction
+    struct writer_guard {
+        std::atomic<bool>& stop;
+        std::thread& writer;
+
+        ~writer_guard() {
+            stop.store(true);
+            writer.join();
+        }
+    } guard{stop, writer};
+
+    for (size_t round = 0; round < 200; ++round) {
+        size_t evens = 0;
+        size_t last = 0;
+        bool first = true;
+        for (const auto& p : m) {
+            ASSERT_TRUE(first || last < p.first);
+            first = false;
+            last = p.first;
+            evens += static_cast<size_t>(p.first % 2 == 0);
+        }
+        ASSERT_EQ(evens, 500);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,321 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <ciel/algorithm.hpp>
+#include <ciel/execution.hpp>
+#include <ciel/list.hpp>
+#include <ciel/numeric.hpp>
+#include <ciel/vector.hpp>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <stdexcept>
+
+namespace {
+
+auto fib(ciel::thread_pool& pool, size_t n) -> size_t {
+    if (n < 2) {
+        return n;
+    }
+    size_t a = 0;
+    size_t b = 0;
+    ciel::details::parallel_invoke(pool, [&] { a = fib(pool, n - 1); }, [&] { b = fib(pool, n - 2); });
+    return a + b;
+}
+
+// Every size crosses the register boundaries, wrapping around is fine for the unsigned ones
+template<class T>
+void scan_test(std::mt19937& g) {
+    for (size_t n = 0; n < 100; ++n) {
+        ciel::vector<T> v(n);
+        for (T& x : v) {
+            x = static_cast<T>(static_cast<int>(g() % 2001) - 1000);
+        }
+
+        ciel::vector<T> expected(n);
+        ciel::vector<T> out(n);
+
+        std::inclusive_scan(v.begin(), v.end(), expected.begin());
+        ASSERT_EQ(ciel::inclusive_scan(v.begin(), v.end(), out.begin()), out.end());
+        ASSERT_EQ(out, expected);
+
+        std::inclusive_scan(v.begin(), v.end(), expected.begin(), std::plus<>(), T(5));
+        ASSERT_EQ(ciel::inclusive_scan(v.begin(), v.end(), out.begin(), ciel::plus<>(), T(5)), out.end());
+        ASSERT_EQ(out, expected);
+
+        std::exclusive_scan(v.begin(), v.end(), expected.begin(), T(7));
+        ASSERT_EQ(ciel::exclusive_scan(v.begin(), v.end(), out.begin(), T(7)), out.end());
+        ASSERT_EQ(out, expected);
+
+        // In place
+        out = v;
+        ciel::exclusive_scan(out.begin(), out.end(), out.begin(), T(7), ciel::plus<T>());
+        ASSERT_EQ(out, expected);
+
+        std::inclusive_scan(v.begin(), v.end(), expected.begin());
+        out = v;
+        ciel::inclusive_scan(out.begin(), out.end(), out.begin());
+        ASSERT_EQ(out, expected);
+    }
+}
+
+constexpr auto constexpr_scan() -> int {
+    int a[5] = {1, 2, 3, 4, 5};
+    int b[5] = {};
+    ciel::inclusive_scan(a, a + 5, b);
+    ciel::exclusive_scan(b, b + 5, b, 0);
+    return b[4] * 100 + ciel::transform_reduce(a, a + 5, a, 0);
+}
+
+}   // namespace
+
+TEST(execution_tests, execution_policy) {
+    static_assert(ciel::is_execution_policy_v<ciel::execution::sequenced_policy>);
+    static_assert(ciel::is_execution_policy_v<ciel::execution::parallel_policy>);
+    static_assert(ciel::is_execution_policy_v<ciel::execution::parallel_unsequenced_policy>);
+    static_assert(ciel::is_execution_policy_v<ciel::execution::unsequenced_policy>);
+    static_assert(!ciel::is_execution_policy_v<int>);
+
+    ciel::thread_pool pool(1);
+    ASSERT_EQ(ciel::execution::par.pool(), nullptr);
+    ASSERT_EQ(ciel::execution::par.on(pool).pool(), &pool);
+    ASSERT_EQ(ciel::execution::par_unseq.on(pool).pool(), &pool);
+
+    ASSERT_EQ(ciel::execution::par.grain(), 0);
+    ASSERT_EQ(ciel::execution::par.on(pool).with_grain(100).grain(), 100);
+    ASSERT_EQ(ciel::execution::par.on(pool).with_grain(100).pool(), &pool);
+    ASSERT_EQ(ciel::execution::par_unseq.with_grain(7).grain(), 7);
+}
+
+TEST(execution_tests, thread_pool_submit) {
+    std::atomic<size_t> count{0};
+    {
+        ciel::thread_pool pool(4);
+        ASSERT_EQ(pool.worker_count(), 4);
+        ASSERT_EQ(pool.concurrency(), 5);
+
+        for (size_t i = 0; i < 1000; ++i) {
+            pool.submit([&count] { count.fetch_add(1); });
+        }
+    }
+    ASSERT_EQ(count.load(), 1000);
+}
+
+TEST(execution_tests, nested_parallel_invoke) {
+    ciel::thread_pool pool(3);
+    ASSERT_EQ(fib(pool, 20), 6765);
+
+    // A pool without workers runs everything on the waiting thread
+    ciel::thread_pool empty_pool(0);
+    ASSERT_EQ(fib(empty_pool, 15), 610);
+}
+
+TEST(execution_tests, parallel_for) {
+    ciel::thread_pool pool(3);
+
+    ciel::vector<size_t> v(100000, 0);
+    auto f = [&v](size_t first, size_t last) {
+        for (; first != last; ++first) {
+            v[first] += first;
+        }
+    };
+    ciel::details::parallel_for(pool, size_t(0), v.size(), size_t(1000), f);
+
+    for (size_t i = 0; i < v.size(); ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+}
+
+TEST(execution_tests, exception_propagation) {
+    ciel::thread_pool pool(2);
+
+    std::atomic<bool> other_finished{false};
+    ASSERT_THROW(ciel::details::parallel_invoke(pool,
+                                                [&] { other_finished.store(true); },
+                                                [] { throw std::runtime_error("test"); }),
+                 std::runtime_error);
+    ASSERT_TRUE(other_finished.load());
+}
+
+TEST(execution_tests, public_parallel_for) {
+    ciel::thread_pool pool(3);
+
+    ciel::vector<int> v(100000, 0);
+    ciel::parallel_for(ciel::execution::par.on(pool).with_grain(100), 0, 100000, [&v](int i) { v[i] += i; });
+    for (int i = 0; i < 100000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+
+    ciel::parallel_for(ciel::execution::seq, -5, 5, [&v](int i) { v[i + 5] = -1; });
+    ASSERT_EQ(std::count(v.begin(), v.end(), -1), 10);
+
+    // Empty ranges
+    ciel::parallel_for(ciel::execution::par.on(pool), 5, 5, [](int) { FAIL(); });
+    ciel::parallel_for(ciel::execution::par.on(pool), 5, 0, [](int) { FAIL(); });
+}
+
+TEST(execution_tests, parallel_algorithms) {
+    ciel::thread_pool pool(3);
+
+    for (const size_t grain : {size_t(0), size_t(1), size_t(1000)}) {
+        const auto par = ciel::execution::par.on(pool).with_grain(grain);
+
+        for (const size_t n : {size_t(0), size_t(1), size_t(5000), size_t(100000)}) {
+            ciel::vector<uint32_t> v(n);
+            std::iota(v.begin(), v.end(), 0);
+
+            ASSERT_EQ(ciel::reduce(par, v.begin(), v.end(), uint64_t(0)), uint64_t(n) * (n - (n != 0)) / 2);
+
+            // Concatenation is not commutative, the order is kept
+            ciel::vector<std::string> digits(n);
+            for (size_t i = 0; i < n; ++i) {
+                digits[i] = std::to_string(i % 10);
+            }
+            ASSERT_EQ(ciel::reduce(par, digits.begin(), digits.end(), std::string("x")),
+                      std::accumulate(digits.begin(), digits.end(), std::string("x")));
+
+            ASSERT_EQ(ciel::count_if(par, v.begin(), v.end(), [](uint32_t x) { return x % 3 == 0; }),
+                      std::count_if(v.begin(), v.end(), [](uint32_t x) { return x % 3 == 0; }));
+
+            ASSERT_EQ(ciel::find_if(par, v.begin(), v.end(), [](uint32_t x) { return x >= 4321 && x % 7 == 0; }),
+                      std::find_if(v.begin(), v.end(), [](uint32_t x) { return x >= 4321 && x % 7 == 0; }));
+            ASSERT_EQ(ciel::find_if(par, v.begin(), v.end(), [](uint32_t) { return false; }), v.end());
+
+            ciel::vector<uint32_t> out(n, 0);
+            ASSERT_EQ(ciel::transform(par, v.begin(), v.end(), out.begin(), [](uint32_t x) { return x * 2; }),
+                      out.end());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(out[i], i * 2);
+            }
+
+            ASSERT_EQ(ciel::transform(par, v.begin(), v.end(), out.begin(), out.begin(), ciel::plus<>()), out.end());
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_EQ(out[i], i * 3);
+            }
+
+            ciel::for_each(par, out.begin(), out.end(), [](uint32_t& x) { x /= 3; });
+            ASSERT_EQ(out, v);
+
+            ciel::vector<uint32_t> filtered(n);
+            const auto filtered_end = ciel::copy_if(par, v.begin(), v.end(), filtered.begin(),
+                                                    [](uint32_t x) { return x % 10 < 3; });
+            ciel::vector<uint32_t> expected;
+            std::copy_if(v.begin(), v.end(), std::back_inserter(expected), [](uint32_t x) { return x % 10 < 3; });
+            ASSERT_EQ(filtered_end - filtered.begin(), static_cast<ptrdiff_t>(expected.size()));
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(), filtered.begin()));
+
+            ciel::fill(par, v.begin(), v.end(), 7);
+            ASSERT_EQ(std::count(v.begin(), v.end(), 7u), static_cast<ptrdiff_t>(n));
+        }
+    }
+
+    // Non random access iterators run sequentially
+    ciel::list<int> l{1, 2, 3, 4, 5};
+    ASSERT_EQ(ciel::reduce(ciel::execution::par, l.begin(), l.end()), 15);
+    ASSERT_EQ(ciel::count_if(ciel::execution::par, l.begin(), l.end(), [](int x) { return x > 2; }), 3);
+    ciel::fill(ciel::execution::par_unseq, l.begin(), l.end(), 0);
+    ASSERT_EQ(ciel::reduce(ciel::execution::seq, l.begin(), l.end()), 0);
+}
+
+TEST(execution_tests, parallel_algorithms_exception) {
+    ciel::thread_pool pool(2);
+
+    ciel::vector<int> v(100000, 0);
+    v[77777] = 1;
+    ASSERT_THROW(ciel::for_each(ciel::execution::par.on(pool), v.begin(), v.end(),
+                                [](int x) {
+                                    if (x == 1) {
+                                        throw std::runtime_error("test");
+                                    }
+                                }),
+                 std::runtime_error);
+}
+
+TEST(execution_tests, scans) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    scan_test<int32_t>(g);
+    scan_test<uint32_t>(g);
+    scan_test<int64_t>(g);
+    scan_test<uint64_t>(g);
+    scan_test<int16_t>(g);
+    scan_test<double>(g);
+
+    static_assert(constexpr_scan() == 2055);
+
+    ciel::vector<int> v{1, 2, 3, 4, 5};
+    ciel::vector<int> out(5);
+    ciel::transform_inclusive_scan(v.begin(), v.end(), out.begin(), ciel::plus<>(), [](int x) { return x * x; });
+    ASSERT_EQ(out, ciel::vector<int>({1, 5, 14, 30, 55}));
+    ciel::transform_exclusive_scan(v.begin(), v.end(), out.begin(), 0, ciel::plus<>(), [](int x) { return x * x; });
+    ASSERT_EQ(out, ciel::vector<int>({0, 1, 5, 14, 30}));
+
+    ASSERT_EQ(ciel::transform_reduce(v.begin(), v.end(), v.begin(), 0), 55);
+    ASSERT_EQ(ciel::transform_reduce(v.begin(), v.end(), 1, ciel::multiplies<>(), [](int x) { return x + 1; }), 720);
+}
+
+TEST(execution_tests, parallel_scans) {
+    ciel::thread_pool pool(3);
+
+    for (const size_t grain : {size_t(0), size_t(1), size_t(7), size_t(1000)}) {
+        const auto par = ciel::execution::par.on(pool).with_grain(grain);
+
+        for (const size_t n : {size_t(0), size_t(1), size_t(13), size_t(5000), size_t(100000)}) {
+            ciel::vector<uint32_t> v(n);
+            std::iota(v.begin(), v.end(), 0);
+
+            ciel::vector<uint32_t> expected(n);
+            ciel::vector<uint32_t> out(n);
+
+            std::inclusive_scan(v.begin(), v.end(), expected.begin());
+            ASSERT_EQ(ciel::inclusive_scan(par, v.begin(), v.end(), out.begin()), out.end());
+            ASSERT_EQ(out, expected);
+
+            std::exclusive_scan(v.begin(), v.end(), expected.begin(), 3u);
+            out = v;
+            ASSERT_EQ(ciel::exclusive_scan(par, out.begin(), out.end(), out.begin(), 3u), out.end());
+            ASSERT_EQ(out, expected);
+
+            const auto square = [](uint32_t x) { return x * x; };
+            std::transform_inclusive_scan(v.begin(), v.end(), expected.begin(), std::plus<>(), square);
+            ASSERT_EQ(ciel::transform_inclusive_scan(par, v.begin(), v.end(), out.begin(), ciel::plus<>(), square),
+                      out.end());
+            ASSERT_EQ(out, expected);
+
+            std::transform_exclusive_scan(v.begin(), v.end(), expected.begin(), 1u, std::plus<>(), square);
+            ASSERT_EQ(ciel::transform_exclusive_scan(par, v.begin(), v.end(), out.begin(), 1u, ciel::plus<>(), square),
+                      out.end());
+            ASSERT_EQ(out, expected);
+
+            // Products don't wrap around, libstdc++ adds two of them before adding to init
+            ciel::vector<uint64_t> w(v.begin(), v.end());
+            ASSERT_EQ(ciel::transform_reduce(par, w.begin(), w.end(), w.begin(), uint64_t(0)),
+                      std::transform_reduce(w.begin(), w.end(), w.begin(), uint64_t(0)));
+            ASSERT_EQ(ciel::transform_reduce(par, w.begin(), w.end(), uint64_t(0), ciel::plus<>(),
+                                             [](uint64_t x) { return x * x; }),
+                      std::transform_reduce(w.begin(), w.end(), uint64_t(0), std::plus<>(),
+                                            [](uint64_t x) { return x * x; }));
+
+            // Concatenation is not commutative, the order is kept
+            ciel::vector<std::string> digits(n);
+            for (size_t i = 0; i < n; ++i) {
+                digits[i] = std::to_string(i % 10);
+            }
+            if (n <= 5000) {
+                ciel::vector<std::string> expected_strings(n);
+                ciel::vector<std::string> out_strings(n);
+                std::inclusive_scan(digits.begin(), digits.end(), expected_strings.begin());
+                ciel::inclusive_scan(par, digits.begin(), digits.end(), out_strings.begin());
+                ASSERT_EQ(out_strings, expected_strings);
+            }
+        }
+    }
+
+    // Non random access iterators run sequentially
+    ciel::list<int> l{1, 2, 3, 4, 5};
+    ciel::vector<int> out(5);
+    ciel::inclusive_scan(ciel::execution::par, l.begin(), l.end(), out.begin());
+    ASSERT_EQ(out, ciel::vector<int>({1, 3, 6, 10, 15}));
+}
\ No newline at end of file
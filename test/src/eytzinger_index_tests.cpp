@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/eytzinger_index.hpp>
+#include <ciel/functional.hpp>
+#include <ciel/list.hpp>
+#include <ciel/vector.hpp>
+#include <random>
+
+TEST(eytzinger_index_tests, default_constructor) {
+    const ciel::eytzinger_index<int> e;
+
+    ASSERT_TRUE(e.empty());
+    ASSERT_EQ(e.size(), 0);
+    ASSERT_EQ(e.lower_bound(1), nullptr);
+    ASSERT_EQ(e.upper_bound(1), nullptr);
+    ASSERT_FALSE(e.contains(1));
+}
+
+TEST(eytzinger_index_tests, initializer_list) {
+    const ciel::eytzinger_index<int> e{1, 3, 5, 7, 9, 11};
+
+    ASSERT_EQ(e.size(), 6);
+    ASSERT_EQ(*e.lower_bound(0), 1);
+    ASSERT_EQ(*e.lower_bound(1), 1);
+    ASSERT_EQ(*e.lower_bound(4), 5);
+    ASSERT_EQ(*e.upper_bound(5), 7);
+    ASSERT_EQ(*e.lower_bound(11), 11);
+    ASSERT_EQ(e.lower_bound(12), nullptr);
+    ASSERT_EQ(e.upper_bound(11), nullptr);
+
+    ASSERT_TRUE(e.contains(7));
+    ASSERT_FALSE(e.contains(8));
+}
+
+TEST(eytzinger_index_tests, search) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    for (size_t n = 0; n < 200; ++n) {
+        ciel::vector<size_t> v;
+        for (size_t i = 0; i < n; ++i) {
+            v.emplace_back(g() % (n + 1));
+        }
+        std::sort(v.begin(), v.end());
+
+        const ciel::eytzinger_index<size_t> e(v.begin(), v.end());
+        ASSERT_EQ(e.size(), n);
+
+        for (size_t key = 0; key <= n + 1; ++key) {
+            const auto lb = std::lower_bound(v.begin(), v.end(), key);
+            const auto ub = std::upper_bound(v.begin(), v.end(), key);
+
+            const size_t* p = e.lower_bound(key);
+            ASSERT_EQ(p == nullptr, lb == v.end());
+            if (p != nullptr) {
+                ASSERT_EQ(*p, *lb);
+            }
+
+            p = e.upper_bound(key);
+            ASSERT_EQ(p == nullptr, ub == v.end());
+            if (p != nullptr) {
+                ASSERT_EQ(*p, *ub);
+            }
+
+            ASSERT_EQ(e.contains(key), lb != ub);
+        }
+    }
+}
+
+TEST(eytzinger_index_tests, comparator_and_input_iterator) {
+    const ciel::list<int> l{9, 7, 5, 3, 1};
+    const ciel::eytzinger_index<int, ciel::greater<int>> e(l.begin(), l.end());
+
+    ASSERT_EQ(*e.lower_bound(6), 5);
+    ASSERT_EQ(*e.upper_bound(7), 5);
+    ASSERT_EQ(e.lower_bound(0), nullptr);
+    ASSERT_TRUE(e.contains(9));
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/flat_map.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+
+TEST(flat_map_tests, constructors_and_assignments) {
+    const ciel::flat_map<int, int> s0;
+    ASSERT_TRUE(s0.empty());
+
+    const ciel::flat_map<int, int> s1{{0, 6}, {1, 7}, {2, 3}, {3, 5}, {4, 1}, {5, 0}};
+    const ciel::flat_map<int, int> s2{{5, 0}, {3, 5}, {1, 7}, {4, 1}, {0, 6}, {2, 3}, {1, 2}};
+    ASSERT_EQ(s1, s2);
+
+    const ciel::vector<ciel::pair<int, int>> v1{{5, 0}, {1, 7}, {4, 1}, {0, 6}, {2, 3}, {3, 5}};
+    const ciel::flat_map<int, int> s3(v1.begin(), v1.end());
+    ASSERT_EQ(s1, s3);
+
+    // The first of equivalent keys wins
+    const ciel::flat_map s4(ciel::vector{3, 1, 5, 2, 0, 4, 1}, ciel::vector{5, 7, 0, 3, 6, 1, 8});
+    ASSERT_EQ(s1, s4);
+
+    const ciel::flat_map s5(ciel::sorted_unique, ciel::vector{0, 1, 2, 3, 4, 5}, ciel::vector{6, 7, 3, 5, 1, 0});
+    ASSERT_EQ(s1, s5);
+    ASSERT_EQ(s5.keys(), ciel::vector({0, 1, 2, 3, 4, 5}));
+    ASSERT_EQ(s5.values(), ciel::vector({6, 7, 3, 5, 1, 0}));
+
+    ciel::flat_map s6(s5);
+    ASSERT_EQ(s6, s5);
+
+    auto c = std::move(s6).extract();
+    ASSERT_TRUE(s6.empty());
+    ASSERT_EQ(c.keys.size(), 6);
+
+    s6.replace(std::move(c.keys), std::move(c.values));
+    ASSERT_EQ(s6, s5);
+}
+
+TEST(flat_map_tests, insert_and_delete) {
+    ciel::flat_map<int, int> s1;
+
+    s1.insert({{0, 2}, {1, 3}, {4, 0}, {3, 4}, {5, 0}, {2, 1}, {3, 5}, {4, 0}, {6, 2}, {3, 5}, {2, 1}, {0, 2}, {1, 3},
+               {3, 0}, {6, 4}, {1, 2}});
+    s1.emplace_hint(s1.end(), 7, 8);
+    s1.emplace_hint(s1.begin(), 8, 0);
+    s1.emplace(1, 2);
+    s1.emplace(10, 10);
+    s1.emplace_hint(s1.end(), 9, 3);
+    s1.insert_or_assign(6, 3);
+    s1.insert_or_assign(11, 2);
+    s1[3] = 6;
+    s1[12] = 1;
+
+    const ciel::flat_map<int, int> tmp1
+        {{0, 2}, {1, 3}, {2, 1}, {3, 6}, {4, 0}, {5, 0}, {6, 3}, {7, 8}, {8, 0}, {9, 3}, {10, 10}, {11, 2}, {12, 1}};
+    ASSERT_EQ(s1, tmp1);
+
+    s1.erase(5);
+    s1.erase(0);
+    s1.erase(8);
+
+    const ciel::flat_map<int, int> tmp2
+        {{1, 3}, {2, 1}, {3, 6}, {4, 0}, {6, 3}, {7, 8}, {9, 3}, {10, 10}, {11, 2}, {12, 1}};
+    ASSERT_EQ(s1, tmp2);
+
+    ciel::vector<ciel::pair<int, int>> v1{{8, 0}, {5, 5}};
+    s1.insert(v1.begin(), v1.end());
+    s1.try_emplace(13, 1);
+    s1.try_emplace(11, 11);
+    s1.insert(ciel::sorted_unique, {{14, 4}, {15, 5}});
+
+    const ciel::flat_map<int, int> tmp3{{1, 3}, {2, 1}, {3, 6}, {4, 0}, {5, 5}, {6, 3}, {7, 8}, {8, 0}, {9, 3},
+                                        {10, 10}, {11, 2}, {12, 1}, {13, 1}, {14, 4}, {15, 5}};
+    ASSERT_EQ(s1, tmp3);
+
+    ASSERT_EQ(ciel::erase_if(s1, [](const auto& p) {
+        return p.first % 2 == 0;
+    }), 7);
+    ASSERT_EQ(s1.keys(), ciel::vector({1, 3, 5, 7, 9, 11, 13, 15}));
+
+    s1.clear();
+    ASSERT_TRUE(s1.empty());
+}
+
+TEST(flat_map_tests, find_and_iterate) {
+    ciel::flat_map<int, int>
+        s1 = {{3, 1}, {0, 4}, {5, 7}, {0, 3}, {1, 2}, {4, 0}, {1, 0}, {3, 8}, {4, 6}, {9, 5}, {2, 9}, {4, 1}};
+
+    ASSERT_EQ(s1.find(3)->second, 1);
+    ASSERT_TRUE(s1.contains(9));
+    ASSERT_EQ(s1.count(0), 1);
+    ASSERT_EQ(s1.lower_bound(4)->second, 0);
+    ASSERT_EQ(s1.upper_bound(7)->second, 5);
+    ASSERT_EQ(s1[5], 7);
+    ASSERT_EQ(s1.at(2), 9);
+    ASSERT_EQ(s1.begin()->second, 4);
+    ASSERT_EQ(s1.find(6), s1.end());
+
+    s1.find(9)->second = 10;
+    ASSERT_EQ(s1.at(9), 10);
+
+    int prev = -1;
+    for (auto [key, value] : s1) {
+        ASSERT_LT(prev, key);
+        prev = key;
+        value = key;
+    }
+    for (auto it = s1.rbegin(); it != s1.rend(); ++it) {
+        ASSERT_EQ(it->first, it->second);
+    }
+    ASSERT_EQ(s1.end() - s1.begin(), 7);
+}
+
+TEST(flat_map_tests, bulk_insert) {
+    std::mt19937_64 g(std::random_device{}());
+    ciel::flat_map<std::string, size_t> s;
+    std::map<std::string, size_t> expected;
+
+    for (size_t loop = 0; loop < 50; ++loop) {
+        ciel::vector<ciel::pair<std::string, size_t>> v(g() % 200);
+        for (size_t i = 0; i < v.size(); ++i) {
+            v[i] = {std::to_string(g() % 2000), loop * 1000 + i};
+        }
+        if (loop % 2 == 0) {
+            s.insert(v.begin(), v.end());
+
+        } else {
+            for (const auto& p : v) {
+                s.insert(p);
+            }
+        }
+        for (const auto& p : v) {
+            expected.insert({p.first, p.second});
+        }
+
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end(),
+                               [](const auto& lhs, const auto& rhs) {
+            return lhs.first == rhs.first && lhs.second == rhs.second;
+        }));
+    }
+}
\ No newline at end of file
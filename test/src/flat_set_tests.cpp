@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/flat_set.hpp>
+#include <ciel/vector.hpp>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <string>
+
+TEST(flat_set_tests, constructors_and_assignments) {
+    const ciel::flat_set<int> s0;
+    ASSERT_TRUE(s0.empty());
+
+    const ciel::flat_set s1{0, 1, 2, 3, 4, 5};
+    const ciel::flat_set s2{5, 3, 1, 4, 0, 2, 3, 3, 0};
+    ASSERT_EQ(s1, s2);
+
+    const ciel::vector v1{5, 1, 4, 0, 2, 3, 1, 4};
+    const ciel::flat_set s3(v1.begin(), v1.end());
+    ASSERT_EQ(s1, s3);
+
+    const ciel::flat_set s4(v1);
+    ASSERT_EQ(s1, s4);
+
+    const ciel::flat_set s5(ciel::sorted_unique, ciel::vector{0, 1, 2, 3, 4, 5});
+    ASSERT_EQ(s1, s5);
+
+    ciel::flat_set s6(s5);
+    ASSERT_EQ(s6, s5);
+
+    ciel::flat_set s7(std::move(s6));
+    ASSERT_EQ(s7, s5);
+
+    s7 = {9, 8, 9};
+    ASSERT_EQ(s7, ciel::flat_set({8, 9}));
+
+    auto c = std::move(s7).extract();
+    ASSERT_EQ(c, ciel::vector({8, 9}));
+    ASSERT_TRUE(s7.empty());
+
+    c.emplace_back(10);
+    s7.replace(std::move(c));
+    ASSERT_EQ(s7, ciel::flat_set({8, 9, 10}));
+}
+
+TEST(flat_set_tests, insert_and_delete) {
+    ciel::flat_set<int> s1;
+
+    s1.insert({0, 1, 4, 3, 5, 2, 3, 4, 6, 3, 2, 0, 1, 3, 6, 1});
+    s1.emplace_hint(s1.end(), 7);
+    s1.emplace_hint(s1.begin(), 8);
+    ASSERT_TRUE(s1.emplace(10).second);
+    ASSERT_FALSE(s1.emplace(1).second);
+    s1.insert(s1.end(), 9);
+
+    ASSERT_EQ(s1, ciel::flat_set({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10}));
+
+    ASSERT_EQ(s1.erase(5), 1);
+    ASSERT_EQ(s1.erase(5), 0);
+    s1.erase(s1.begin());
+    s1.erase(s1.find(8), s1.find(10));
+
+    ASSERT_EQ(s1, ciel::flat_set({1, 2, 3, 4, 6, 7, 10}));
+
+    s1.insert(ciel::sorted_unique, {11, 12});
+    s1.insert(ciel::sorted_unique, {0, 5, 11});
+    ASSERT_EQ(s1, ciel::flat_set({0, 1, 2, 3, 4, 5, 6, 7, 10, 11, 12}));
+
+    ASSERT_EQ(ciel::erase_if(s1, [](const int i) {
+        return i % 2 == 0;
+    }), 6);
+    ASSERT_EQ(s1, ciel::flat_set({1, 3, 5, 7, 11}));
+
+    s1.clear();
+    ASSERT_TRUE(s1.empty());
+}
+
+TEST(flat_set_tests, find) {
+    const ciel::flat_set s1{3, 1, 0, 4, 5, 7, 0, 3, 1, 2, 4, 0, 1, 0, 3, 8, 4, 6, 5, 3, 4, 7, 0, 3, 1, 4, 0, 7, 4, 1, 9,
+                            5, 9, 1, 5, 1, 2, 9, 4, 1, 4};
+    ASSERT_EQ(s1.size(), 10);
+    ASSERT_EQ(*s1.find(3), 3);
+    ASSERT_EQ(s1.find(11), s1.end());
+    ASSERT_TRUE(s1.contains(9));
+    ASSERT_EQ(s1.count(0), 1);
+    ASSERT_EQ(*s1.lower_bound(4), 4);
+    ASSERT_EQ(*s1.upper_bound(7), 8);
+
+    const auto er = s1.equal_range(5);
+    ASSERT_EQ(er.second - er.first, 1);
+}
+
+TEST(flat_set_tests, bulk_insert) {
+    std::mt19937_64 g(std::random_device{}());
+    ciel::flat_set<std::string> s;
+    std::set<std::string> expected;
+
+    for (size_t loop = 0; loop < 50; ++loop) {
+        ciel::vector<std::string> v(g() % 200);
+        for (std::string& str : v) {
+            str = std::to_string(g() % 2000);
+        }
+        if (loop % 2 == 0) {
+            s.insert(v.begin(), v.end());
+
+        } else {
+            for (const std::string& str : v) {
+                s.insert(str);
+            }
+        }
+        expected.insert(v.begin(), v.end());
+
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+    }
+}
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ciel/forward_list.hpp>
+#include <ciel/iterator.hpp>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
 
 TEST(forward_list_tests, constructors_and_destructors) {
     ciel::forward_list<int> l1;
@@ -145,4 +151,60 @@ TEST(forward_list_tests, swap) {
     std::swap(l1, l2);
     ASSERT_EQ(l1, ciel::forward_list({6, 7, 8, 9, 6, 4, 3}));
     ASSERT_EQ(l2, ciel::forward_list({4, 3, 2, 1}));
+}
+
+TEST(forward_list_tests, sort) {
+    std::mt19937 g(7);
+    for (const int n : {0, 1, 2, 3, 17, 1000, 4097}) {
+        // second is the original position, to check stability
+        ciel::forward_list<std::pair<int, int>> l;
+        std::vector<std::pair<int, int>> expected;
+        for (int i = n - 1; i >= 0; --i) {
+            l.emplace_front(static_cast<int>(g() % 50), i);
+            expected.emplace_back(l.front());
+        }
+        std::reverse(expected.begin(), expected.end());
+
+        const auto by_first = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+        l.sort(by_first);
+        std::stable_sort(expected.begin(), expected.end(), by_first);
+
+        ASSERT_TRUE(std::equal(l.begin(), l.end(), expected.begin(), expected.end()));
+    }
+
+    ciel::forward_list<int> l{5, 3, 1, 4, 2};
+    l.sort(std::greater<>());
+    ASSERT_EQ(l, ciel::forward_list<int>({5, 4, 3, 2, 1}));
+}
+
+TEST(forward_list_tests, merge) {
+    ciel::forward_list<std::pair<int, int>> l1{{1, 0}, {3, 0}, {3, 1}, {7, 0}};
+    ciel::forward_list<std::pair<int, int>> l2{{0, 2}, {3, 2}, {8, 2}};
+
+    l1.merge(l2, [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1, (ciel::forward_list<std::pair<int, int>>({{0, 2}, {1, 0}, {3, 0}, {3, 1}, {3, 2}, {7, 0}, {8, 2}})));
+
+    ciel::forward_list<int> l3{1, 4};
+    l3.merge(ciel::forward_list<int>{2, 3, 5});
+    ASSERT_EQ(l3, ciel::forward_list<int>({1, 2, 3, 4, 5}));
+}
+
+TEST(forward_list_tests, unique_reverse_remove) {
+    ciel::forward_list<int> l{1, 1, 2, 3, 3, 3, 1, 4, 4};
+    ASSERT_EQ(l.unique(), 4);
+    ASSERT_EQ(l, ciel::forward_list<int>({1, 2, 3, 1, 4}));
+
+    l.reverse();
+    ASSERT_EQ(l, ciel::forward_list<int>({4, 1, 3, 2, 1}));
+
+    // the argument refers to an element being removed
+    ASSERT_EQ(l.remove(*ciel::next(l.begin())), 2);
+    ASSERT_EQ(l, ciel::forward_list<int>({4, 3, 2}));
+
+    ASSERT_EQ(ciel::erase_if(l, [](const int i) { return i % 2 == 0; }), 2);
+    ASSERT_EQ(l, ciel::forward_list<int>({3}));
+
+    l.reverse();
+    ASSERT_EQ(l, ciel::forward_list<int>({3}));
 }
\ No newline at end of file
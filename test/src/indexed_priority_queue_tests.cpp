@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/functional.hpp>
+#include <ciel/indexed_priority_queue.hpp>
+#include <ciel/vector.hpp>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+TEST(indexed_priority_queue_tests, push_pop) {
+    ciel::indexed_priority_queue<int> pq;
+    ASSERT_TRUE(pq.empty());
+    ASSERT_EQ(pq.size(), 0);
+
+    const size_t h1 = pq.push(1);
+    const size_t h5 = pq.push(5);
+    const size_t h3 = pq.emplace(3);
+    ASSERT_EQ(pq.size(), 3);
+    ASSERT_EQ(pq.top(), 5);
+    ASSERT_EQ(pq.top_handle(), h5);
+    ASSERT_EQ(pq[h1], 1);
+    ASSERT_EQ(pq[h3], 3);
+
+    pq.pop();
+    ASSERT_FALSE(pq.contains(h5));
+    ASSERT_TRUE(pq.contains(h1));
+    ASSERT_EQ(pq.top(), 3);
+
+    // Handles are reused
+    ASSERT_EQ(pq.push(0), h5);
+    ASSERT_EQ(pq.size(), 3);
+
+    pq.clear();
+    ASSERT_TRUE(pq.empty());
+    ASSERT_FALSE(pq.contains(h1));
+}
+
+TEST(indexed_priority_queue_tests, change_keys) {
+    ciel::indexed_priority_queue<int, ciel::greater<int>> pq;
+
+    ciel::vector<size_t> handles;
+    for (int i = 0; i < 10; ++i) {
+        handles.emplace_back(pq.push(i * 10));
+    }
+    ASSERT_EQ(pq.top(), 0);
+
+    // With greater, a smaller value is closer to the top
+    pq.increase_key(handles[9], -1);
+    ASSERT_EQ(pq.top(), -1);
+    ASSERT_EQ(pq.top_handle(), handles[9]);
+
+    pq.decrease_key(handles[9], 1000);
+    ASSERT_EQ(pq.top(), 0);
+    ASSERT_EQ(pq[handles[9]], 1000);
+
+    pq.update(handles[5], -5);
+    ASSERT_EQ(pq.top_handle(), handles[5]);
+
+    pq.erase(handles[5]);
+    pq.erase(handles[3]);
+    ASSERT_EQ(pq.size(), 8);
+
+    ciel::vector<int> popped;
+    while (!pq.empty()) {
+        popped.emplace_back(pq.top());
+        pq.pop();
+    }
+    ASSERT_EQ(popped, ciel::vector<int>({0, 10, 20, 40, 60, 70, 80, 1000}));
+}
+
+TEST(indexed_priority_queue_tests, random_operations) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::indexed_priority_queue<size_t, ciel::less<size_t>, 3> pq;
+    ciel::vector<size_t> live;    // handles in pq
+    ciel::vector<size_t> values;  // values[handle]
+
+    for (size_t i = 0; i < 20000; ++i) {
+        switch (g() % 5) {
+            case 0:
+            case 1: {
+                const size_t value = g() % 1000;
+                const size_t h = pq.push(value);
+                values.resize(std::max(values.size(), h + 1));
+                values[h] = value;
+                live.emplace_back(h);
+                break;
+            }
+            case 2:
+                if (!live.empty()) {
+                    const size_t h = live[g() % live.size()];
+                    values[h] = g() % 1000;
+                    pq.update(h, values[h]);
+                }
+                break;
+            case 3:
+                if (!live.empty()) {
+                    const size_t idx = g() % live.size();
+                    pq.erase(live[idx]);
+                    live.erase(live.begin() + idx);
+                }
+                break;
+            default:
+                if (!live.empty()) {
+                    const size_t h = pq.top_handle();
+                    pq.pop();
+                    live.erase(std::find(live.begin(), live.end(), h));
+                }
+        }
+
+        ASSERT_EQ(pq.size(), live.size());
+        if (!live.empty()) {
+            const size_t max = values[*std::max_element(live.begin(), live.end(), [&](size_t l, size_t r) {
+                return values[l] < values[r];
+            })];
+            ASSERT_EQ(pq.top(), max);
+            ASSERT_EQ(values[pq.top_handle()], max);
+        }
+    }
+
+    for (const size_t h : live) {
+        ASSERT_TRUE(pq.contains(h));
+        ASSERT_EQ(pq[h], values[h]);
+    }
+}
+
+TEST(indexed_priority_queue_tests, non_trivial) {
+    ciel::indexed_priority_queue<std::string> pq;
+
+    const size_t a = pq.push("a");
+    pq.push("c");
+    pq.emplace(3, 'b');
+    ASSERT_EQ(pq.top(), "c");
+
+    pq.increase_key(a, std::string("d"));
+    ASSERT_EQ(pq.top(), "d");
+
+    pq.pop();
+    ASSERT_EQ(pq.top(), "c");
+    pq.pop();
+    ASSERT_EQ(pq.top(), "bbb");
+}
+
+#ifdef CIEL_HAS_EXCEPTIONS
+namespace {
+
+struct throw_on_negative {
+    int value;
+
+    explicit throw_on_negative(const int v)
+        : value(v) {
+        if (v < 0) {
+            throw std::runtime_error("negative");
+        }
+    }
+
+    friend auto operator<(const throw_on_negative& lhs, const throw_on_negative& rhs) noexcept -> bool {
+        return lhs.value < rhs.value;
+    }
+};
+
+}   // namespace
+
+TEST(indexed_priority_queue_tests, emplace_throws) {
+    ciel::indexed_priority_queue<throw_on_negative> pq;
+    pq.emplace(1);
+    const size_t h2 = pq.emplace(2);
+    pq.emplace(3);
+    pq.erase(h2);
+
+    // Neither the freed handle nor a new one is lost
+    ASSERT_THROW(pq.emplace(-1), std::runtime_error);
+    ASSERT_EQ(pq.size(), 2);
+    ASSERT_EQ(pq.emplace(4), h2);
+
+    ASSERT_THROW(pq.emplace(-1), std::runtime_error);
+    ASSERT_EQ(pq.emplace(5), 3);
+    ASSERT_EQ(pq.top().value, 5);
+    ASSERT_EQ(pq.size(), 4);
+}
+#endif
\ No newline at end of file
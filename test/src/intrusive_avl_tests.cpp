@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include <ciel/intrusive_avl.hpp>
+#include <ciel/intrusive_list.hpp>
+#include <ciel/vector.hpp>
+#include <random>
+#include <set>
+
+namespace {
+
+struct timer {
+    int deadline;
+    int id;
+    ciel::avl_hook timeout_hook;
+    ciel::list_node_base lru_hook;
+
+    timer(const int d, const int i) noexcept
+        : deadline(d), id(i) {}
+};
+
+struct by_deadline {
+    using is_transparent = void;
+
+    [[nodiscard]] auto operator()(const timer& lhs, const timer& rhs) const noexcept -> bool {
+        return lhs.deadline < rhs.deadline;
+    }
+
+    [[nodiscard]] auto operator()(const timer& lhs, const int rhs) const noexcept -> bool {
+        return lhs.deadline < rhs;
+    }
+
+    [[nodiscard]] auto operator()(const int lhs, const timer& rhs) const noexcept -> bool {
+        return lhs < rhs.deadline;
+    }
+};
+
+using timer_tree = ciel::intrusive_avl<timer, &timer::timeout_hook, by_deadline>;
+
+// Checks links, heights and balance of every node, returns the height of the subtree.
+auto check_subtree(const ciel::avl_node_base* node, const ciel::avl_node_base* parent) -> int {
+    if (node == nullptr) {
+        return 0;
+    }
+    const auto* hook = static_cast<const ciel::avl_hook*>(node);
+    EXPECT_EQ(hook->parent_, parent);
+
+    const int l = check_subtree(hook->left_, hook);
+    const int r = check_subtree(hook->right_, hook);
+    EXPECT_LE(std::abs(l - r), 1);
+    EXPECT_EQ(hook->height_, 1 + std::max(l, r));
+    return hook->height_;
+}
+
+auto check_tree(const timer_tree& t) -> void {
+    const ciel::avl_node_base* end = t.end().base();
+    check_subtree(end->left_, end);
+}
+
+}   // namespace
+
+TEST(intrusive_avl_tests, insert_multi_and_erase) {
+    constexpr int n = 2000;
+
+    ciel::vector<timer> timers;
+    timers.reserve(n);
+    std::mt19937 g(42);
+    for (int i = 0; i < n; ++i) {
+        timers.emplace_back(static_cast<int>(g() % 300), i);
+    }
+
+    timer_tree t;
+    std::multiset<int> expected;
+    for (timer& x : timers) {
+        t.insert_multi(x);
+        expected.insert(x.deadline);
+    }
+    check_tree(t);
+    ASSERT_EQ(t.size(), expected.size());
+    ASSERT_TRUE(std::equal(t.begin(), t.end(), expected.begin(), expected.end(),
+                           [](const timer& lhs, const int rhs) { return lhs.deadline == rhs; }));
+
+    // equal deadlines keep insertion order
+    for (auto it = t.begin(); it.next() != t.end(); ++it) {
+        if (it->deadline == it.next()->deadline) {
+            ASSERT_LT(it->id, it.next()->id);
+        }
+    }
+
+    for (int i = 0; i < n; i += 2) {
+        t.erase(timers[i]);
+        expected.erase(expected.find(timers[i].deadline));
+        ASSERT_FALSE(timers[i].timeout_hook.is_linked());
+    }
+    check_tree(t);
+    ASSERT_TRUE(std::equal(t.begin(), t.end(), expected.begin(), expected.end(),
+                           [](const timer& lhs, const int rhs) { return lhs.deadline == rhs; }));
+    ASSERT_TRUE(std::equal(t.rbegin(), t.rend(), expected.rbegin(), expected.rend(),
+                           [](const timer& lhs, const int rhs) { return lhs.deadline == rhs; }));
+
+    for (int d = -1; d < 301; ++d) {
+        ASSERT_EQ(t.count(d), expected.count(d));
+        ASSERT_EQ(t.contains(d), expected.contains(d));
+
+        const auto lb = t.lower_bound(d);
+        ASSERT_EQ(lb == t.end(), expected.lower_bound(d) == expected.end());
+        if (lb != t.end()) {
+            ASSERT_EQ(lb->deadline, *expected.lower_bound(d));
+        }
+    }
+
+    // fire everything due before 150
+    t.erase(t.begin(), t.lower_bound(150));
+    check_tree(t);
+    ASSERT_EQ(t.size(), static_cast<size_t>(std::distance(expected.lower_bound(150), expected.end())));
+    ASSERT_EQ(t.begin()->deadline, *expected.lower_bound(150));
+
+    t.clear();
+    ASSERT_TRUE(t.empty());
+    for (const timer& x : timers) {
+        ASSERT_FALSE(x.timeout_hook.is_linked());
+    }
+}
+
+TEST(intrusive_avl_tests, insert_unique) {
+    ciel::vector<timer> timers;
+    timers.reserve(10);
+    for (int i = 0; i < 10; ++i) {
+        timers.emplace_back(i % 5, i);
+    }
+
+    timer_tree t;
+    for (int i = 0; i < 10; ++i) {
+        const auto res = t.insert_unique(timers[i]);
+        ASSERT_EQ(res.second, i < 5);
+        ASSERT_EQ(res.first->id, i % 5);
+    }
+    check_tree(t);
+    ASSERT_EQ(t.size(), 5);
+    ASSERT_EQ(timer_tree::iterator_to(timers[3]), t.find(3));
+    ASSERT_EQ(t.find(7), t.end());
+
+    timer_tree t2(std::move(t));
+    ASSERT_TRUE(t.empty());
+    ASSERT_EQ(t2.size(), 5);
+    check_tree(t2);
+
+    t.swap(t2);
+    ASSERT_TRUE(t2.empty());
+    ASSERT_EQ(t.begin()->id, 0);
+    ASSERT_EQ((--t.end())->id, 4);
+    check_tree(t);
+}
+
+TEST(intrusive_avl_tests, tree_and_list_at_once) {
+    ciel::vector<timer> timers;
+    timers.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        timers.emplace_back((i * 37) % 100, i);
+    }
+
+    timer_tree t;
+    ciel::intrusive_list<timer, &timer::lru_hook> lru;
+    for (timer& x : timers) {
+        t.insert_multi(x);
+        lru.push_front(x);
+    }
+
+    // expire the earliest half, each timer leaves both containers
+    while (t.size() > 50) {
+        timer& x = *t.begin();
+        t.erase(x);
+        lru.erase(x);
+    }
+    check_tree(t);
+    ASSERT_EQ(lru.size(), 50);
+    for (const timer& x : lru) {
+        ASSERT_GE(x.deadline, 50);
+        ASSERT_TRUE(x.timeout_hook.is_linked());
+    }
+}
\ No newline at end of file
@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <ciel/intrusive_list.hpp>
+#include <ciel/vector.hpp>
+
+namespace {
+
+struct connection {
+    int id;
+    ciel::list_node_base lru_hook;
+    ciel::list_node_base idle_hook;
+
+    explicit connection(const int i) noexcept
+        : id(i) {}
+
+    auto operator==(const connection& other) const noexcept -> bool {
+        return id == other.id;
+    }
+};
+
+using lru_list  = ciel::intrusive_list<connection, &connection::lru_hook>;
+using idle_list = ciel::intrusive_list<connection, &connection::idle_hook>;
+
+template<class List>
+[[nodiscard]] auto ids(const List& l) -> ciel::vector<int> {
+    ciel::vector<int> res;
+    for (const connection& c : l) {
+        res.push_back(c.id);
+    }
+    return res;
+}
+
+}   // namespace
+
+TEST(intrusive_list_tests, insert_and_erase) {
+    ciel::vector<connection> conns;
+    conns.reserve(5);
+    for (int i = 0; i < 5; ++i) {
+        conns.emplace_back(i);
+    }
+
+    lru_list l;
+    ASSERT_TRUE(l.empty());
+    ASSERT_EQ(l.begin(), l.end());
+
+    for (connection& c : conns) {
+        l.push_back(c);
+    }
+    ASSERT_EQ(l.size(), 5);
+    ASSERT_EQ(ids(l), ciel::vector<int>({0, 1, 2, 3, 4}));
+    ASSERT_EQ(&l.front(), &conns[0]);
+    ASSERT_EQ(&l.back(), &conns[4]);
+    ASSERT_TRUE(conns[2].lru_hook.is_linked());
+    ASSERT_FALSE(conns[2].idle_hook.is_linked());
+
+    l.erase(conns[2]);
+    ASSERT_FALSE(conns[2].lru_hook.is_linked());
+    ASSERT_EQ(ids(l), ciel::vector<int>({0, 1, 3, 4}));
+
+    l.insert(lru_list::iterator_to(conns[3]), conns[2]);
+    l.pop_front();
+    l.pop_back();
+    ASSERT_EQ(ids(l), ciel::vector<int>({1, 2, 3}));
+
+    l.push_front(conns[4]);
+    ASSERT_EQ(ids(l), ciel::vector<int>({4, 1, 2, 3}));
+    ASSERT_EQ(*l.rbegin(), conns[3]);
+
+    ASSERT_EQ(l.erase(l.begin().next(), l.end().prev()), l.end().prev());
+    ASSERT_EQ(ids(l), ciel::vector<int>({4, 3}));
+
+    l.clear();
+    ASSERT_TRUE(l.empty());
+    for (const connection& c : conns) {
+        ASSERT_FALSE(c.lru_hook.is_linked());
+    }
+}
+
+TEST(intrusive_list_tests, several_lists) {
+    ciel::vector<connection> conns;
+    conns.reserve(6);
+    for (int i = 0; i < 6; ++i) {
+        conns.emplace_back(i);
+    }
+
+    lru_list lru;
+    idle_list idle;
+    for (connection& c : conns) {
+        lru.push_front(c);
+        if (c.id % 2 == 0) {
+            idle.push_back(c);
+        }
+    }
+    ASSERT_EQ(ids(lru), ciel::vector<int>({5, 4, 3, 2, 1, 0}));
+    ASSERT_EQ(ids(idle), ciel::vector<int>({0, 2, 4}));
+
+    // touch 1, it moves to the front of lru only
+    lru.splice(lru.begin(), lru, lru_list::iterator_to(conns[1]));
+    ASSERT_EQ(ids(lru), ciel::vector<int>({1, 5, 4, 3, 2, 0}));
+    ASSERT_EQ(lru.size(), 6);
+
+    // close 2, it leaves both lists
+    lru.erase(conns[2]);
+    idle.erase(conns[2]);
+    ASSERT_EQ(ids(lru), ciel::vector<int>({1, 5, 4, 3, 0}));
+    ASSERT_EQ(ids(idle), ciel::vector<int>({0, 4}));
+}
+
+TEST(intrusive_list_tests, splice_move_and_swap) {
+    ciel::vector<connection> conns;
+    conns.reserve(6);
+    for (int i = 0; i < 6; ++i) {
+        conns.emplace_back(i);
+    }
+
+    lru_list l1;
+    lru_list l2;
+    for (int i = 0; i < 3; ++i) {
+        l1.push_back(conns[i]);
+        l2.push_back(conns[i + 3]);
+    }
+
+    l1.splice(l1.end(), l2, l2.begin(), l2.end().prev());
+    ASSERT_EQ(ids(l1), ciel::vector<int>({0, 1, 2, 3, 4}));
+    ASSERT_EQ(ids(l2), ciel::vector<int>({5}));
+    ASSERT_EQ(l1.size(), 5);
+    ASSERT_EQ(l2.size(), 1);
+
+    l1.swap(l2);
+    ASSERT_EQ(ids(l1), ciel::vector<int>({5}));
+    ASSERT_EQ(ids(l2), ciel::vector<int>({0, 1, 2, 3, 4}));
+
+    l1.splice(l1.begin(), l2);
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(ids(l1), ciel::vector<int>({0, 1, 2, 3, 4, 5}));
+
+    lru_list l3(std::move(l1));
+    ASSERT_TRUE(l1.empty());
+    ASSERT_EQ(ids(l3), ciel::vector<int>({0, 1, 2, 3, 4, 5}));
+    ASSERT_EQ(*--l3.end(), conns[5]);
+
+    // moving from an empty list
+    lru_list l4(std::move(l1));
+    ASSERT_TRUE(l4.empty());
+
+    l3.erase(conns[0]);
+    l4.push_back(conns[0]);
+    ASSERT_EQ(ids(l4), ciel::vector<int>({0}));
+
+    l3 = std::move(l4);
+    ASSERT_TRUE(l4.empty());
+    ASSERT_EQ(ids(l3), ciel::vector<int>({0}));
+    for (int i = 1; i < 6; ++i) {
+        ASSERT_FALSE(conns[i].lru_hook.is_linked());
+    }
+}
\ No newline at end of file
@@ -1,6 +1,13 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <ciel/iterator.hpp>
 #include <ciel/list.hpp>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 TEST(list_tests, constructors_and_destructors) {
     ciel::list<int> l1;
@@ -156,4 +163,140 @@ TEST(list_tests, swap) {
     std::swap(l1, l2);
     ASSERT_EQ(l1, ciel::list({6, 7, 8, 9, 6, 4, 3}));
     ASSERT_EQ(l2, ciel::list({4, 3, 2, 1}));
+}
+
+TEST(list_tests, splice) {
+    ciel::list<int> l1{1, 2, 3};
+    ciel::list<int> l2{4, 5, 6};
+    const int* address = &l2.front();
+
+    l1.splice(l1.end(), l2);
+    ASSERT_EQ(l1, ciel::list<int>({1, 2, 3, 4, 5, 6}));
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(&*ciel::next(l1.begin(), 3), address);
+
+    l2.splice(l2.begin(), l1, l1.begin());
+    ASSERT_EQ(l1, ciel::list<int>({2, 3, 4, 5, 6}));
+    ASSERT_EQ(l2, ciel::list<int>({1}));
+
+    l2.splice(l2.end(), l1, ciel::next(l1.begin()), ciel::prev(l1.end()));
+    ASSERT_EQ(l1, ciel::list<int>({2, 6}));
+    ASSERT_EQ(l2, ciel::list<int>({1, 3, 4, 5}));
+    ASSERT_EQ(l1.size(), 2);
+    ASSERT_EQ(l2.size(), 4);
+
+    // within the same list
+    l2.splice(l2.begin(), l2, ciel::prev(l2.end()));
+    ASSERT_EQ(l2, ciel::list<int>({5, 1, 3, 4}));
+    l2.splice(l2.end(), l2, l2.begin(), ciel::next(l2.begin(), 2));
+    ASSERT_EQ(l2, ciel::list<int>({3, 4, 5, 1}));
+    l2.splice(l2.begin(), l2, l2.begin());
+    ASSERT_EQ(l2, ciel::list<int>({3, 4, 5, 1}));
+    ASSERT_EQ(l2.size(), 4);
+
+    l1.splice(l1.begin(), ciel::list<int>{7, 8});
+    ASSERT_EQ(l1, ciel::list<int>({7, 8, 2, 6}));
+}
+
+TEST(list_tests, sort) {
+    std::mt19937 g(7);
+    for (const int n : {0, 1, 2, 3, 17, 1000, 4097}) {
+        // second is the original position, to check stability
+        ciel::list<std::pair<int, int>> l;
+        std::vector<std::pair<int, int>> expected;
+        for (int i = 0; i < n; ++i) {
+            l.emplace_back(static_cast<int>(g() % 50), i);
+            expected.emplace_back(l.back());
+        }
+
+        const auto by_first = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+        l.sort(by_first);
+        std::stable_sort(expected.begin(), expected.end(), by_first);
+
+        ASSERT_EQ(l.size(), static_cast<size_t>(n));
+        ASSERT_TRUE(std::equal(l.begin(), l.end(), expected.begin(), expected.end()));
+        ASSERT_TRUE(std::equal(l.rbegin(), l.rend(), expected.rbegin(), expected.rend()));
+    }
+
+    ciel::list<int> l{5, 3, 1, 4, 2};
+    l.sort();
+    ASSERT_EQ(l, ciel::list<int>({1, 2, 3, 4, 5}));
+    l.sort(std::greater<>());
+    ASSERT_EQ(l, ciel::list<int>({5, 4, 3, 2, 1}));
+}
+
+TEST(list_tests, sort_throwing_comparison) {
+    ciel::list<int> l;
+    for (int i = 0; i < 1000; ++i) {
+        l.push_back((i * 37) % 1000);
+    }
+
+    size_t comparisons = 0;
+    ASSERT_THROW(l.sort([&](const int lhs, const int rhs) {
+        if (++comparisons == 3000) {
+            throw std::runtime_error("comparison");
+        }
+        return lhs < rhs;
+    }), std::runtime_error);
+
+    // every element is still there, and prev_ links are consistent
+    ASSERT_EQ(l.size(), 1000);
+    std::vector<int> v(l.begin(), l.end());
+    ASSERT_TRUE(std::equal(l.rbegin(), l.rend(), v.rbegin(), v.rend()));
+    std::sort(v.begin(), v.end());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(v[i], i);
+    }
+}
+
+TEST(list_tests, merge) {
+    ciel::list<std::pair<int, int>> l1{{1, 0}, {3, 0}, {3, 1}, {7, 0}};
+    ciel::list<std::pair<int, int>> l2{{0, 2}, {3, 2}, {8, 2}};
+    const auto* address = &l2.front();
+
+    l1.merge(l2, [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    ASSERT_TRUE(l2.empty());
+    ASSERT_EQ(l1.size(), 7);
+    ASSERT_EQ(l1, (ciel::list<std::pair<int, int>>({{0, 2}, {1, 0}, {3, 0}, {3, 1}, {3, 2}, {7, 0}, {8, 2}})));
+    ASSERT_EQ(&l1.front(), address);
+
+    ciel::list<int> l3{1, 4};
+    l3.merge(ciel::list<int>{2, 3, 5});
+    ASSERT_EQ(l3, ciel::list<int>({1, 2, 3, 4, 5}));
+    l3.merge(l3);
+    ASSERT_EQ(l3.size(), 5);
+
+    ciel::list<int> l4;
+    l4.merge(l3);
+    ASSERT_EQ(l4, ciel::list<int>({1, 2, 3, 4, 5}));
+    ASSERT_TRUE(l3.empty());
+}
+
+TEST(list_tests, unique_reverse_remove) {
+    ciel::list<int> l{1, 1, 2, 3, 3, 3, 1, 4, 4};
+    ASSERT_EQ(l.unique(), 4);
+    ASSERT_EQ(l, ciel::list<int>({1, 2, 3, 1, 4}));
+    ASSERT_EQ(l.size(), 5);
+
+    // groups are compared with their first element
+    ciel::list<int> l2{1, 2, 3, 4, 10, 11};
+    ASSERT_EQ(l2.unique([](const int lhs, const int rhs) { return rhs - lhs < 3; }), 3);
+    ASSERT_EQ(l2, ciel::list<int>({1, 4, 10}));
+
+    l.reverse();
+    ASSERT_EQ(l, ciel::list<int>({4, 1, 3, 2, 1}));
+    ASSERT_EQ(*l.rbegin(), 1);
+    ASSERT_EQ(*ciel::prev(l.end(), 2), 2);
+
+    // the argument refers to an element being removed
+    ASSERT_EQ(l.remove(l.back()), 2);
+    ASSERT_EQ(l, ciel::list<int>({4, 3, 2}));
+
+    ASSERT_EQ(l.remove_if([](const int i) { return i % 2 == 0; }), 2);
+    ASSERT_EQ(l, ciel::list<int>({3}));
+
+    ASSERT_EQ(ciel::erase(l, 3), 1);
+    ASSERT_TRUE(l.empty());
+    l.reverse();
+    ASSERT_TRUE(l.empty());
 }
\ No newline at end of file
@@ -128,4 +128,78 @@ TEST(map_tests, find) {
 
     const auto er = s1.equal_range(5);
     ASSERT_EQ(ciel::distance(er.first, er.second), 1);
+}
+
+TEST(map_tests, set_algebra) {
+    ciel::map<int, int> m1{{1, 1}, {3, 3}, {5, 5}, {7, 7}, {9, 9}};
+    const ciel::map<int, int> m2{{0, 0}, {3, 30}, {4, 40}, {9, 90}};
+
+    ciel::map<int, int> u(m1);
+    u.unite(m2);
+    const ciel::map<int, int> u_expected{{0, 0}, {1, 1}, {3, 3}, {4, 40}, {5, 5}, {7, 7}, {9, 9}};
+    ASSERT_EQ(u, u_expected);
+
+    ciel::map<int, int> i(m1);
+    i.intersect(m2);
+    const ciel::map<int, int> i_expected{{3, 3}, {9, 9}};
+    ASSERT_EQ(i, i_expected);
+
+    m1.subtract(m2);
+    const ciel::map<int, int> d_expected{{1, 1}, {5, 5}, {7, 7}};
+    ASSERT_EQ(m1, d_expected);
+
+    m1.unite(ciel::map<int, int>{{5, 50}, {6, 60}});
+    const ciel::map<int, int> m_expected{{1, 1}, {5, 5}, {6, 60}, {7, 7}};
+    ASSERT_EQ(m1, m_expected);
+}
+
+TEST(map_tests, node_handle) {
+    ciel::map<int, ciel::vector<int>> m{{1, {1}}, {2, {2, 2}}, {3, {3, 3, 3}}};
+    const int* data = m[2].data();
+
+    auto nh = m.extract(2);
+    ASSERT_EQ(nh.key(), 2);
+    ASSERT_EQ(nh.mapped().data(), data);
+
+    nh.key() = 4;
+    auto res = m.insert(std::move(nh));
+    ASSERT_TRUE(res.inserted);
+    ASSERT_EQ(res.position->first, 4);
+    ASSERT_EQ(res.position->second.data(), data);
+    ASSERT_FALSE(m.contains(2));
+
+    ciel::map<int, ciel::vector<int>> other{{1, {10}}, {5, {5}}};
+    m.merge(other);
+    ASSERT_EQ(m.size(), 4);
+    ASSERT_EQ(m[1].size(), 1);
+    ASSERT_EQ(m[1][0], 1);
+    ASSERT_EQ(other.size(), 1);
+    ASSERT_EQ(other.begin()->first, 1);
+}
+
+TEST(map_tests, order_statistics) {
+    using os_map = ciel::map<int, int, ciel::less<int>, ciel::allocator<ciel::pair<const int, int>>,
+                             ciel::avl_subtree_size>;
+
+    os_map m;
+    for (int i = 0; i < 100; ++i) {
+        m.emplace((i * 37) % 100, i);
+    }
+    for (int i = 0; i < 100; i += 3) {
+        m.erase(i);
+    }
+
+    ASSERT_EQ(m.size(), 66);
+    for (size_t k = 0; k < m.size(); ++k) {
+        const auto it = m.nth(k);
+        ASSERT_EQ(m.rank(it->first), k);
+        ASSERT_EQ(m.distance(m.begin(), it), static_cast<ptrdiff_t>(k));
+    }
+    ASSERT_EQ(m.nth(0)->first, 1);
+    ASSERT_EQ(m.nth(65)->first, 98);
+    ASSERT_EQ(m.rank(3), 2);
+    ASSERT_EQ(m.nth(66), m.end());
+
+    m.nth(0)->second = -1;
+    ASSERT_EQ(m[1], -1);
 }
\ No newline at end of file
@@ -69,4 +69,88 @@ TEST(queue_tests, priority_queue3) {
             ASSERT_EQ(v[i], i);
         }
     }
+}
+
+TEST(queue_tests, d_ary_heap) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 1000; ++i) {
+        v.emplace_back(i % 300);
+    }
+
+    const auto check = [&]<size_t D>() {
+        for (size_t len : {0, 1, 2, 3, 5, 9, 100, 1000}) {
+            std::ranges::shuffle(v, g);
+
+            ciel::make_heap<D>(v.begin(), v.begin() + len);
+            ASSERT_TRUE(ciel::is_heap<D>(v.begin(), v.begin() + len));
+
+            ciel::sort_heap<D>(v.begin(), v.begin() + len);
+            ASSERT_TRUE(std::is_sorted(v.begin(), v.begin() + len));
+
+            std::ranges::shuffle(v, g);
+            for (size_t i = 1; i <= len; ++i) {
+                ciel::push_heap<D>(v.begin(), v.begin() + i, ciel::greater<size_t>());
+                ASSERT_TRUE(ciel::is_heap<D>(v.begin(), v.begin() + i, ciel::greater<size_t>()));
+            }
+            for (size_t i = len; i > 0; --i) {
+                ciel::pop_heap<D>(v.begin(), v.begin() + i, ciel::greater<size_t>());
+                ASSERT_TRUE(ciel::is_heap<D>(v.begin(), v.begin() + i - 1, ciel::greater<size_t>()));
+            }
+            ASSERT_TRUE(std::is_sorted(v.begin(), v.begin() + len, ciel::greater<size_t>()));
+        }
+    };
+
+    check.operator()<2>();
+    check.operator()<3>();
+    check.operator()<4>();
+    check.operator()<8>();
+}
+
+TEST(queue_tests, priority_queue_arity) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 5000; ++i) {
+        v.emplace_back(i);
+    }
+    std::ranges::shuffle(v, g);
+
+    ciel::priority_queue<size_t, ciel::vector<size_t>, ciel::less<size_t>, 4> pq(v.begin(), v.end());
+    ASSERT_TRUE(ciel::is_heap<4>(pq.container().begin(), pq.container().end()));
+
+    for (size_t i = 5000; i > 0; --i) {
+        ASSERT_EQ(pq.top(), i - 1);
+        pq.pop();
+    }
+    ASSERT_TRUE(pq.empty());
+}
+
+TEST(queue_tests, priority_queue_push_range) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    ciel::priority_queue<size_t, ciel::vector<size_t>, ciel::less<size_t>, 8> pq;
+    ciel::vector<size_t> expected;
+
+    for (size_t count : {0, 1, 3, 100, 2, 1000, 5, 37}) {
+        ciel::vector<size_t> batch;
+        for (size_t i = 0; i < count; ++i) {
+            batch.emplace_back(g() % 500);
+        }
+        expected.insert(expected.end(), batch.begin(), batch.end());
+
+        pq.push_range(batch);
+        ASSERT_EQ(pq.size(), expected.size());
+        ASSERT_TRUE(ciel::is_heap<8>(pq.container().begin(), pq.container().end()));
+    }
+
+    std::ranges::sort(expected, ciel::greater<size_t>());
+    for (const size_t i : expected) {
+        ASSERT_EQ(pq.top(), i);
+        pq.pop();
+    }
 }
\ No newline at end of file
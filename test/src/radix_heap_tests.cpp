@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ciel/radix_heap.hpp>
+#include <ciel/vector.hpp>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+
+TEST(radix_heap_tests, push_pop) {
+    ciel::radix_heap<uint32_t, std::string> h;
+    ASSERT_TRUE(h.empty());
+    ASSERT_EQ(h.size(), 0);
+
+    h.push(5, "five");
+    h.push(3, "three");
+    h.emplace(8, 3, 'e');
+    ASSERT_EQ(h.size(), 3);
+    ASSERT_EQ(h.top().first, 3);
+    ASSERT_EQ(h.top().second, "three");
+
+    h.pop();
+    // Keys not less than the last top are allowed, even if they are less than the current minimum
+    h.push(3, "three again");
+    h.push(4, "four");
+    ASSERT_EQ(h.top().second, "three again");
+    h.pop();
+    ASSERT_EQ(h.top().second, "four");
+    h.pop();
+    ASSERT_EQ(h.top().second, "five");
+    h.pop();
+    ASSERT_EQ(h.top().second, "eee");
+    h.pop();
+    ASSERT_TRUE(h.empty());
+
+    h.push(100, "hundred");
+    h.clear();
+    ASSERT_TRUE(h.empty());
+    h.push(0, "zero");
+    ASSERT_EQ(h.top().first, 0);
+}
+
+TEST(radix_heap_tests, monotone_random) {
+    std::random_device rd;
+    std::mt19937_64 g(rd());
+
+    ciel::radix_heap<uint64_t, size_t> h;
+    ciel::vector<uint64_t> expected;
+    uint64_t last = 0;
+
+    for (size_t i = 0; i < 20000; ++i) {
+        if (h.empty() || g() % 3 != 0) {
+            // Never wraps around
+            const uint64_t key = last + std::min(std::numeric_limits<uint64_t>::max() - last, g() >> (g() % 64));
+            h.push(key, i);
+            expected.emplace_back(key);
+            std::ranges::push_heap(expected, std::greater<>());
+
+        } else {
+            std::ranges::pop_heap(expected, std::greater<>());
+            ASSERT_EQ(h.top().first, expected.back());
+            last = expected.back();
+            expected.pop_back();
+            h.pop();
+        }
+        ASSERT_EQ(h.size(), expected.size());
+    }
+
+    while (!h.empty()) {
+        std::ranges::pop_heap(expected, std::greater<>());
+        ASSERT_EQ(h.top().first, expected.back());
+        expected.pop_back();
+        h.pop();
+    }
+}
+
+TEST(radix_heap_tests, floating_point_keys) {
+    ciel::radix_heap<double, int> h;
+
+    for (const double key : {2.5, -1.0, 0.0, -0.0, 1e300, -1e-300, 0.5}) {
+        h.push(key, 0);
+    }
+
+    ciel::vector<double> popped;
+    while (!h.empty()) {
+        popped.emplace_back(h.top().first);
+        h.pop();
+        if (popped.back() == 0.0) {
+            h.push(-0.0, 0);    // the same key as the last top
+            h.push(0.25, 0);
+            popped.emplace_back(h.top().first);
+            h.pop();
+        }
+    }
+
+    ASSERT_TRUE(std::is_sorted(popped.begin(), popped.end()));
+    ASSERT_EQ(popped.size(), 11);
+    ASSERT_EQ(popped.front(), -1.0);
+    ASSERT_EQ(popped.back(), 1e300);
+}
\ No newline at end of file
@@ -3,7 +3,9 @@
 #include <algorithm>
 #include <ciel/set.hpp>
 #include <ciel/vector.hpp>
+#include <iterator>
 #include <random>
+#include <vector>
 
 TEST(set_tests, constructors_and_assignments) {
     const ciel::set<int> s0;
@@ -165,4 +167,231 @@ TEST(set_tests, large_amount_random_deletion) {
 
         ASSERT_TRUE(s.empty());
     }
+}
+
+TEST(set_tests, sorted_range_build) {
+    ciel::vector<size_t> v;
+    for (size_t i = 0; i < 3000; ++i) {
+        v.emplace_back(i / 3);
+    }
+
+    for (size_t n = 0; n < 40; ++n) {
+        const ciel::set<size_t> s(v.begin(), v.begin() + static_cast<ptrdiff_t>(n * 3));
+        ASSERT_EQ(s.size(), n);
+
+        size_t expected = 0;
+        for (const size_t i : s) {
+            ASSERT_EQ(i, expected++);
+        }
+        for (auto it = s.rbegin(); it != s.rend(); ++it) {
+            ASSERT_EQ(*it, --expected);
+        }
+    }
+
+    ciel::set<size_t> s(v.begin(), v.end());
+    ASSERT_EQ(s.size(), 1000);
+
+    // sorted insertion into a non-empty set
+    ciel::vector<size_t> w;
+    for (size_t i = 500; i < 2000; i += 2) {
+        w.emplace_back(i);
+    }
+    s.insert(w.begin(), w.end());
+    ASSERT_EQ(s.size(), 1500);
+    ASSERT_TRUE(ciel::is_sorted(s.begin(), s.end()));
+    ASSERT_TRUE(s.contains(1998));
+    ASSERT_FALSE(s.contains(1999));
+
+    const ciel::set<size_t> copy(s);
+    ASSERT_EQ(copy, s);
+}
+
+TEST(set_tests, set_algebra) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+
+    for (size_t loop = 0; loop < 50; ++loop) {
+        std::uniform_int_distribution<size_t> size_dist(0, loop * 40);
+        std::uniform_int_distribution<size_t> key_dist(0, loop * 60 + 1);
+
+        ciel::vector<size_t> a;
+        ciel::vector<size_t> b;
+        for (size_t i = size_dist(g); i > 0; --i) {
+            a.emplace_back(key_dist(g));
+        }
+        for (size_t i = size_dist(g); i > 0; --i) {
+            b.emplace_back(key_dist(g));
+        }
+
+        const ciel::set<size_t> sa(a.begin(), a.end());
+        const ciel::set<size_t> sb(b.begin(), b.end());
+
+        std::vector<size_t> expected;
+        std::set_union(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(expected));
+        ciel::set<size_t> s(sa);
+        s.unite(sb);
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+        const size_t union_size = expected.size();
+
+        ciel::set<size_t> s2(sb);
+        s2.unite(ciel::set<size_t>(sa));
+        ASSERT_EQ(s2, s);
+
+        expected.clear();
+        std::set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(expected));
+        s = sa;
+        s.intersect(sb);
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+
+        expected.clear();
+        std::set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(), std::back_inserter(expected));
+        s = sa;
+        s.subtract(sb);
+        ASSERT_EQ(s.size(), expected.size());
+        ASSERT_TRUE(std::equal(s.begin(), s.end(), expected.begin(), expected.end()));
+        ASSERT_TRUE(std::equal(s.rbegin(), s.rend(), expected.rbegin(), expected.rend()));
+
+        // the results stay valid trees for further modification
+        for (const size_t i : b) {
+            s.emplace(i);
+        }
+        ASSERT_EQ(s.size(), union_size);
+        ASSERT_TRUE(ciel::is_sorted(s.begin(), s.end()));
+    }
+}
+
+TEST(set_tests, node_handle) {
+    ciel::set<int> s{1, 2, 3, 4, 5};
+    const int* address = &*s.find(3);
+
+    auto nh = s.extract(3);
+    ASSERT_FALSE(nh.empty());
+    ASSERT_EQ(nh.value(), 3);
+    ASSERT_EQ(&nh.value(), address);
+    ASSERT_EQ(s.size(), 4);
+    ASSERT_FALSE(s.contains(3));
+
+    ASSERT_TRUE(s.extract(42).empty());
+
+    // modify the key and put it back without reallocation
+    nh.value() = 10;
+    auto res = s.insert(std::move(nh));
+    ASSERT_TRUE(res.inserted);
+    ASSERT_TRUE(res.node.empty());
+    ASSERT_EQ(*res.position, 10);
+    ASSERT_EQ(&*res.position, address);
+    ASSERT_TRUE(nh.empty());
+
+    // failed insertion gives the node back
+    nh = s.extract(s.begin());
+    ciel::set<int> s2{1};
+    res = s2.insert(std::move(nh));
+    ASSERT_FALSE(res.inserted);
+    ASSERT_EQ(*res.position, 1);
+    ASSERT_EQ(res.node.value(), 1);
+
+    const auto it = s2.insert(s2.end(), s.extract(2));
+    ASSERT_EQ(*it, 2);
+    ASSERT_EQ(s2, ciel::set<int>({1, 2}));
+    ASSERT_EQ(s, ciel::set<int>({4, 5, 10}));
+}
+
+TEST(set_tests, merge) {
+    std::random_device rd;
+    std::mt19937 g(rd());
+    std::uniform_int_distribution<int> dist(0, 3000);
+
+    ciel::set<int> s1;
+    ciel::set<int> s2;
+    for (size_t i = 0; i < 1000; ++i) {
+        s1.emplace(dist(g));
+        s2.emplace(dist(g));
+    }
+
+    ciel::set<int> expected(s1);
+    expected.insert(s2.begin(), s2.end());
+    const size_t total = s1.size() + s2.size();
+
+    s1.merge(s2);
+    ASSERT_EQ(s1, expected);
+    ASSERT_EQ(s1.size() + s2.size(), total);
+    for (const int i : s2) {
+        ASSERT_TRUE(s1.contains(i));
+    }
+
+    // the remaining are exactly the duplicates, which can be merged into an empty set
+    ciel::set<int> s3;
+    s3.merge(std::move(s2));
+    ASSERT_TRUE(s2.empty());
+    ASSERT_TRUE(ciel::is_sorted(s3.begin(), s3.end()));
+
+    s1.merge(s1);
+    ASSERT_EQ(s1, expected);
+}
+
+TEST(set_tests, order_statistics) {
+    using os_set = ciel::set<int, ciel::less<int>, ciel::allocator<int>, ciel::avl_subtree_size>;
+
+    std::mt19937 g(42);
+    os_set s;
+    std::vector<int> expected;
+
+    const auto check = [&] {
+        ASSERT_EQ(s.size(), expected.size());
+        for (size_t k = 0; k < expected.size(); ++k) {
+            const auto it = s.nth(k);
+            ASSERT_EQ(*it, expected[k]);
+            ASSERT_EQ(s.rank(expected[k]), k);
+            ASSERT_EQ(s.distance(s.begin(), it), static_cast<ptrdiff_t>(k));
+            ASSERT_EQ(s.distance(it, s.end()), static_cast<ptrdiff_t>(expected.size() - k));
+        }
+        ASSERT_EQ(s.nth(expected.size()), s.end());
+    };
+
+    for (int i = 0; i < 2000; ++i) {
+        const int key = static_cast<int>(g() % 1000) * 2;
+        if (g() % 3 != 0) {
+            if (s.insert(key).second) {
+                expected.insert(std::ranges::lower_bound(expected, key), key);
+            }
+
+        } else if (s.erase(key) == 1) {
+            expected.erase(std::ranges::lower_bound(expected, key));
+        }
+    }
+    check();
+
+    // keys between the stored ones
+    for (int key = -1; key < 2001; key += 2) {
+        ASSERT_EQ(s.rank(key), static_cast<size_t>(std::ranges::lower_bound(expected, key) - expected.begin()));
+    }
+
+    auto nh = s.extract(s.nth(10));
+    expected.erase(expected.begin() + 10);
+    check();
+    nh.value() = 1;
+    s.insert(std::move(nh));
+    expected.insert(std::ranges::lower_bound(expected, 1), 1);
+    check();
+
+    os_set other;
+    for (int i = 0; i < 300; ++i) {
+        other.insert(i * 7);
+    }
+    ciel::vector<int> before(s.begin(), s.end());
+    s.unite(other);
+    expected.clear();
+    std::ranges::set_union(before, other, std::back_inserter(expected));
+    check();
+
+    before = ciel::vector<int>(s.begin(), s.end());
+    s.subtract(other);
+    expected.clear();
+    std::ranges::set_difference(before, other, std::back_inserter(expected));
+    check();
+
+    const os_set copy(s);
+    ASSERT_EQ(*copy.nth(copy.size() / 2), expected[expected.size() / 2]);
 }
\ No newline at end of file
@@ -75,6 +75,34 @@ TEST(unordered_set_tests, find) {
     ASSERT_EQ(*s1.find(987), 987);
 }
 
+TEST(unordered_set_tests, find_batch) {
+    ciel::unordered_set<size_t> s1;
+
+    ciel::vector<size_t> keys;
+    ciel::vector<ciel::unordered_set<size_t>::const_iterator> res(1);
+    ASSERT_EQ(s1.find_batch(keys, res.begin()), res.begin());
+
+    keys = {1, 2, 3};
+    res.resize(3);
+    s1.find_batch(keys, res.begin());
+    ASSERT_TRUE(std::all_of(res.begin(), res.end(), [&](const auto& it) { return it == s1.end(); }));
+
+    for (size_t i = 0; i < 1000; i += 2) {
+        s1.insert(i);
+    }
+
+    keys.clear();
+    for (size_t i = 0; i < 1050; ++i) {
+        keys.emplace_back((i * 7919) % 1100);
+    }
+    res.resize(keys.size());
+    ASSERT_EQ(s1.find_batch(keys, res.begin()), res.end());
+
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ASSERT_EQ(res[i], s1.find(keys[i]));
+    }
+}
+
 TEST(unordered_set_tests, insert) {
     ciel::unordered_set s1({0, 253, 16, 412, 687, 311, 987});
 
@@ -132,4 +160,54 @@ TEST(unordered_set_tests, large_amount_insertion_finding_deletion) {
 
         ASSERT_TRUE(s.empty());
     }
+}
+
+TEST(unordered_set_tests, node_handle) {
+    ciel::unordered_set<int> s{1, 2, 3, 4, 5};
+    const int* address = &*s.find(3);
+
+    auto nh = s.extract(3);
+    ASSERT_EQ(nh.value(), 3);
+    ASSERT_EQ(s.size(), 4);
+    ASSERT_FALSE(s.contains(3));
+    ASSERT_TRUE(s.extract(42).empty());
+
+    nh.value() = 30;
+    auto res = s.insert(std::move(nh));
+    ASSERT_TRUE(res.inserted);
+    ASSERT_EQ(&*res.position, address);
+    ASSERT_EQ(s.find(30), res.position);
+
+    res = s.insert(s.extract(s.find(1)));
+    ASSERT_TRUE(res.inserted);
+
+    ciel::unordered_set<int> s2{1};
+    res = s2.insert(s.extract(1));
+    ASSERT_FALSE(res.inserted);
+    ASSERT_EQ(res.node.value(), 1);
+    ASSERT_EQ(s.size(), 4);
+}
+
+TEST(unordered_set_tests, merge) {
+    ciel::unordered_set<size_t> s1;
+    ciel::unordered_set<size_t> s2;
+    for (size_t i = 0; i < 1000; ++i) {
+        s1.insert(i);
+        s2.insert(i + 500);
+    }
+
+    s1.merge(s2);
+    ASSERT_EQ(s1.size(), 1500);
+    ASSERT_EQ(s2.size(), 500);
+    for (size_t i = 0; i < 1500; ++i) {
+        ASSERT_TRUE(s1.contains(i));
+    }
+    for (const size_t i : s2) {
+        ASSERT_TRUE(i >= 500 && i < 1000);
+    }
+
+    ciel::unordered_set<size_t> s3;
+    s3.merge(std::move(s2));
+    ASSERT_TRUE(s2.empty());
+    ASSERT_EQ(s3.size(), 500);
 }
\ No newline at end of file
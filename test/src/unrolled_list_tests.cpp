@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <ciel/unrolled_list.hpp>
+
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// 4 ints per block, so that a few elements already split and merge blocks
+using small_list = ciel::unrolled_list<int, 40>;
+
+template<class List, class Model>
+void expect_same(const List& l, const Model& m) {
+    ASSERT_EQ(l.size(), m.size());
+    ASSERT_TRUE(std::equal(l.begin(), l.end(), m.begin(), m.end()));
+    ASSERT_TRUE(std::equal(l.rbegin(), l.rend(), m.rbegin(), m.rend()));
+}
+
+}   // namespace
+
+TEST(unrolled_list_tests, constructors) {
+    const small_list l1;
+    ASSERT_TRUE(l1.empty());
+    ASSERT_EQ(l1.begin(), l1.end());
+
+    const small_list l2(10, 20);
+    expect_same(l2, std::vector<int>(10, 20));
+
+    const small_list l3(15);
+    expect_same(l3, std::vector<int>(15));
+
+    const small_list l4({1, 2, 3, 4, 5, 6, 7, 8, 9});
+    expect_same(l4, std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9}));
+
+    small_list l5(l4);
+    ASSERT_EQ(l5, l4);
+
+    const small_list l6(std::move(l5));
+    ASSERT_EQ(l6, l4);
+    ASSERT_TRUE(l5.empty());
+
+    const std::vector<int> v{3, 2, 1};
+    const ciel::unrolled_list l7(v.begin(), v.end());
+    expect_same(l7, v);
+}
+
+TEST(unrolled_list_tests, assignments) {
+    small_list l1({1, 2, 3, 4, 5, 6, 7});
+    small_list l2;
+
+    l2 = l1;
+    ASSERT_EQ(l2, l1);
+
+    l2 = {4, 5};
+    expect_same(l2, std::vector<int>({4, 5}));
+
+    l1 = std::move(l2);
+    expect_same(l1, std::vector<int>({4, 5}));
+    ASSERT_TRUE(l2.empty());
+
+    l2.assign(6, 1);
+    expect_same(l2, std::vector<int>(6, 1));
+
+    l1.swap(l2);
+    expect_same(l1, std::vector<int>(6, 1));
+    expect_same(l2, std::vector<int>({4, 5}));
+
+    small_list l3;
+    l3.swap(l1);
+    ASSERT_TRUE(l1.empty());
+    expect_same(l3, std::vector<int>(6, 1));
+}
+
+TEST(unrolled_list_tests, front_back) {
+    small_list l;
+    for (int i = 0; i < 10; ++i) {
+        l.push_back(i);
+        l.push_front(-i);
+    }
+    ASSERT_EQ(l.front(), -9);
+    ASSERT_EQ(l.back(), 9);
+
+    l.pop_front();
+    l.pop_back();
+    ASSERT_EQ(l.front(), -8);
+    ASSERT_EQ(l.back(), 8);
+    ASSERT_EQ(l.size(), 18);
+}
+
+TEST(unrolled_list_tests, insert_erase_range) {
+    small_list l({0, 1, 2, 3, 4, 5, 6, 7});
+    std::vector<int> v({0, 1, 2, 3, 4, 5, 6, 7});
+
+    auto it = l.insert(l.nth(3), 5, 42);
+    v.insert(v.begin() + 3, 5, 42);
+    ASSERT_EQ(it, l.nth(3));
+    expect_same(l, v);
+
+    it = l.insert(l.nth(1), {10, 11, 12, 13, 14, 15});
+    v.insert(v.begin() + 1, {10, 11, 12, 13, 14, 15});
+    ASSERT_EQ(it, l.nth(1));
+    expect_same(l, v);
+
+    it = l.erase(l.nth(2), l.nth(12));
+    v.erase(v.begin() + 2, v.begin() + 12);
+    ASSERT_EQ(*it, v[2]);
+    expect_same(l, v);
+
+    it = l.erase(l.begin(), l.end());
+    ASSERT_EQ(it, l.end());
+    ASSERT_TRUE(l.empty());
+}
+
+TEST(unrolled_list_tests, iterators_stable_in_other_blocks) {
+    small_list l;
+    for (int i = 0; i < 100; ++i) {
+        l.push_back(i);
+    }
+
+    const auto front = l.begin();
+    const auto back = --l.end();
+    for (int i = 0; i < 20; ++i) {
+        l.insert(l.nth(50), i);
+    }
+    for (int i = 0; i < 30; ++i) {
+        l.erase(l.nth(40));
+    }
+    ASSERT_EQ(*front, 0);
+    ASSERT_EQ(*back, 99);
+}
+
+TEST(unrolled_list_tests, insert_own_element_into_full_block) {
+    // 3 strings per block
+    using string_list = ciel::unrolled_list<std::string, 128>;
+    static_assert(string_list::block_capacity == 3);
+
+    const std::string a(40, 'a');
+    const std::string b(40, 'b');
+    const std::string c(40, 'c');
+
+    string_list l1({a, b, c});
+    l1.insert(l1.begin(), l1.back());
+    expect_same(l1, std::vector<std::string>({c, a, b, c}));
+
+    string_list l2({a, b, c});
+    l2.insert(l2.end(), l2.front());
+    expect_same(l2, std::vector<std::string>({a, b, c, a}));
+
+    string_list l3({a, b, c});
+    l3.insert(l3.nth(1), 2, l3.back());
+    expect_same(l3, std::vector<std::string>({a, c, c, b, c}));
+
+    string_list l4({a, b, c});
+    l4.emplace(l4.nth(2), l4.front());
+    expect_same(l4, std::vector<std::string>({a, b, a, c}));
+}
+
+TEST(unrolled_list_tests, random_operations) {
+    std::mt19937 g(std::random_device{}());
+    small_list l;
+    std::vector<int> v;
+
+    for (int i = 0; i < 20000; ++i) {
+        const size_t pos = v.empty() ? 0 : g() % (v.size() + 1);
+        const auto op = g() % 8;
+
+        if (op < 4 || v.empty()) {
+            auto it = l.insert(l.nth(pos), i);
+            v.insert(v.begin() + static_cast<ptrdiff_t>(pos), i);
+            ASSERT_EQ(*it, i);
+
+        } else if (op < 7) {
+            const size_t p = pos == v.size() ? pos - 1 : pos;
+            auto it = l.erase(l.nth(p));
+            v.erase(v.begin() + static_cast<ptrdiff_t>(p));
+            ASSERT_EQ(it, l.nth(p));
+
+        } else {
+            const size_t p = pos == v.size() ? pos - 1 : pos;
+            ASSERT_EQ(*l.nth(p), v[p]);
+        }
+
+        if (i % 1000 == 0) {
+            expect_same(l, v);
+        }
+    }
+    expect_same(l, v);
+}
+
+TEST(unrolled_list_tests, non_trivial) {
+    ciel::unrolled_list<std::string, 256> l;
+    std::vector<std::string> v;
+
+    for (int i = 0; i < 200; ++i) {
+        const std::string s(static_cast<size_t>(20 + i % 7), static_cast<char>('a' + i % 26));
+        const size_t pos = static_cast<size_t>(i * 7) % (v.size() + 1);
+        l.insert(l.nth(pos), s);
+        v.insert(v.begin() + static_cast<ptrdiff_t>(pos), s);
+    }
+    expect_same(l, v);
+
+    for (int i = 0; i < 150; ++i) {
+        const size_t pos = static_cast<size_t>(i * 13) % v.size();
+        l.erase(l.nth(pos));
+        v.erase(v.begin() + static_cast<ptrdiff_t>(pos));
+    }
+    expect_same(l, v);
+
+    l.resize(80, "x");
+    v.resize(80, "x");
+    expect_same(l, v);
+
+    l.resize(10);
+    v.resize(10);
+    expect_same(l, v);
+}
\ No newline at end of file